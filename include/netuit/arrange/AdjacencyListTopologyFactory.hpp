@@ -0,0 +1,61 @@
+#pragma once
+#ifndef NETUIT_ARRANGE_ADJACENCYLISTTOPOLOGYFACTORY_HPP_INCLUDE
+#define NETUIT_ARRANGE_ADJACENCYLISTTOPOLOGYFACTORY_HPP_INCLUDE
+
+#include <stddef.h>
+#include <string>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../topology/TopoEdge.hpp"
+#include "../topology/Topology.hpp"
+#include "../topology/TopoNode.hpp"
+
+namespace netuit {
+
+using adjacency_list_t = emp::vector<emp::vector<size_t>>;
+
+/*
+ * In-memory counterpart to `make_adjacency_file_topology`. Each entry
+ * `adjacency[i]` lists the nodes that node `i` has an output to. One edge
+ * is made per listed neighbor, numbered in listing order, exactly as when
+ * the same adjacency list is read from a file.
+ *
+ * @param adjacency Out-neighbors of each node.
+ */
+inline Topology make_adjacency_list_topology(
+  const adjacency_list_t& adjacency
+) {
+
+  emp::vector<netuit::TopoNode> nodes( adjacency.size() );
+
+  size_t edge_id{};
+  for (size_t node_id = 0; node_id < adjacency.size(); ++node_id) {
+    for (const size_t neighbor : adjacency[node_id]) {
+      emp_assert( neighbor < adjacency.size() );
+      nodes[node_id].AddOutput(edge_id);
+      nodes[neighbor].AddInput(edge_id);
+      ++edge_id;
+    }
+  }
+
+  return nodes;
+
+}
+
+struct AdjacencyListTopologyFactory {
+
+  Topology operator()(const adjacency_list_t& adjacency) const {
+    return make_adjacency_list_topology(adjacency);
+  }
+
+  static std::string GetName() { return "Adjacency List Topology"; }
+
+  static std::string GetSlug() { return "adjlist"; }
+
+};
+
+} // namespace netuit
+
+#endif // #ifndef NETUIT_ARRANGE_ADJACENCYLISTTOPOLOGYFACTORY_HPP_INCLUDE
@@ -2,71 +2,207 @@
 #ifndef NETUIT_ARRANGE_NAVIGABLESMALLWORLDTOPOLOGYFACTORY_HPP_INCLUDE
 #define NETUIT_ARRANGE_NAVIGABLESMALLWORLDTOPOLOGYFACTORY_HPP_INCLUDE
 
+#include <algorithm>
+#include <cmath>
 #include <cstdlib>
-#include <fstream>
+#include <iterator>
+#include <numeric>
 #include <ratio>
 #include <set>
+#include <stddef.h>
 
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
 #include "../../../third-party/Empirical/include/emp/base/vector.hpp"
-#include "../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+#include "../../../third-party/Empirical/include/emp/math/Random.hpp"
 
-#include "../../uitsl/debug/err_verify.hpp"
-#include "../../uitsl/fetch/make_temp_filepath.hpp"
-#include "../../uitsl/utility/unindent_raw_string_literal.hpp"
+#include "../../uitsl/math/mapping_utils.hpp"
 
 #include "../topology/TopoEdge.hpp"
 #include "../topology/Topology.hpp"
 #include "../topology/TopoNode.hpp"
 
-#include "AdjacencyFileTopologyFactory.hpp"
+#include "AdjacencyListTopologyFactory.hpp"
 
 namespace netuit {
 
+namespace internal {
+
+/*
+ * Log of the number of lattice offsets in `dim` dimensions with exactly
+ * `m` nonzero components and Manhattan length `d`.
+ */
+inline double log_count_offsets(
+  const size_t dim, const size_t d, const size_t m
+) {
+  emp_assert( m >= 1 && m <= std::min(dim, d) );
+  // choose axes, choose signs, then split d into m positive parts
+  return std::lgamma(dim + 1) - std::lgamma(m + 1) - std::lgamma(dim - m + 1)
+    + m * std::log(2.0)
+    + std::lgamma(d) - std::lgamma(m) - std::lgamma(d - m + 1);
+}
+
 /*
- * @param n The length of one side of the lattice; the number of nodes in the graph is therefore $n^2$.
+ * Draw an offset uniformly from all lattice offsets in `dim` dimensions
+ * with Manhattan length `d`.
+ */
+inline emp::vector<int> sample_offset(
+  emp::Random& rand, const size_t dim, const size_t d
+) {
+
+  emp_assert( d >= 1 );
+
+  // pick how many components are nonzero
+  const size_t max_m = std::min(dim, d);
+  emp::vector<double> m_weights( max_m + 1 );
+  for (size_t m = 1; m <= max_m; ++m) {
+    m_weights[m] = m_weights[m - 1] + std::exp(
+      log_count_offsets(dim, d, m) - log_count_offsets(dim, d, 1)
+    );
+  }
+  const size_t m = std::distance( std::begin(m_weights), std::upper_bound(
+    std::begin(m_weights), std::end(m_weights), rand.GetDouble(m_weights.back())
+  ) );
+  emp_assert( m >= 1 && m <= max_m );
+
+  // pick which components are nonzero, partial Fisher-Yates
+  emp::vector<size_t> axes( dim );
+  std::iota( std::begin(axes), std::end(axes), size_t{} );
+  for (size_t i = 0; i < m; ++i) {
+    std::swap( axes[i], axes[i + rand.GetUInt(dim - i)] );
+  }
+
+  // split d into m positive parts at m - 1 distinct cut points in [1, d),
+  // drawn with Floyd's algorithm
+  std::set<size_t> cuts;
+  for (size_t j = d - m + 1; j < d; ++j) {
+    const size_t cut = 1 + rand.GetUInt(j);
+    if ( !cuts.insert(cut).second ) cuts.insert(j);
+  }
+  cuts.insert(d);
+
+  emp::vector<int> offset( dim );
+  size_t prev{};
+  auto axis_it = std::begin( axes );
+  for (const size_t cut : cuts) {
+    const int part = cut - prev;
+    offset[ *axis_it++ ] = rand.P(0.5) ? part : -part;
+    prev = cut;
+  }
+
+  return offset;
+
+}
+
+} // namespace internal
+
+/*
+ * Kleinberg's navigable small world model on a non-periodic lattice, as in
+ * networkx's navigable_small_world_graph.
+ *
+ * Long-range contacts are drawn by picking a Manhattan distance, weighted
+ * by the number of lattice offsets at that distance, then a uniform offset
+ * at that distance, rejecting targets that fall off the lattice. This
+ * samples exactly from the $d^{-r}$ distribution without visiting every
+ * node.
+ *
+ * @param n The length of one side of the lattice; the number of nodes in the graph is therefore $n^dim$.
  * @param p The diameter of short range connections.
  *  Each node is joined with every other node within this lattice distance.
  * @param q The number of long-range connections for each node.
  * @param r Exponent for decaying probability of connections.
  *   The probability of connecting to a node at lattice distance $d$ is $d^{-r}$.
  * @param dim Dimension of grid
+ * @param seed Random number generator seed
  */
 inline Topology make_navigable_small_world_topology(
   const size_t n,
   const size_t p=1,
   const size_t q=1,
   const double r=2,
-  const size_t dim=1
+  const size_t dim=1,
+  const int seed=1
 ) {
 
-  const auto tmpfile = uitsl::make_temp_filepath();
-
-  const std::string command_template = std::string{"python3 -c \""}
-    + uitsl::unindent_raw_string_literal( R"(
-      import networkx as nx
-
-      G = nx.generators.geometric.navigable_small_world_graph(
-        %u, p=%u, q=%u, r=%f, dim=%u, seed=1
-      )
-
-      # relabel nodes to numeric indices from previous coordinate labels
-      H = nx.relabel_nodes(
-        G,
-        { label : idx for idx, label in enumerate(G.nodes()) },
-      )
-
-      with open('%s', 'w') as file:
-          for line in nx.generate_adjlist(H):
-              file.write(line + '\n')
-      )" ) + "\"";
+  emp::Random rand( seed );
+
+  const uitsl::Dims dims( dim, n );
+  const size_t num_nodes = std::pow( n, dim );
+
+  // offsets of all lattice points within Manhattan distance p
+  emp::vector<emp::vector<int>> short_offsets;
+  {
+    const size_t side = 2 * p + 1;
+    const size_t num_candidates = std::pow( side, dim );
+    for (size_t code = 0; code < num_candidates; ++code) {
+      emp::vector<int> offset( dim );
+      size_t distance{};
+      for (size_t k = 0, rest = code; k < dim; ++k, rest /= side) {
+        offset[k] = static_cast<int>( rest % side ) - static_cast<int>( p );
+        distance += std::abs( offset[k] );
+      }
+      if ( distance >= 1 && distance <= p ) short_offsets.push_back( offset );
+    }
+  }
 
-  const std::string command = emp::format_string(
-    command_template, n, p, q, r, dim, tmpfile.c_str()
-  );
+  // cumulative weights of long-range contact distances, up to lattice span
+  const size_t max_distance = dim * (n ? n - 1 : 0);
+  emp::vector<double> distance_weights( max_distance + 1 );
+  for (size_t d = 1; d <= max_distance; ++d) {
+    double weight{};
+    for (size_t m = 1; m <= std::min(dim, d); ++m) weight += std::exp(
+      internal::log_count_offsets(dim, d, m) - r * std::log(d)
+    );
+    distance_weights[d] = distance_weights[d - 1] + weight;
+  }
 
-  uitsl::err_verify( std::system( command.c_str() ) );
+  auto try_apply = [&](uitsl::Point& point, const emp::vector<int>& offset){
+    for (size_t k = 0; k < dim; ++k) {
+      const int coordinate = static_cast<int>( point[k] ) + offset[k];
+      if ( coordinate < 0 || coordinate >= static_cast<int>( n ) ) return false;
+      point[k] = coordinate;
+    }
+    return true;
+  };
+
+  adjacency_list_t adjacency( num_nodes );
+  for (size_t node = 0; node < num_nodes; ++node) {
+    const uitsl::Point point = uitsl::linear_decode( node, dims );
+
+    for (const auto& offset : short_offsets) {
+      uitsl::Point neighbor( point );
+      if ( try_apply(neighbor, offset) ) adjacency[node].push_back(
+        uitsl::linear_encode( neighbor, dims )
+      );
+    }
+
+    if ( max_distance == 0 ) continue;
+    for (size_t i = 0; i < q; ++i) {
+      uitsl::Point contact;
+      do {
+        const size_t d = std::distance(
+          std::begin( distance_weights ),
+          std::upper_bound(
+            std::begin( distance_weights ),
+            std::end( distance_weights ),
+            rand.GetDouble( distance_weights.back() )
+          )
+        );
+        contact = point;
+        if ( try_apply(contact, internal::sample_offset(rand, dim, d)) ) break;
+      } while (true);
+      adjacency[node].push_back( uitsl::linear_encode( contact, dims ) );
+    }
+
+    // long-range contacts may repeat or coincide with short range contacts
+    auto& neighbors = adjacency[node];
+    std::sort( std::begin(neighbors), std::end(neighbors) );
+    neighbors.erase(
+      std::unique( std::begin(neighbors), std::end(neighbors) ),
+      std::end(neighbors)
+    );
+  }
 
-  return netuit::make_adjacency_file_topology( tmpfile );
+  return netuit::make_adjacency_list_topology( adjacency );
 
 }
 
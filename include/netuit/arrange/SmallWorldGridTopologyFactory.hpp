@@ -2,75 +2,86 @@
 #ifndef NETUIT_ARRANGE_SMALLWORLDGRIDTOPOLOGYFACTORY_HPP_INCLUDE
 #define NETUIT_ARRANGE_SMALLWORLDGRIDTOPOLOGYFACTORY_HPP_INCLUDE
 
-#include <cstdlib>
-#include <fstream>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
 #include <ratio>
 #include <set>
+#include <stddef.h>
 
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
 #include "../../../third-party/Empirical/include/emp/base/vector.hpp"
-#include "../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+#include "../../../third-party/Empirical/include/emp/math/Random.hpp"
+#include "../../../third-party/Empirical/include/emp/math/random_utils.hpp"
 
-#include "../../uitsl/debug/err_verify.hpp"
-#include "../../uitsl/fetch/make_temp_filepath.hpp"
-#include "../../uitsl/utility/unindent_raw_string_literal.hpp"
+#include "../../uitsl/math/mapping_utils.hpp"
+#include "../../uitsl/math/math_utils.hpp"
 
 #include "../topology/TopoEdge.hpp"
 #include "../topology/Topology.hpp"
 #include "../topology/TopoNode.hpp"
 
-#include "AdjacencyFileTopologyFactory.hpp"
+#include "AdjacencyListTopologyFactory.hpp"
 
 namespace netuit {
 
 /*
- * @param n The length of one side of the lattice; the number of nodes in the graph is therefore $n^2$.
+ * Nodes sit on a periodic lattice, each connected in both directions to
+ * its immediate neighbors along every axis. Nodes are then shuffled and
+ * paired off, and each pair is joined in both directions with
+ * probability p.
+ *
+ * @param n The length of one side of the lattice; the number of nodes in the graph is therefore $n^dim$.
  * @param p The probability of each node engaging in a long distance connection.
  * @param dim Dimension of grid
+ * @param seed Random number generator seed
  */
 inline Topology make_small_world_grid_topology(
   const size_t n,
   const double p=1.0,
-  const size_t dim=1
+  const size_t dim=1,
+  const int seed=1
 ) {
 
-  const auto tmpfile = uitsl::make_temp_filepath();
+  emp::Random rand( seed );
 
-  const std::string command_template = std::string{"python3 -c \""}
-    + uitsl::unindent_raw_string_literal( R"(
-      import networkx as nx
-      import random
+  const uitsl::Dims dims( dim, n );
+  const size_t num_nodes = std::pow( n, dim );
 
-      random.seed(1)
+  adjacency_list_t adjacency( num_nodes );
 
-      G = nx.grid_graph(
-        [%u for __ in range(%u)], periodic=True
-      ).to_directed()
-
-      nodes = list(G.nodes())
-      random.shuffle( nodes )
-      for a, b in zip(nodes[0::2], nodes[1::2]):
-        if (random.random() < %f):
-          G.add_edge(a, b)
-          G.add_edge(b, a)
-
-      # relabel nodes to numeric indices from previous coordinate labels
-      H = nx.relabel_nodes(
-        G,
-        { label : idx for idx, label in enumerate(G.nodes()) },
-      )
-
-      with open('%s', 'w') as file:
-          for line in nx.generate_adjlist(H):
-              file.write(line + '\n')
-      )" ) + "\"";
+  // lattice connections
+  for (size_t node = 0; node < num_nodes; ++node) {
+    const uitsl::Point point = uitsl::linear_decode( node, dims );
+    for (size_t k = 0; k < dim; ++k) for (const int step : {-1, +1}) {
+      uitsl::Point neighbor( point );
+      neighbor[k] = uitsl::circular_index( point[k], n, step );
+      adjacency[node].push_back( uitsl::linear_encode( neighbor, dims ) );
+    }
+  }
 
-  const std::string command = emp::format_string(
-    command_template, n, dim, p, tmpfile.c_str()
-  );
+  // long distance connections
+  emp::vector<size_t> nodes( num_nodes );
+  std::iota( std::begin(nodes), std::end(nodes), size_t{} );
+  emp::Shuffle( rand, nodes );
+  for (size_t i = 0; i + 1 < nodes.size(); i += 2) {
+    const size_t a = nodes[i], b = nodes[i + 1];
+    if ( rand.P( p ) ) {
+      adjacency[a].push_back( b );
+      adjacency[b].push_back( a );
+    }
+  }
 
-  uitsl::err_verify( std::system( command.c_str() ) );
+  // lattice and long distance connections may coincide on small grids
+  for (auto& neighbors : adjacency) {
+    std::sort( std::begin(neighbors), std::end(neighbors) );
+    neighbors.erase(
+      std::unique( std::begin(neighbors), std::end(neighbors) ),
+      std::end(neighbors)
+    );
+  }
 
-  return netuit::make_adjacency_file_topology( tmpfile );
+  return netuit::make_adjacency_list_topology( adjacency );
 
 }
 
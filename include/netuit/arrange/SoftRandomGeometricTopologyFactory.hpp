@@ -2,62 +2,151 @@
 #ifndef NETUIT_ARRANGE_SOFTRANDOMGEOMETRICTOPOLOGYFACTORY_HPP_INCLUDE
 #define NETUIT_ARRANGE_SOFTRANDOMGEOMETRICTOPOLOGYFACTORY_HPP_INCLUDE
 
-#include <cstdlib>
-#include <fstream>
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <numeric>
 #include <ratio>
-#include <set>
+#include <stddef.h>
 
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
 #include "../../../third-party/Empirical/include/emp/base/vector.hpp"
-#include "../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+#include "../../../third-party/Empirical/include/emp/math/Random.hpp"
 
-#include "../../uitsl/debug/err_verify.hpp"
-#include "../../uitsl/fetch/make_temp_filepath.hpp"
-#include "../../uitsl/utility/unindent_raw_string_literal.hpp"
+#include "../../uitsl/math/mapping_utils.hpp"
 
 #include "../topology/TopoEdge.hpp"
 #include "../topology/Topology.hpp"
 #include "../topology/TopoNode.hpp"
 
-#include "AdjacencyFileTopologyFactory.hpp"
+#include "AdjacencyListTopologyFactory.hpp"
 
 namespace netuit {
 
 /*
-* @param n Number of nodes
-* @param radius Distance threshold value
-* @param dim Dimension of graph
+ * Nodes are placed uniformly at random in the unit hypercube. Each pair of
+ * nodes within distance radius of each other is joined with probability
+ * exp(-distance), as in networkx's soft_random_geometric_graph. Each
+ * undirected edge is represented by a single directed edge from the lower
+ * to the higher node id.
+ *
+ * Candidate pairs are found through a uniform grid of cells at least
+ * radius wide, so only nodes in adjacent cells are ever compared.
+ *
+ * @param n Number of nodes
+ * @param radius Distance threshold value
+ * @param dim Dimension of graph
+ * @param seed Random number generator seed
  */
 inline Topology make_soft_random_geometric_topology(
   const size_t n,
   const double radius=0.1,
-  const size_t dim=2
+  const size_t dim=2,
+  const int seed=1
 ) {
 
-  const auto tmpfile = uitsl::make_temp_filepath();
+  emp_assert( dim > 0 );
 
-  const std::string command_template = std::string{"python3 -c \""}
-    + uitsl::unindent_raw_string_literal( R"(
-      import networkx as nx
-      import numpy as np
+  emp::Random rand( seed );
 
-      G = nx.generators.geometric.soft_random_geometric_graph(
-        %u, %f, dim=%u, seed=1
-      )
+  // position of node i along axis k is at positions[i * dim + k]
+  emp::vector<double> positions( n * dim );
+  for (auto& coordinate : positions) coordinate = rand.GetDouble();
 
-      print('mean degree', np.mean([val for (node, val) in G.degree()]))
+  // cells must be no narrower than radius,
+  // and there should be no more cells than nodes
+  const size_t cells_per_axis = std::max( size_t{1}, std::min(
+    radius > 0 ? static_cast<size_t>( 1.0 / radius ) : n,
+    static_cast<size_t>( std::pow( n, 1.0 / dim ) )
+  ) );
+  const uitsl::Dims cell_dims( dim, cells_per_axis );
 
-      with open('%s', 'w') as file:
-          for line in nx.generate_adjlist(G):
-              file.write(line + '\n')
-      )" ) + "\"";
-
-  const std::string command = emp::format_string(
-    command_template, n, radius, dim, tmpfile.c_str()
+  auto get_cell = [&](const size_t node){
+    uitsl::Point cell( dim );
+    for (size_t k = 0; k < dim; ++k) cell[k] = std::min(
+      static_cast<size_t>( positions[node * dim + k] * cells_per_axis ),
+      cells_per_axis - 1
+    );
+    return cell;
+  };
+
+  // bucket nodes by cell, counting sort style
+  const size_t num_cells = std::pow( cells_per_axis, dim );
+  emp::vector<size_t> cell_begins( num_cells + 1 );
+  emp::vector<size_t> node_cells( n );
+  for (size_t node = 0; node < n; ++node) {
+    node_cells[node] = uitsl::linear_encode( get_cell(node), cell_dims );
+    ++cell_begins[ node_cells[node] + 1 ];
+  }
+  std::partial_sum(
+    std::begin( cell_begins ),
+    std::end( cell_begins ),
+    std::begin( cell_begins )
   );
+  emp::vector<size_t> cell_members( n );
+  {
+    emp::vector<size_t> cursors( std::begin(cell_begins), std::prev(
+      std::end(cell_begins)
+    ) );
+    for (size_t node = 0; node < n; ++node) {
+      cell_members[ cursors[ node_cells[node] ]++ ] = node;
+    }
+  }
+
+  auto get_distance = [&](const size_t a, const size_t b){
+    double sum{};
+    for (size_t k = 0; k < dim; ++k) {
+      const double diff = positions[a * dim + k] - positions[b * dim + k];
+      sum += diff * diff;
+    }
+    return std::sqrt( sum );
+  };
+
+  const size_t num_offsets = std::pow( 3, dim );
+
+  adjacency_list_t adjacency( n );
+  emp::vector<size_t> candidates;
+  for (size_t node = 0; node < n; ++node) {
+
+    // collect higher-id nodes from this and adjacent cells
+    candidates.clear();
+    const uitsl::Point cell = get_cell( node );
+    for (size_t offset = 0; offset < num_offsets; ++offset) {
+      uitsl::Point neighbor_cell( cell );
+      bool in_bounds{ true };
+      for (size_t k = 0, code = offset; k < dim; ++k, code /= 3) {
+        // shift coordinate by -1, 0, or +1
+        neighbor_cell[k] += code % 3;
+        in_bounds &= neighbor_cell[k] >= 1
+          && neighbor_cell[k] <= cells_per_axis;
+        --neighbor_cell[k];
+      }
+      if ( !in_bounds ) continue;
+
+      const size_t neighbor_cell_idx = uitsl::linear_encode(
+        neighbor_cell, cell_dims
+      );
+      std::copy_if(
+        std::next( std::begin(cell_members), cell_begins[neighbor_cell_idx] ),
+        std::next( std::begin(cell_members), cell_begins[neighbor_cell_idx+1] ),
+        std::back_inserter( candidates ),
+        [node](const size_t candidate){ return candidate > node; }
+      );
+    }
+
+    // visit candidates in a fixed order so results depend only on seed
+    std::sort( std::begin(candidates), std::end(candidates) );
+
+    for (const size_t candidate : candidates) {
+      const double distance = get_distance( node, candidate );
+      if ( distance <= radius && rand.P( std::exp( -distance ) ) ) {
+        adjacency[node].push_back( candidate );
+      }
+    }
 
-  uitsl::err_verify( std::system( command.c_str() ) );
+  }
 
-  return netuit::make_adjacency_file_topology( tmpfile );
+  return netuit::make_adjacency_list_topology( adjacency );
 
 }
 
@@ -0,0 +1,158 @@
+#pragma once
+#ifndef NETUIT_ASSIGN_GENERATEHIERARCHICALASSIGNMENTS_HPP_INCLUDE
+#define NETUIT_ASSIGN_GENERATEHIERARCHICALASSIGNMENTS_HPP_INCLUDE
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <stddef.h>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../uitsl/debug/EnumeratedFunctor.hpp"
+#include "../../uitsl/mpi/proc_id_t.hpp"
+#include "../../uitsl/parallel/CpuTopology.hpp"
+#include "../../uitsl/parallel/thread_utils.hpp"
+
+#include "../topology/Topology.hpp"
+
+#include "GenerateMetisAssignments.hpp"
+#include "MetisWeights.hpp"
+
+namespace netuit {
+
+namespace internal {
+
+/// Assign nodes of topology to CPUs at positions [begin, end) of cpus,
+/// splitting first between groups of CPUs that differ at level, then
+/// recursing into each group at the next level.
+/// @param[in] topology nodes to assign, with canonical IDs of the
+/// top-level topology.
+/// @param[out] res map of canonical node ID to CPU position.
+inline void assign_hierarchically(
+  const netuit::Topology& topology,
+  const uitsl::CpuTopology& cpus,
+  const size_t begin,
+  const size_t end,
+  const size_t level,
+  const netuit::MetisWeights& weights,
+  std::unordered_map<size_t, uitsl::thread_id_t>& res
+) {
+  if ( topology.GetSize() == 0 ) return;
+
+  if ( end - begin == 1 || level == uitsl::CpuTopology::num_levels ) {
+    for (size_t i = 0; i < topology.GetSize(); ++i) {
+      res[topology.GetCanonicalNodeID(i)] = begin;
+    }
+    return;
+  }
+
+  // boundaries between groups of CPUs that differ at this level
+  emp::vector<size_t> bounds{ begin };
+  for (size_t i = begin + 1; i < end; ++i) {
+    if ( !cpus.SharesLevel(i - 1, i, level) ) bounds.push_back( i );
+  }
+  bounds.push_back( end );
+  const size_t num_groups = bounds.size() - 1;
+
+  if ( num_groups == 1 ) {
+    assign_hierarchically(topology, cpus, begin, end, level + 1, weights, res);
+    return;
+  }
+
+  // split in proportion to how many CPUs each group has, or give each node
+  // its own group if there are too few nodes to go around
+  emp::vector<int32_t> partition( topology.GetSize() );
+  if ( topology.GetSize() > num_groups ) {
+    netuit::MetisWeights level_weights{
+      weights.node_weights, weights.edge_weights, {}
+    };
+    for (size_t group = 0; group < num_groups; ++group) {
+      level_weights.part_weights.push_back(
+        bounds[group + 1] - bounds[group]
+      );
+    }
+    partition = netuit::PartitionMetis( num_groups, topology, level_weights );
+  } else std::iota( std::begin(partition), std::end(partition), 0 );
+
+  emp::vector<std::unordered_set<size_t>> groups( num_groups );
+  for (size_t i = 0; i < topology.GetSize(); ++i) {
+    groups[ partition[i] ].insert( i );
+  }
+
+  for (size_t group = 0; group < num_groups; ++group) {
+    netuit::Topology subtopo = topology.GetSubTopology( groups[group] );
+
+    // keep canonical IDs pointing into the top-level topology
+    std::unordered_map<size_t, size_t> canonical_ids;
+    for (size_t i = 0; i < subtopo.GetSize(); ++i) {
+      canonical_ids[i] = topology.GetCanonicalNodeID(
+        subtopo.GetCanonicalNodeID(i)
+      );
+    }
+    subtopo.SetMap( canonical_ids );
+
+    assign_hierarchically(
+      subtopo, cpus, bounds[group], bounds[group + 1], level + 1, weights, res
+    );
+  }
+}
+
+} // namespace internal
+
+/// This function returns a pair of functors determining thread and process
+/// assignments, by partitioning topology with METIS down the hardware
+/// hierarchy: first between processes, then within each process between
+/// packages, NUMA nodes, cores, and finally hardware threads. Nodes that
+/// communicate heavily therefore tend to share a core, or failing that a
+/// NUMA node or package.
+///
+/// Every process is assumed to have the same CPU layout. Thread t of each
+/// process should run on cpus.GetCpu(t), e.g., by passing cpus.GetCpuIDs()
+/// to uitsl::ThreadTeam.
+/// @param[in] num_procs Number of processes.
+/// @param[in] cpus CPUs available to each process, one thread per CPU.
+/// @param[in] topology Topology to partition.
+/// @param[in] weights Node and edge weights, and target part size of each
+/// process.
+/// @return std::pair of process and thread assignments.
+inline std::pair<
+  uitsl::EnumeratedFunctor<netuit::Topology::node_id_t, uitsl::proc_id_t>,
+  uitsl::EnumeratedFunctor<netuit::Topology::node_id_t, uitsl::thread_id_t>
+> GenerateHierarchicalAssignments(
+  const size_t num_procs,
+  const uitsl::CpuTopology& cpus,
+  const netuit::Topology& topology,
+  const netuit::MetisWeights& weights={}
+) {
+  // make sure topology isn't empty
+  if (topology.GetSize() == 0) return {};
+
+  emp_assert( cpus.GetSize() );
+
+  uitsl::EnumeratedFunctor<netuit::Topology::node_id_t, uitsl::proc_id_t>
+    proc_assigner{ netuit::PartitionMetis(num_procs, topology, weights) };
+
+  std::unordered_map<size_t, uitsl::thread_id_t> thread_assignments;
+  for (const auto& [proc_id, subtopo] : netuit::GetSubTopologies(
+    topology, proc_assigner
+  )) {
+    internal::assign_hierarchically(
+      subtopo, cpus, 0, cpus.GetSize(), 0, weights, thread_assignments
+    );
+  }
+
+  return std::pair{
+    proc_assigner,
+    uitsl::EnumeratedFunctor<netuit::Topology::node_id_t, uitsl::thread_id_t>{
+      thread_assignments
+    }
+  };
+}
+
+} // namespace netuit
+
+#endif // #ifndef NETUIT_ASSIGN_GENERATEHIERARCHICALASSIGNMENTS_HPP_INCLUDE
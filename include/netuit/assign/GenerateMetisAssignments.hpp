@@ -2,7 +2,10 @@
 #ifndef NETUIT_ASSIGN_GENERATEMETISASSIGNMENTS_HPP_INCLUDE
 #define NETUIT_ASSIGN_GENERATEMETISASSIGNMENTS_HPP_INCLUDE
 
+#include <algorithm>
 #include <functional>
+#include <limits>
+#include <map>
 #include <numeric>
 #include <stddef.h>
 #include <utility>
@@ -20,14 +23,20 @@
 
 #include "../topology/Topology.hpp"
 
+#include "MetisWeights.hpp"
+
 namespace netuit {
 
 /// Apply METIS' K-way partitioning algorithm to subdivide topology
 /// @param parts number of parts to subdivide topology into
 /// @param topology topology to subdivide
+/// @param weights node weights, keyed by canonical node ID, edge weights,
+/// and target part sizes
 /// @return vector indicating what partition each vertex should go into
 emp::vector<int32_t> PartitionMetis(
-  const size_t num_parts, const netuit::Topology& topology
+  const size_t num_parts,
+  const netuit::Topology& topology,
+  const netuit::MetisWeights& weights
 ) {
 
   emp_assert( num_parts <= topology.GetSize(), num_parts, topology.GetSize() );
@@ -55,6 +64,55 @@ emp::vector<int32_t> PartitionMetis(
   // get topology as CSR
   auto [xadj, adjacency] = topology.AsCSR();
 
+  // node weights, by position in topology
+  emp::vector<int32_t> vwgt;
+  if ( weights.node_weights.size() ) {
+    for (size_t i = 0; i < topology.GetSize(); ++i) {
+      vwgt.push_back(
+        weights.GetNodeWeight( topology.GetCanonicalNodeID(i) )
+      );
+    }
+  }
+
+  // METIS requires symmetric edge weights, so every edge between a pair of
+  // nodes weighs the summed weight of all edges between them
+  emp::vector<int32_t> adjwgt;
+  if ( weights.edge_weights.size() ) {
+    std::map<std::pair<int32_t, int32_t>, int64_t> pair_weights;
+    const auto as_pair = [](const int32_t a, const int32_t b){
+      return std::pair{ std::min(a, b), std::max(a, b) };
+    };
+    for (size_t i = 0; i < topology.GetSize(); ++i) {
+      const auto& outputs = topology[i].GetOutputs();
+      for (size_t j = 0; j < outputs.size(); ++j) {
+        pair_weights[ as_pair( i, adjacency[xadj[i] + j] ) ]
+          += weights.GetEdgeWeight( outputs[j].GetEdgeID() );
+      }
+    }
+    for (size_t i = 0; i < topology.GetSize(); ++i) {
+      for (int32_t j = xadj[i]; j < xadj[i + 1]; ++j) {
+        adjwgt.push_back( static_cast<int32_t>( std::min(
+          pair_weights.at( as_pair( i, adjacency[j] ) ),
+          int64_t{ std::numeric_limits<int32_t>::max() }
+        ) ) );
+      }
+    }
+  }
+
+  // target part sizes, normalized to sum to one
+  emp::vector<real_t> tpwgts;
+  if ( weights.part_weights.size() ) {
+    emp_assert( weights.part_weights.size() == num_parts );
+    const double total = std::accumulate(
+      std::begin( weights.part_weights ),
+      std::end( weights.part_weights ),
+      0.0
+    );
+    for (const double part_weight : weights.part_weights) {
+      tpwgts.push_back( part_weight / total );
+    }
+  }
+
   // use default options
   int32_t options[METIS_NOPTIONS];
   METIS_SetDefaultOptions(options);
@@ -65,11 +123,11 @@ emp::vector<int32_t> PartitionMetis(
     &n_cons, // idx_t *ncon: number of balancing constraints.
     xadj.data(), // idx_t *xadj: array of node indexes into adjacency[]
     adjacency.data(), // idx_t *adjncy:  array of adjacenct nodes for every node
-    nullptr, // idx_t *vwgt: weights of nodes
+    vwgt.size() ? vwgt.data() : nullptr, // idx_t *vwgt: weights of nodes
     nullptr, // idx_t *vsize: size of nodes for total comunication value
-    nullptr, // idx_t *adjwgt: weights of edges
+    adjwgt.size() ? adjwgt.data() : nullptr, // idx_t *adjwgt: weights of edges
     &parts, // idx_t *nparts: number of parts to partition the graph into
-    nullptr, // real_t *tpwgts: weight for each partition and constraint
+    tpwgts.size() ? tpwgts.data() : nullptr, // real_t *tpwgts: weight for each partition and constraint
     nullptr, // real_t ubvec: allowed load imbalance tolerance for each constrnt
     nullptr, // idx_t *options: array of options
     &objval, // idx_t *objvalL edge-cut or total comm volume of the solution
@@ -82,6 +140,16 @@ emp::vector<int32_t> PartitionMetis(
   return result;
 }
 
+/// Apply METIS' K-way partitioning algorithm to subdivide topology
+/// @param parts number of parts to subdivide topology into
+/// @param topology topology to subdivide
+/// @return vector indicating what partition each vertex should go into
+emp::vector<int32_t> PartitionMetis(
+  const size_t num_parts, const netuit::Topology& topology
+) {
+  return PartitionMetis( num_parts, topology, netuit::MetisWeights{} );
+}
+
 /// This function is used to get subtopologies made up of all
 /// the neighbors of a node in a given topology, for all nodes.
 /// @param[in] topo Topology to get subtopologies of.
@@ -113,12 +181,20 @@ std::unordered_map<uitsl::proc_id_t, netuit::Topology> GetSubTopologies(
 // todo: rename
 std::unordered_map<size_t, uitsl::thread_id_t> Shim(
   const std::unordered_map<uitsl::proc_id_t, netuit::Topology>& proc_map,
-  const size_t threads_per_proc
+  const emp::vector<size_t>& threads_per_proc,
+  const netuit::MetisWeights& weights
 ) {
   std::unordered_map<size_t, uitsl::thread_id_t> ret;
 
+  // threads within a proc are interchangeable
+  netuit::MetisWeights thread_weights{
+    weights.node_weights, weights.edge_weights, {}
+  };
+
   for (const auto& [proc_id, subtopo] : proc_map) {
-    const auto thread_assign = PartitionMetis( threads_per_proc, subtopo );
+    const auto thread_assign = PartitionMetis(
+      threads_per_proc.at( proc_id ), subtopo, thread_weights
+    );
     for (size_t i = 0; i < subtopo.GetSize(); ++i) {
       ret[subtopo.GetCanonicalNodeID(i)] = thread_assign[i];
     }
@@ -127,31 +203,65 @@ std::unordered_map<size_t, uitsl::thread_id_t> Shim(
   return ret;
 }
 
+// todo: rename
+std::unordered_map<size_t, uitsl::thread_id_t> Shim(
+  const std::unordered_map<uitsl::proc_id_t, netuit::Topology>& proc_map,
+  const size_t threads_per_proc
+) {
+  uitsl::proc_id_t max_proc_id{};
+  for (const auto& [proc_id, subtopo] : proc_map) {
+    max_proc_id = std::max( max_proc_id, proc_id );
+  }
+
+  return Shim(
+    proc_map,
+    emp::vector<size_t>( max_proc_id + 1, threads_per_proc ),
+    netuit::MetisWeights{}
+  );
+}
+
 
 /// This function returns a pair of functors determining thread and process
 /// assignments, from a (hopefully optimal) k-way partitioning as returned by METIS.
-/// @param[in] num_procs Number of processes.
-/// @param[in] threads_per_proc Number of threads per process.
+/// Supports procs with differing thread counts.
+/// @param[in] threads_per_proc Number of threads of each process.
 /// @param[in] topology Topology to partition.
+/// @param[in] weights Node and edge weights. Target part sizes apply to
+/// processes and default to each process' share of all threads.
 /// @return std::pair of process and thread assignments. *
 std::pair<
   uitsl::EnumeratedFunctor<netuit::Topology::node_id_t, uitsl::proc_id_t>,
   uitsl::EnumeratedFunctor<netuit::Topology::node_id_t, uitsl::thread_id_t>
 > GenerateMetisAssignments (
-  const size_t num_procs,
-  const size_t threads_per_proc,
-  const netuit::Topology& topology
+  const emp::vector<size_t>& threads_per_proc,
+  const netuit::Topology& topology,
+  const netuit::MetisWeights& weights={}
 ) {
   // make sure topology isn't empty
   if (topology.GetSize() == 0) return {};
 
+  netuit::MetisWeights proc_weights{ weights };
+  const bool is_heterogeneous = std::adjacent_find(
+    std::begin( threads_per_proc ),
+    std::end( threads_per_proc ),
+    std::not_equal_to<size_t>{}
+  ) != std::end( threads_per_proc );
+  if ( proc_weights.part_weights.empty() && is_heterogeneous ) {
+    proc_weights.part_weights.assign(
+      std::begin( threads_per_proc ), std::end( threads_per_proc )
+    );
+  }
+
   uitsl::EnumeratedFunctor<netuit::Topology::node_id_t, uitsl::proc_id_t>
-    proc_assigner{ PartitionMetis(num_procs, topology) };
+    proc_assigner{ PartitionMetis(
+      threads_per_proc.size(), topology, proc_weights
+    ) };
 
   uitsl::EnumeratedFunctor<netuit::Topology::node_id_t, uitsl::thread_id_t>
     thread_assigner{ Shim(
       GetSubTopologies(topology, proc_assigner),
-      threads_per_proc
+      threads_per_proc,
+      weights
     ) };
 
   return std::pair{
@@ -165,6 +275,30 @@ std::pair<
 /// @param[in] num_procs Number of processes.
 /// @param[in] threads_per_proc Number of threads per process.
 /// @param[in] topology Topology to partition.
+/// @param[in] weights Node and edge weights, and target part size of each
+/// process.
+/// @return std::pair of process and thread assignments. *
+std::pair<
+  uitsl::EnumeratedFunctor<netuit::Topology::node_id_t, uitsl::proc_id_t>,
+  uitsl::EnumeratedFunctor<netuit::Topology::node_id_t, uitsl::thread_id_t>
+> GenerateMetisAssignments (
+  const size_t num_procs,
+  const size_t threads_per_proc,
+  const netuit::Topology& topology,
+  const netuit::MetisWeights& weights={}
+) {
+  return GenerateMetisAssignments(
+    emp::vector<size_t>( num_procs, threads_per_proc ), topology, weights
+  );
+}
+
+/// This function returns a pair of functors determining thread and process
+/// assignments, from a (hopefully optimal) k-way partitioning as returned by METIS.
+/// @param[in] num_procs Number of processes.
+/// @param[in] threads_per_proc Number of threads per process.
+/// @param[in] topology Topology to partition.
+/// @param[in] weights Node and edge weights, and target part size of each
+/// process.
 /// @return std::pair of process and thread assignments. *
 std::pair<
   std::function<uitsl::proc_id_t(size_t)>,
@@ -172,11 +306,12 @@ std::pair<
 > GenerateMetisAssignmentFunctors (
   const size_t num_procs,
   const size_t threads_per_proc,
-  const netuit::Topology& topology
+  const netuit::Topology& topology,
+  const netuit::MetisWeights& weights={}
 ) {
 
   const auto enumerated = netuit::GenerateMetisAssignments(
-    num_procs, threads_per_proc, topology
+    num_procs, threads_per_proc, topology, weights
   );
 
   return std::pair{
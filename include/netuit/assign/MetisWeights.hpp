@@ -0,0 +1,151 @@
+#pragma once
+#ifndef NETUIT_ASSIGN_METISWEIGHTS_HPP_INCLUDE
+#define NETUIT_ASSIGN_METISWEIGHTS_HPP_INCLUDE
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stddef.h>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include <mpi.h>
+
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../uitsl/mpi/exchange_utils.hpp"
+
+namespace netuit {
+
+/// Vertex weights, edge weights, and target part sizes to guide METIS
+/// partitioning. Empty members mean uniform weights.
+struct MetisWeights {
+
+  /// Largest weight MakeMetisWeights assigns, leaving METIS headroom to sum
+  /// weights without overflowing.
+  static constexpr int32_t max_weight = 1 << 16;
+
+  /// Compute cost of each node, indexed by node ID. Nodes past the end weigh
+  /// one.
+  emp::vector<int32_t> node_weights;
+
+  /// Traffic over each edge, keyed by edge ID. Missing edges weigh one.
+  std::unordered_map<size_t, int32_t> edge_weights;
+
+  /// Relative target size of each part, e.g., core count of each proc.
+  /// Need not sum to one.
+  emp::vector<double> part_weights;
+
+  int32_t GetNodeWeight(const size_t node_id) const {
+    return node_id < node_weights.size() ? node_weights[node_id] : 1;
+  }
+
+  int32_t GetEdgeWeight(const size_t edge_id) const {
+    const auto it = edge_weights.find( edge_id );
+    return it != edge_weights.end() ? it->second : 1;
+  }
+
+};
+
+namespace internal {
+
+template<typename Key, typename Value>
+std::unordered_map<Key, int32_t> scale_metis_weights(
+  const std::unordered_map<Key, Value>& raw
+) {
+  double max_raw{};
+  for (const auto& [key, value] : raw) {
+    max_raw = std::max( max_raw, static_cast<double>(value) );
+  }
+
+  // METIS rejects zero weights, so every weight is at least one
+  std::unordered_map<Key, int32_t> res;
+  for (const auto& [key, value] : raw) {
+    res[key] = max_raw > 0 ? std::max(
+      int32_t{1},
+      static_cast<int32_t>( std::lround(
+        value / max_raw * MetisWeights::max_weight
+      ) )
+    ) : 1;
+  }
+  return res;
+}
+
+// sum counts keyed by ID over every proc in comm
+inline std::unordered_map<size_t, size_t> allreduce_counts(
+  const std::unordered_map<size_t, size_t>& local,
+  const MPI_Comm& comm
+) {
+  std::string buffer;
+  for (const auto& [id, count] : local) {
+    uitsl::pack_bytes( buffer, id );
+    uitsl::pack_bytes( buffer, count );
+  }
+
+  std::unordered_map<size_t, size_t> res;
+  for (const auto& gathered : uitsl::allgather_bytes( buffer, comm )) {
+    std::string_view view{ gathered };
+    while ( view.size() ) {
+      const auto id = uitsl::unpack_bytes<size_t>( view );
+      res[id] += uitsl::unpack_bytes<size_t>( view );
+    }
+  }
+  return res;
+}
+
+} // namespace internal
+
+/// Scale measured node costs and edge traffic into METIS weights, in
+/// proportion to each other.
+/// @param[in] node_costs measured cost, keyed by node ID.
+/// @param[in] edge_traffic measured traffic, keyed by edge ID.
+/// @param[in] part_weights relative target size of each part.
+/// @return weights, each between one and MetisWeights::max_weight.
+template<typename NodeCost, typename EdgeTraffic>
+MetisWeights MakeMetisWeights(
+  const std::unordered_map<size_t, NodeCost>& node_costs,
+  const std::unordered_map<size_t, EdgeTraffic>& edge_traffic,
+  emp::vector<double> part_weights={}
+) {
+  MetisWeights res;
+
+  for (const auto& [node_id, weight] : internal::scale_metis_weights(
+    node_costs
+  )) {
+    if ( node_id >= res.node_weights.size() ) {
+      res.node_weights.resize( node_id + 1, 1 );
+    }
+    res.node_weights[node_id] = weight;
+  }
+
+  res.edge_weights = internal::scale_metis_weights( edge_traffic );
+  res.part_weights = std::move( part_weights );
+
+  return res;
+}
+
+/// Take METIS weights from a previous run's instrumentation counters,
+/// summed over every proc in comm. Nodes weigh reads performed over their
+/// inputs and edges weigh net flux through their ducts. Collective.
+/// @tparam Aggregator registry aggregator of an
+/// InstrumentationAggregatingOutletWrapper, e.g., outlet_t::all.
+/// @param[in] part_weights relative target size of each part.
+/// @param[in] comm communicator to sum counters over.
+/// @return weights, each between one and MetisWeights::max_weight.
+template<typename Aggregator>
+MetisWeights MakeInstrumentedMetisWeights(
+  emp::vector<double> part_weights={},
+  const MPI_Comm& comm=MPI_COMM_WORLD
+) {
+  return netuit::MakeMetisWeights(
+    internal::allreduce_counts( Aggregator::GetNumReadsPerformedByNode(), comm ),
+    internal::allreduce_counts( Aggregator::GetNetFluxThroughDuctByEdge(), comm ),
+    std::move( part_weights )
+  );
+}
+
+} // namespace netuit
+
+#endif // #ifndef NETUIT_ASSIGN_METISWEIGHTS_HPP_INCLUDE
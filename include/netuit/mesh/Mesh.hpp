@@ -3,24 +3,39 @@
 #define NETUIT_MESH_MESH_HPP_INCLUDE
 
 #include <algorithm>
+#include <functional>
+#include <map>
 #include <ratio>
 #include <stddef.h>
+#include <string>
+#include <string_view>
+#include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
 
 #include <mpi.h>
 
 #include "../../uitsl/debug/safe_cast.hpp"
+#include "../../uitsl/meta/HasMemberFunction.hpp"
 #include "../../uitsl/math/math_utils.hpp"
+#include "../../uitsl/mpi/audited_routines.hpp"
+#include "../../uitsl/mpi/exchange_utils.hpp"
 #include "../../uitsl/mpi/mpi_init_utils.hpp"
+#include "../../uitsl/parallel/affinity_utils.hpp"
 #include "../../uitsl/parallel/thread_utils.hpp"
+#include "../../uitsl/parallel/ThreadTeam.hpp"
 #include "../../uitsl/utility/assign_utils.hpp"
 
 #include "../../uit/ducts/Duct.hpp"
+#include "../../uit/ducts/DuctMetadata.hpp"
+#include "../../uit/fixtures/Conduit.hpp"
 #include "../../uit/setup/InterProcAddress.hpp"
 #include "../../uit/spouts/wrappers/impl/RoundTripCounterAddr.hpp"
 #include "../../uit/spouts/wrappers/impl/round_trip_touch_counter.hpp"
 
 #include "../assign/AssignIntegrated.hpp"
+#include "../topology/LocalTopology.hpp"
 #include "../topology/Topology.hpp"
 
 #include "MeshNode.hpp"
@@ -30,6 +45,8 @@ namespace netuit {
 
 namespace internal {
 
+UITSL_GENERATE_HAS_MEMBER_FUNCTION( CanAddAfterInitialize );
+
 class MeshIDCounter {
 
   static inline size_t counter{};
@@ -61,9 +78,58 @@ class Mesh {
   std::function<uitsl::thread_id_t(node_id_t)> thread_assignment;
   std::function<uitsl::proc_id_t(node_id_t)> proc_assignment;
 
+  // overrides proc_assignment for nodes that have migrated
+  std::unordered_map<node_id_t, uitsl::proc_id_t> migrated_procs;
+
   using back_end_t = typename ImplSpec::ProcBackEnd;
   std::shared_ptr<back_end_t> back_end;
 
+  static constexpr bool CanAddAfterInitialize() {
+    if constexpr (
+      internal::HasMemberFunction_CanAddAfterInitialize<
+        back_end_t, bool()
+      >::value
+    ) {
+      return back_end_t::CanAddAfterInitialize();
+    } /* else */ // removed to silence no return from non-void warning
+    return false;
+  }
+
+  // assert that generated tags are unique
+  static inline std::unordered_set<int> tag_checker;
+
+  // how many times Migrate has rebuilt each edge's ducts, if ever
+  std::unordered_map<edge_id_t, size_t> edge_epochs;
+
+  // bits at the top of a tag's edge field that hold the edge's epoch
+  static constexpr size_t epoch_bits{ 2 };
+
+  uitsl::proc_id_t LookupProc(const node_id_t node_id) const {
+    const auto it = migrated_procs.find( node_id );
+    return it != std::end(migrated_procs) ? it->second : proc_assignment(
+      node_id
+    );
+  }
+
+  size_t LookupEpoch(const edge_id_t edge_id) const {
+    const auto it = edge_epochs.find( edge_id );
+    return it != std::end(edge_epochs) ? it->second : 0;
+  }
+
+  // rebuilt edges fold their epoch into the edge field, so that messages
+  // addressed to a torn down duct can't match the tag of its replacement
+  int CalcTag(const edge_id_t edge_id) const {
+    constexpr size_t edge_bits = ( sizeof(int) * 8 - 1 ) * 3 / 4;
+    constexpr size_t epoch_offset = edge_bits - epoch_bits;
+    const size_t epoch = LookupEpoch( edge_id ) % ( 1 << epoch_bits );
+    emp_assert( epoch == 0 || edge_id >> epoch_offset == 0, edge_id );
+    return uitsl::safe_cast<int>(
+      uitsl::sidebyside_hash<std::ratio<3, 4>>(
+        mesh_id, edge_id | epoch << epoch_offset
+      )
+    );
+  }
+
   void InitializeInterThreadDucts() {
     for (auto& [node_id, node] : nodes) {
       InitializeInterThreadDucts(node_id, node);
@@ -111,17 +177,14 @@ class Mesh {
     const node_id_t inlet_node_id = nodes.GetOutputRegistry().at(
       input.GetEdgeID()
     );
-    const uitsl::proc_id_t inlet_proc_id = proc_assignment(inlet_node_id);
+    const uitsl::proc_id_t inlet_proc_id = LookupProc(inlet_node_id);
 
     const node_id_t outlet_node_id = nodes.GetInputRegistry().at(
       input.GetEdgeID()
     );
-    const uitsl::proc_id_t outlet_proc_id = proc_assignment(outlet_node_id);
+    const uitsl::proc_id_t outlet_proc_id = LookupProc(outlet_node_id);
 
-    static std::unordered_set<int> tag_checker;
-    const int tag = uitsl::safe_cast<int>(
-      uitsl::sidebyside_hash<std::ratio<3, 4>>(mesh_id, input.GetEdgeID())
-    );
+    const int tag = CalcTag( input.GetEdgeID() );
 
     const uit::InterProcAddress addr{
       outlet_proc_id,
@@ -136,7 +199,6 @@ class Mesh {
       input.template SplitDuct<
         typename ImplSpec::ProcOutletDuct
       >(addr, back_end);
-      // assert that generated tags are unique
       emp_assert( tag_checker.insert(tag).second );
     }
 
@@ -146,21 +208,19 @@ class Mesh {
     const node_id_t inlet_node_id = nodes.GetOutputRegistry().at(
       output.GetEdgeID()
     );
-    const uitsl::proc_id_t inlet_proc_id = proc_assignment(inlet_node_id);
+    const uitsl::proc_id_t inlet_proc_id = LookupProc(inlet_node_id);
 
     const node_id_t outlet_node_id = nodes.GetInputRegistry().at(
       output.GetEdgeID()
     );
-    const uitsl::proc_id_t outlet_proc_id = proc_assignment(outlet_node_id);
+    const uitsl::proc_id_t outlet_proc_id = LookupProc(outlet_node_id);
 
     const uit::InterProcAddress addr{
       outlet_proc_id,
       inlet_proc_id,
       thread_assignment(outlet_node_id),
       thread_assignment(inlet_node_id),
-      uitsl::safe_cast<int>(
-        uitsl::sidebyside_hash<std::ratio<3, 4>>(mesh_id, output.GetEdgeID())
-      ),
+      CalcTag( output.GetEdgeID() ),
       comm
     };
 
@@ -170,8 +230,10 @@ class Mesh {
 
   }
 
-  // solely for instrumentation purposes
+  // solely for instrumentation purposes,
+  // skipped if built with UIT_NO_DUCT_METADATA
   void RegisterDuctTargets() {
+    if constexpr ( !uit::internal::duct_metadata_enabled ) return;
     for (auto& [node_id, node] : nodes) RegisterDuctTargets(node_id, node);
   }
 
@@ -183,13 +245,14 @@ class Mesh {
 
   // solely for instrumentation purposes
   void RegisterDuctTarget(const netuit::MeshNodeOutput<ImplSpec>& output) {
+    if constexpr ( !uit::internal::duct_metadata_enabled ) return;
     output.RegisterEdgeID( output.GetEdgeID() );
     output.RegisterMeshID( mesh_id );
     {
       const node_id_t inlet_node_id = nodes.GetOutputRegistry().at(
         output.GetEdgeID()
       );
-      const uitsl::proc_id_t inlet_proc_id = proc_assignment(inlet_node_id);
+      const uitsl::proc_id_t inlet_proc_id = LookupProc(inlet_node_id);
       const uitsl::thread_id_t inlet_thread_id = thread_assignment(
         inlet_node_id
       );
@@ -203,7 +266,7 @@ class Mesh {
       const node_id_t outlet_node_id = nodes.GetInputRegistry().at(
         output.GetEdgeID()
       );
-      const uitsl::proc_id_t outlet_proc_id = proc_assignment(outlet_node_id);
+      const uitsl::proc_id_t outlet_proc_id = LookupProc(outlet_node_id);
       const uitsl::thread_id_t outlet_thread_id = thread_assignment(
         outlet_node_id
       );
@@ -226,13 +289,14 @@ class Mesh {
 
   // solely for instrumentation purposes
   void RegisterDuctTarget(const netuit::MeshNodeInput<ImplSpec>& input) {
+    if constexpr ( !uit::internal::duct_metadata_enabled ) return;
     input.RegisterEdgeID( input.GetEdgeID() );
     input.RegisterMeshID( mesh_id );
     {
       const node_id_t inlet_node_id = nodes.GetOutputRegistry().at(
         input.GetEdgeID()
       );
-      const uitsl::proc_id_t inlet_proc_id = proc_assignment(inlet_node_id);
+      const uitsl::proc_id_t inlet_proc_id = LookupProc(inlet_node_id);
       const uitsl::thread_id_t inlet_thread_id = thread_assignment(
           inlet_node_id
       );
@@ -246,7 +310,7 @@ class Mesh {
       const node_id_t outlet_node_id = nodes.GetInputRegistry().at(
         input.GetEdgeID()
       );
-      const uitsl::proc_id_t outlet_proc_id = proc_assignment(outlet_node_id);
+      const uitsl::proc_id_t outlet_proc_id = LookupProc(outlet_node_id);
       const uitsl::thread_id_t outlet_thread_id = thread_assignment(
           outlet_node_id
       );
@@ -267,6 +331,58 @@ class Mesh {
     }
   }
 
+  // adds every edge touching node to topology
+  void AddEdges(LocalTopology& topology, const node_t& node) const {
+    for (const auto& input : node.GetInputs()) topology.AddEdge(
+      input.GetEdgeID(),
+      nodes.GetOutputRegistry().at( input.GetEdgeID() ),
+      node.GetNodeID()
+    );
+    for (const auto& output : node.GetOutputs()) topology.AddEdge(
+      output.GetEdgeID(),
+      node.GetNodeID(),
+      nodes.GetInputRegistry().at( output.GetEdgeID() )
+    );
+  }
+
+  void PackDeparture(
+    std::string& buffer,
+    const node_t& node,
+    const std::string& state
+  ) const {
+    LocalTopology topology;
+    AddEdges( topology, node );
+
+    uitsl::pack_bytes( buffer, node.GetNodeID() );
+    uitsl::pack_bytes( buffer, topology.GetEdges().size() );
+    for (const auto& edge : topology.GetEdges()) {
+      uitsl::pack_bytes( buffer, edge );
+      uitsl::pack_bytes( buffer, LookupEpoch(edge.edge_id) );
+    }
+    uitsl::pack_bytes( buffer, state.size() );
+    buffer += state;
+  }
+
+  // consumes everything received but not yet gotten on input
+  void DrainBacklog(
+    emp::vector<typename ImplSpec::T>& backlog,
+    netuit::MeshNodeInput<ImplSpec>& input
+  ) const {
+    if ( input.CanStep() ) {
+      while ( input.TryStep() ) backlog.push_back( input.Get() );
+    } else if ( input.Jump() ) backlog.assign( 1, input.Get() );
+  }
+
+  void PackBacklog(
+    std::string& buffer,
+    const edge_id_t edge_id,
+    const emp::vector<typename ImplSpec::T>& backlog
+  ) const {
+    if ( backlog.empty() ) return;
+    uitsl::pack_bytes( buffer, edge_id );
+    uitsl::pack_bytes( buffer, backlog.size() );
+    for (const auto& val : backlog) uitsl::pack_bytes( buffer, val );
+  }
 
 public:
 
@@ -279,10 +395,37 @@ public:
     std::shared_ptr<back_end_t> back_end_=std::make_shared<back_end_t>(),
     const MPI_Comm comm_=MPI_COMM_WORLD,
     const size_t mesh_id_=internal::MeshIDCounter::Generate()
+  ) : Mesh(
+    netuit::make_local_topology(
+      topology, proc_assignment_, uitsl::get_proc_id(comm_)
+    ),
+    thread_assignment_,
+    proc_assignment_,
+    back_end_,
+    comm_,
+    mesh_id_
+  ) { ; }
+
+  /**
+   * Construct from this proc's share of a topology only, so that startup
+   * cost scales with local rather than global topology size.
+   *
+   * Every proc in comm must construct its own share collectively, with
+   * matching assignment functors.
+   */
+  Mesh(
+    const LocalTopology & topology,
+    const std::function<uitsl::thread_id_t(node_id_t)> thread_assignment_
+      =uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+    const std::function<uitsl::proc_id_t(node_id_t)> proc_assignment_
+      =uitsl::AssignIntegrated<uitsl::proc_id_t>{},
+    std::shared_ptr<back_end_t> back_end_=std::make_shared<back_end_t>(),
+    const MPI_Comm comm_=MPI_COMM_WORLD,
+    const size_t mesh_id_=internal::MeshIDCounter::Generate()
   )
   : mesh_id(mesh_id_)
   , comm(comm_)
-  , nodes(topology, proc_assignment_, comm)
+  , nodes(topology)
   , thread_assignment(thread_assignment_)
   , proc_assignment(proc_assignment_)
   , back_end(back_end_) {
@@ -312,12 +455,315 @@ public:
     for (const auto& [node_id, node] : nodes) {
       if (
         thread_assignment(node_id) == tid
-        && proc_assignment(node_id) == pid
+        && LookupProc(node_id) == pid
       ) res.push_back(node);
     }
     return res;
   }
 
+  /// @return this proc's share of the topology under current assignment.
+  LocalTopology GetLocalTopology() const {
+    const uitsl::proc_id_t proc = uitsl::get_proc_id( comm );
+    LocalTopology res;
+    for (const auto& [node_id, node] : nodes) {
+      if ( LookupProc(node_id) != proc ) continue;
+      res.AddNode( node_id );
+      AddEdges( res, node );
+    }
+    res.Canonicalize();
+    return res;
+  }
+
+  MPI_Comm GetComm() const { return comm; }
+
+  /**
+   * Reallocate each inter-thread duct from a helper thread pinned to the CPU
+   * its consuming thread will run on. Under the OS's first-touch policy,
+   * duct storage then lands on the consumer's NUMA node instead of the
+   * node of the thread that constructed the mesh.
+   *
+   * Must be called before anything is put into the mesh and before
+   * GetSubmesh. Anything already in an inter-thread duct is discarded.
+   *
+   * @param cpus CPU that each thread id runs on, indexed by thread id modulo
+   * size, e.g., from uitsl::CpuTopology::GetCpuIDs.
+   */
+  void PlaceThreadDucts(const emp::vector<uitsl::cpu_id_t>& cpus) {
+    emp_assert( cpus.size() );
+    const uitsl::proc_id_t proc = uitsl::get_proc_id( comm );
+
+    std::map<uitsl::thread_id_t, emp::vector<edge_id_t>> consumed_edges;
+    for (const auto& [node_id, node] : nodes) {
+      if ( LookupProc(node_id) != proc ) continue;
+      for (const auto& input : node.GetInputs()) {
+        const node_id_t inlet_node_id = nodes.GetOutputRegistry().at(
+          input.GetEdgeID()
+        );
+        if (
+          LookupProc(inlet_node_id) == proc
+          && thread_assignment(inlet_node_id) != thread_assignment(node_id)
+        ) consumed_edges[ thread_assignment(node_id) ].push_back(
+          input.GetEdgeID()
+        );
+      }
+    }
+
+    // one helper at a time, so nodes are never modified concurrently
+    for (const auto& [thread, edges] : consumed_edges) {
+      uitsl::ThreadTeam team;
+      team.AddPinned( cpus[thread % cpus.size()], [this, &edges = edges](){
+        for (const edge_id_t edge : edges) {
+          uit::Conduit<ImplSpec> conduit{
+            std::in_place_type_t<typename ImplSpec::ThreadDuct>{}
+          };
+          nodes.ReplaceConduit( edge, conduit );
+          RegisterDuctTarget( nodes.LookupInput(edge) );
+          RegisterDuctTarget( nodes.LookupOutput(edge) );
+        }
+      } );
+      team.Join();
+    }
+  }
+
+  /**
+   * Move nodes between procs. Collective over comm.
+   *
+   * Every proc must pass the same moves. Only edges touching a moved node
+   * get new ducts, split across procs as at construction, under fresh tags.
+   * All other ducts carry on undisturbed. Before old ducts are torn down,
+   * procs exchange how many messages were put on each rebuilt edge and
+   * receivers drain until all of them have arrived. Messages not yet gotten
+   * on a rebuilt edge are then put again through its new duct, in order.
+   *
+   * Draining relies on each put accepted by a proc duct arriving as one get,
+   * which is how proc ducts count gets.
+   *
+   * Nodes previously returned by GetSubmesh must not be used afterwards.
+   * ProcBackEnd must accept new ducts after initialization, which it
+   * advertises through `CanAddAfterInitialize()`.
+   *
+   * @param moves (node id, destination proc) for each node to move.
+   * @param pack_state serializes the state of a node leaving this proc.
+   * @param unpack_state restores the state of a node arriving at this proc.
+   * @return number of drained messages this proc could not put again
+   * because their edge's new duct was full.
+   */
+  size_t Migrate(
+    const emp::vector<std::pair<node_id_t, uitsl::proc_id_t>>& moves,
+    const std::function<std::string(node_id_t)>& pack_state
+      =[](node_id_t){ return std::string{}; },
+    const std::function<void(node_id_t, const std::string&)>& unpack_state
+      =[](node_id_t, const std::string&){}
+  ) {
+    using T = typename ImplSpec::T;
+    static_assert(
+      std::is_trivially_copyable<T>::value,
+      "Migrate ships in-flight messages between procs as raw bytes"
+    );
+    static_assert(
+      CanAddAfterInitialize(),
+      "Migrate adds ducts to an already-initialized ProcBackEnd"
+    );
+
+    const uitsl::proc_id_t proc = uitsl::get_proc_id( comm );
+    const size_t num_procs = uitsl::comm_size( comm );
+
+    std::unordered_map<node_id_t, uitsl::proc_id_t> destinations;
+    for (const auto& [node_id, destination] : moves) {
+      if ( LookupProc(node_id) != destination ) {
+        destinations[node_id] = destination;
+      }
+    }
+    const auto is_moving = [&destinations](const node_id_t node_id) {
+      return destinations.count( node_id ) != 0;
+    };
+    const auto is_kept = [&is_moving](const LocalTopology::Edge& edge) {
+      return !is_moving( edge.inlet_node_id )
+        && !is_moving( edge.outlet_node_id );
+    };
+
+    // ends on this proc of edges whose ducts will be rebuilt
+    emp::vector<netuit::MeshNodeOutput<ImplSpec>*> rebuilt_outputs;
+    emp::vector<netuit::MeshNodeInput<ImplSpec>*> rebuilt_inputs;
+    for (auto& [node_id, node] : nodes) {
+      if ( LookupProc(node_id) != proc ) continue;
+      for (auto& output : node.GetOutputs()) {
+        const node_id_t receiver = nodes.GetInputRegistry().at(
+          output.GetEdgeID()
+        );
+        if ( !is_kept({output.GetEdgeID(), node_id, receiver}) ) {
+          rebuilt_outputs.push_back( &output );
+        }
+      }
+      for (auto& input : node.GetInputs()) {
+        const node_id_t sender = nodes.GetOutputRegistry().at(
+          input.GetEdgeID()
+        );
+        if ( !is_kept({input.GetEdgeID(), sender, node_id}) ) {
+          rebuilt_inputs.push_back( &input );
+        }
+      }
+    }
+
+    // tell receivers how many messages were put on each rebuilt proc duct
+    emp::vector<std::string> sent_counts( num_procs );
+    for (const auto* output : rebuilt_outputs) {
+      if ( !output->HoldsProcImpl().value_or(false) ) continue;
+      const node_id_t receiver = nodes.GetInputRegistry().at(
+        output->GetEdgeID()
+      );
+      auto& buffer = sent_counts[ LookupProc(receiver) ];
+      uitsl::pack_bytes( buffer, output->GetEdgeID() );
+      uitsl::pack_bytes( buffer, output->GetNumProcTransfers() );
+    }
+    std::unordered_map<edge_id_t, size_t> num_sent;
+    for (const auto& buffer : uitsl::exchange_bytes(sent_counts, comm)) {
+      std::string_view view{ buffer };
+      while ( view.size() ) {
+        const auto edge_id = uitsl::unpack_bytes<edge_id_t>( view );
+        num_sent[edge_id] = uitsl::unpack_bytes<size_t>( view );
+      }
+    }
+
+    // drain rebuilt edges until everything put on them has been gotten,
+    // flushing meanwhile so that buffered puts go out
+    std::unordered_map<edge_id_t, emp::vector<T>> drained;
+    for (int all_drained{}; !all_drained; ) {
+      for (auto* output : rebuilt_outputs) output->TryFlush();
+      all_drained = true;
+      for (auto* input : rebuilt_inputs) {
+        DrainBacklog( drained[input->GetEdgeID()], *input );
+        const auto it = num_sent.find( input->GetEdgeID() );
+        if ( it != std::end(num_sent) ) {
+          all_drained &= input->GetNumProcTransfers() >= it->second;
+        }
+      }
+      UITSL_Allreduce(
+        MPI_IN_PLACE, &all_drained, 1, MPI_INT, MPI_LAND, comm
+      );
+    }
+
+    // old tags are free once their ducts are drained
+    for (const auto* input : rebuilt_inputs) {
+      if ( input->HoldsProcImpl().value_or(false) ) {
+        tag_checker.erase( CalcTag(input->GetEdgeID()) );
+      }
+    }
+
+    LocalTopology topology;
+    emp::vector<std::string> departures( num_procs );
+    emp::vector<std::string> backlogs( num_procs );
+    for (auto& [node_id, node] : nodes) {
+      if ( LookupProc(node_id) != proc ) continue;
+
+      if ( is_moving(node_id) ) {
+        const uitsl::proc_id_t destination = destinations.at( node_id );
+        PackDeparture( departures[destination], node, pack_state(node_id) );
+      } else {
+        topology.AddNode( node_id );
+        AddEdges( topology, node );
+      }
+
+    }
+
+    // backlogs go to wherever their sender will be, to be put again
+    for (const auto* input : rebuilt_inputs) {
+      const node_id_t sender = nodes.GetOutputRegistry().at(
+        input->GetEdgeID()
+      );
+      PackBacklog(
+        backlogs[
+          is_moving(sender) ? destinations.at(sender) : LookupProc(sender)
+        ],
+        input->GetEdgeID(),
+        drained[ input->GetEdgeID() ]
+      );
+    }
+
+    emp::vector<std::pair<node_id_t, std::string>> arrivals;
+    for (const auto& buffer : uitsl::exchange_bytes(departures, comm)) {
+      std::string_view view{ buffer };
+      while ( view.size() ) {
+        const auto node_id = uitsl::unpack_bytes<node_id_t>( view );
+        topology.AddNode( node_id );
+
+        const auto num_edges = uitsl::unpack_bytes<size_t>( view );
+        for (size_t i{}; i < num_edges; ++i) {
+          const auto edge = uitsl::unpack_bytes<LocalTopology::Edge>( view );
+          edge_epochs[edge.edge_id] = uitsl::unpack_bytes<size_t>( view );
+          topology.AddEdge(
+            edge.edge_id, edge.inlet_node_id, edge.outlet_node_id
+          );
+        }
+
+        const auto state_size = uitsl::unpack_bytes<size_t>( view );
+        arrivals.emplace_back( node_id, view.substr(0, state_size) );
+        view.remove_prefix( state_size );
+      }
+    }
+    topology.Canonicalize();
+
+    const auto received_backlogs = uitsl::exchange_bytes( backlogs, comm );
+
+    for (const auto& [node_id, destination] : destinations) {
+      migrated_procs[node_id] = destination;
+    }
+    nodes = internal::MeshTopology<ImplSpec>( topology, nodes, is_kept );
+
+    // rebuilt edges move on to a fresh epoch, and so a fresh tag
+    std::unordered_set<edge_id_t> rebuilt_edges;
+    for (const auto& edge : topology.GetEdges()) {
+      if ( !is_kept(edge) ) rebuilt_edges.insert( edge.edge_id );
+    }
+    for (const edge_id_t edge_id : rebuilt_edges) ++edge_epochs[edge_id];
+
+    // set up ducts of rebuilt edges as at construction
+    for (auto& [node_id, node] : nodes) {
+      for (auto& input : node.GetInputs()) {
+        if ( is_kept({
+          input.GetEdgeID(),
+          nodes.GetOutputRegistry().at( input.GetEdgeID() ),
+          node_id
+        }) ) continue;
+        InitializeInterThreadDuct( input );
+        InitializeInterProcDuct( input );
+        RegisterDuctTarget( input );
+      }
+      for (auto& output : node.GetOutputs()) {
+        if ( is_kept({
+          output.GetEdgeID(),
+          node_id,
+          nodes.GetInputRegistry().at( output.GetEdgeID() )
+        }) ) continue;
+        InitializeInterProcDuct( output );
+        RegisterDuctTarget( output );
+      }
+    }
+
+    size_t num_dropped{};
+    for (const auto& buffer : received_backlogs) {
+      std::string_view view{ buffer };
+      while ( view.size() ) {
+        const auto edge_id = uitsl::unpack_bytes<edge_id_t>( view );
+        auto output = nodes.LookupOutput( edge_id );
+        const auto num_messages = uitsl::unpack_bytes<size_t>( view );
+        for (size_t i{}; i < num_messages; ++i) {
+          const T val = uitsl::unpack_bytes<T>( view );
+          // give a full duct one flush's worth of room before dropping
+          if ( output.TryPut( val ) ) continue;
+          output.TryFlush();
+          num_dropped += !output.TryPut( val );
+        }
+        output.TryFlush();
+      }
+    }
+
+    for (const auto& [node_id, state] : arrivals) unpack_state( node_id, state );
+
+    return num_dropped;
+
+  }
+
   std::string ToString() const {
     std::stringstream ss;
     for (const auto& [node_id, node] : nodes) {
@@ -325,7 +771,7 @@ public:
         "node id", node_id
       );
       ss << uitsl::format_member(
-        "proc assignment", proc_assignment(node_id)
+        "proc assignment", LookupProc(node_id)
       );
       ss << uitsl::format_member(
         "thread assignment", thread_assignment(node_id)
@@ -2,18 +2,26 @@
 #ifndef NETUIT_MESH_MESHTOPOLOGY_HPP_INCLUDE
 #define NETUIT_MESH_MESHTOPOLOGY_HPP_INCLUDE
 
-#include <map>
-#include <set>
+#include <algorithm>
+#include <functional>
+#include <iterator>
 #include <stddef.h>
+#include <type_traits>
+#include <utility>
 
 #include <mpi.h>
 
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../uitsl/datastructs/SlabAllocator.hpp"
+#include "../../uitsl/datastructs/SortedVectorMap.hpp"
 #include "../../uitsl/mpi/mpi_init_utils.hpp"
 #include "../../uitsl/utility/assign_utils.hpp"
 
 #include "../../uit/ducts/Duct.hpp"
 #include "../../uit/fixtures/Conduit.hpp"
 
+#include "../topology/LocalTopology.hpp"
 #include "../topology/Topology.hpp"
 
 #include "MeshNode.hpp"
@@ -21,124 +29,111 @@
 namespace netuit {
 namespace internal {
 
+/*
+ * Holds only this proc's nodes, plus nodes directly connected to them,
+ * and only the edges that touch this proc's nodes. All lookup structures
+ * are flat vectors sorted by ID, so memory scales with the size of this
+ * proc's share of the topology. Ducts are carved from a slab shared with
+ * topologies built from this one, so they sit together in memory.
+ */
 template<typename ImplSpec>
 class MeshTopology {
 
   using node_id_t = size_t;
   using edge_id_t = size_t;
   using node_t = MeshNode<ImplSpec>;
-  using node_lookup_t = std::map<node_id_t, node_t>;
+  using node_lookup_t = uitsl::SortedVectorMap<node_id_t, node_t>;
+  using edge_lookup_t = uitsl::SortedVectorMap<edge_id_t, node_id_t>;
+  using edge_t = netuit::LocalTopology::Edge;
 
   // node_id -> node
   node_lookup_t nodes;
 
   // ordered by edge_id
-  std::set<edge_id_t> edge_registry;
+  emp::vector<edge_id_t> edge_registry;
   // edge_id -> node_id
-  std::map<edge_id_t, node_id_t> input_registry;
-  std::map<edge_id_t, node_id_t> output_registry;
-
-  void InitializeRegistries(const netuit::Topology& topology) {
-    for (node_id_t node_id = 0; node_id < topology.GetSize(); ++node_id) {
-      const netuit::TopoNode& topo_node = topology[node_id];
-      RegisterNodeInputs(node_id, topo_node);
-      RegisterNodeOutputs(node_id, topo_node);
-    }
-  }
+  edge_lookup_t input_registry;
+  edge_lookup_t output_registry;
 
-  void RegisterNodeInputs(
-    const node_id_t node_id, const netuit::TopoNode& topo_node
-  ) {
-    for (const netuit::TopoNodeInput & input : topo_node.GetInputs()) {
-      emp_assert(input_registry.count(input.GetEdgeID()) == 0);
-      edge_registry.insert(input.GetEdgeID());
-      input_registry[input.GetEdgeID()] = node_id;
-    }
-  }
+  uitsl::SlabAllocator<uit::internal::Duct<ImplSpec>> duct_allocator;
 
-  void RegisterNodeOutputs(
-    const node_id_t node_id, const netuit::TopoNode& topo_node
-  ) {
-    for (const netuit::TopoNodeOutput& output : topo_node.GetOutputs()) {
-      emp_assert(output_registry.count(output.GetEdgeID()) == 0);
-      edge_registry.insert(output.GetEdgeID());
-      output_registry[output.GetEdgeID()] = node_id;
-    }
-  }
+  void InitializeRegistries(const netuit::LocalTopology& topology) {
+    const auto& edges = topology.GetEdges();
 
-  void InitializeNodes(
-    const netuit::Topology& topology,
-    const std::function<uitsl::proc_id_t(node_id_t)> proc_assignment,
-    const MPI_Comm& comm
-  ) {
-    // ensures that we include relevant nodes that don't have any edges
-    for (node_id_t node_id = 0; node_id < topology.GetSize(); ++node_id) {
-      if (proc_assignment(node_id) == uitsl::get_proc_id(comm)) {
-        InitializeNode(node_id);
-      }
+    edge_registry.reserve( edges.size() );
+    emp::vector<typename edge_lookup_t::value_type> inputs, outputs;
+    inputs.reserve( edges.size() );
+    outputs.reserve( edges.size() );
+
+    for (const auto& edge : edges) {
+      edge_registry.push_back( edge.edge_id );
+      inputs.emplace_back( edge.edge_id, edge.outlet_node_id );
+      outputs.emplace_back( edge.edge_id, edge.inlet_node_id );
     }
 
+    input_registry = edge_lookup_t( std::move(inputs) );
+    output_registry = edge_lookup_t( std::move(outputs) );
   }
 
-  void InitializeNode(const node_id_t node_id){
-    if (nodes.count(node_id) == 0) nodes.emplace(
-      std::piecewise_construct,
-      std::forward_as_tuple(node_id),
-      std::forward_as_tuple(node_id)
+  void InitializeNodes(const netuit::LocalTopology& topology) {
+    // own nodes, including those without any edges,
+    // and nodes connected to own nodes
+    emp::vector<node_id_t> node_ids( topology.GetNodeIDs() );
+    for (const auto& edge : topology.GetEdges()) {
+      node_ids.push_back( edge.inlet_node_id );
+      node_ids.push_back( edge.outlet_node_id );
+    }
+    std::sort( std::begin(node_ids), std::end(node_ids) );
+    node_ids.erase(
+      std::unique( std::begin(node_ids), std::end(node_ids) ),
+      std::end(node_ids)
+    );
+
+    nodes.reserve( node_ids.size() );
+    for (const node_id_t node_id : node_ids) nodes.emplace_back(
+      node_id, node_id
     );
   }
 
   void InitializeEdges(
-    const netuit::Topology& topology,
-    const std::function<uitsl::proc_id_t(node_id_t)> proc_assignment,
-    const MPI_Comm& comm
+    const MeshTopology* prev=nullptr,
+    const std::function<bool(const edge_t&)>& keep={}
   ) {
 
-    std::map<edge_id_t, uit::Conduit<ImplSpec>> edge_conduits;
+    // indexed parallel to edge_registry
+    emp::vector<uit::Conduit<ImplSpec>> edge_conduits;
+    edge_conduits.reserve( edge_registry.size() );
+    for (size_t i = 0; i < edge_registry.size(); ++i) {
+      edge_conduits.emplace_back( std::allocator_arg, duct_allocator );
+    }
+
+    const auto is_kept = [&](const edge_id_t edge) {
+      return prev && keep( edge_t{
+        edge, output_registry.at(edge), input_registry.at(edge)
+      } );
+    };
 
     // initialize inputs first...
-    for (const edge_id_t edge : edge_registry) {
-      const node_id_t input_id = input_registry.at(edge);
-      const node_id_t output_id = output_registry.at(edge);
-      // only construct infrastructure relevant to this proc
-      // (but do need nodes that are connected to nodes on this proc)
-      if (
-        proc_assignment(input_id) == uitsl::get_proc_id(comm)
-        || proc_assignment(output_id) == uitsl::get_proc_id(comm)
-      ) {
-        auto& conduit = edge_conduits[ edge ];
-
-        InitializeNode(input_id);
-        nodes.at(input_id).AddInput(
-          MeshNodeInput<ImplSpec>{conduit.GetOutlet(), edge}
-        );
-
-      }
+    for (size_t i = 0; i < edge_registry.size(); ++i) {
+      const edge_id_t edge = edge_registry[i];
+      nodes.at( input_registry.at(edge) ).AddInput(
+        is_kept(edge)
+        ? prev->LookupInput(edge)
+        : MeshNodeInput<ImplSpec>{edge_conduits[i].GetOutlet(), edge}
+      );
     }
 
     // then initialize outputs in reverse order
     // so that in cases where connections are reciporical
     // when a node's inputs and outputs zip together,
     // each (input, output) pair are associated with the same partner node
-    for (
-      auto it = std::rbegin(edge_registry); it != std::rend(edge_registry); ++it
-    ) {
-      const edge_id_t edge = *it;
-      const node_id_t input_id = input_registry.at(edge);
-      const node_id_t output_id = output_registry.at(edge);
-      // only construct infrastructure relevant to this proc
-      // (but do need nodes that are connected to nodes on this proc)
-      if (
-        proc_assignment(input_id) == uitsl::get_proc_id(comm)
-        || proc_assignment(output_id) == uitsl::get_proc_id(comm)
-      ) {
-        auto& conduit = edge_conduits.at( edge );
-
-        InitializeNode(output_id);
-        nodes.at(output_id).AddOutput(
-          MeshNodeOutput<ImplSpec>{conduit.GetInlet(), edge}
-        );
-      }
+    for (size_t i = edge_registry.size(); i--;) {
+      const edge_id_t edge = edge_registry[i];
+      nodes.at( output_registry.at(edge) ).AddOutput(
+        is_kept(edge)
+        ? prev->LookupOutput(edge)
+        : MeshNodeOutput<ImplSpec>{edge_conduits[i].GetInlet(), edge}
+      );
     }
 
   }
@@ -147,43 +142,47 @@ public:
 
   using value_type = typename node_lookup_t::value_type;
 
+  /*
+   * Build from this proc's share of a topology, without reference to the
+   * rest of it.
+   */
+  explicit MeshTopology(const netuit::LocalTopology& topology) {
+    emp_assert( std::is_sorted(
+      std::begin( topology.GetEdges() ), std::end( topology.GetEdges() )
+    ), "LocalTopology must be canonicalized" );
+
+    InitializeRegistries(topology);
+    InitializeNodes(topology);
+    InitializeEdges();
+  }
+
+  /*
+   * Build from this proc's new share of a topology after nodes migrate
+   * between procs. Edges that keep selects share their ports, and so their
+   * ducts, with prev. All other edges get fresh ports.
+   */
+  MeshTopology(
+    const netuit::LocalTopology& topology,
+    const MeshTopology& prev,
+    const std::function<bool(const edge_t&)>& keep
+  ) : duct_allocator( prev.duct_allocator ) {
+    emp_assert( std::is_sorted(
+      std::begin( topology.GetEdges() ), std::end( topology.GetEdges() )
+    ), "LocalTopology must be canonicalized" );
+
+    InitializeRegistries(topology);
+    InitializeNodes(topology);
+    InitializeEdges(&prev, keep);
+  }
+
   explicit MeshTopology(
     const netuit::Topology & topology,
     const std::function<uitsl::proc_id_t(node_id_t)> proc_assignment
       =uitsl::AssignIntegrated<uitsl::proc_id_t>{},
     const MPI_Comm comm=MPI_COMM_WORLD
-  ) {
-    InitializeRegistries(topology);
-    InitializeNodes(topology, proc_assignment, comm);
-    InitializeEdges(topology, proc_assignment, comm);
-
-    // ensure that input, output registries have same keys as edge registry
-    emp_assert(
-      edge_registry == [this](){
-        std::set<edge_id_t> res;
-        std::transform(
-          std::begin(input_registry),
-          std::end(input_registry),
-          std::inserter(res, std::begin(res)),
-          [](const auto & kv){ return kv.first; }
-        );
-        return res;
-      }()
-    );
-    emp_assert(
-      edge_registry == [this](){
-        std::set<edge_id_t> res;
-        std::transform(
-          std::begin(output_registry),
-          std::end(output_registry),
-          std::inserter(res, std::begin(res)),
-          [](const auto & kv){ return kv.first; }
-        );
-        return res;
-      }()
-    );
-
-  }
+  ) : MeshTopology( netuit::make_local_topology(
+    topology, proc_assignment, uitsl::get_proc_id(comm)
+  ) ) { ; }
 
   size_t GetNodeCount() const { return nodes.size(); }
 
@@ -201,14 +200,57 @@ public:
     return std::end(nodes);
   }
 
-  const std::set<edge_id_t>& GetEdgeRegistry() const { return edge_registry; }
+  const emp::vector<edge_id_t>& GetEdgeRegistry() const {
+    return edge_registry;
+  }
+
+  const edge_lookup_t& GetInputRegistry() const { return input_registry; }
+
+  const edge_lookup_t& GetOutputRegistry() const { return output_registry; }
+
+  const MeshNodeInput<ImplSpec>& LookupInput(const edge_id_t edge) const {
+    const auto& inputs = nodes.at( input_registry.at(edge) ).GetInputs();
+    const auto it = std::find_if(
+      std::begin(inputs), std::end(inputs),
+      [edge](const auto& input){ return input.GetEdgeID() == edge; }
+    );
+    emp_assert( it != std::end(inputs) );
+    return *it;
+  }
 
-  const std::map<edge_id_t, node_id_t>& GetInputRegistry() const {
-    return input_registry;
+  const MeshNodeOutput<ImplSpec>& LookupOutput(const edge_id_t edge) const {
+    const auto& outputs = nodes.at( output_registry.at(edge) ).GetOutputs();
+    const auto it = std::find_if(
+      std::begin(outputs), std::end(outputs),
+      [edge](const auto& output){ return output.GetEdgeID() == edge; }
+    );
+    emp_assert( it != std::end(outputs) );
+    return *it;
   }
 
-  const std::map<edge_id_t, node_id_t>& GetOutputRegistry() const {
-    return output_registry;
+  /*
+   * Point both ports of edge at conduit's duct. Ports register their own
+   * address with instrumentation and so can't be assigned, so each port
+   * vector is rebuilt around the replacement.
+   */
+  void ReplaceConduit(const edge_id_t edge, uit::Conduit<ImplSpec>& conduit) {
+    const auto rebuild = [edge](auto& ports, const auto& replacement){
+      std::decay_t<decltype(ports)> res;
+      res.reserve( ports.size() );
+      for (const auto& port : ports) res.push_back(
+        port.GetEdgeID() == edge ? replacement : port
+      );
+      ports = std::move( res );
+    };
+
+    rebuild(
+      nodes.at( input_registry.at(edge) ).GetInputs(),
+      MeshNodeInput<ImplSpec>{ conduit.GetOutlet(), edge }
+    );
+    rebuild(
+      nodes.at( output_registry.at(edge) ).GetOutputs(),
+      MeshNodeOutput<ImplSpec>{ conduit.GetInlet(), edge }
+    );
   }
 
 
@@ -220,8 +262,6 @@ public:
       ss << "node " << node.ToString() << '\n';
     }
 
-    // std::set<edge_id_t> edge_registry;
-
     // edge_id -> node_id
     ss << "input_registry " << '\n';
     for ( const auto& [edge_id, node_id] : input_registry ) {
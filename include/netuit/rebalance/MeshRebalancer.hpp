@@ -0,0 +1,154 @@
+#pragma once
+#ifndef NETUIT_REBALANCE_MESHREBALANCER_HPP_INCLUDE
+#define NETUIT_REBALANCE_MESHREBALANCER_HPP_INCLUDE
+
+#include <functional>
+#include <limits>
+#include <stddef.h>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../uitsl/mpi/comm_utils.hpp"
+#include "../../uitsl/mpi/exchange_utils.hpp"
+
+#include "../mesh/Mesh.hpp"
+
+#include "PlanMigrations.hpp"
+
+namespace netuit {
+
+/**
+ * Rebalances a `netuit::Mesh` across procs at runtime, from measured
+ * per-node compute cost and per-edge traffic.
+ *
+ * Each call to `Rebalance` gathers loads from every proc, plans moves with
+ * `netuit::PlanMigrations`, then moves nodes with `Mesh::Migrate`. Only
+ * ducts of edges touching moved nodes are rebuilt.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class MeshRebalancer {
+
+public:
+
+  using node_id_t = size_t;
+  using edge_id_t = size_t;
+
+  using node_cost_t = std::function<double(node_id_t)>;
+  using edge_traffic_t = std::function<double(edge_id_t)>;
+
+  using pack_state_t = std::function<std::string(node_id_t)>;
+  using unpack_state_t = std::function<void(node_id_t, const std::string&)>;
+
+private:
+
+  netuit::Mesh<ImplSpec>& mesh;
+
+  pack_state_t pack_state{ [](node_id_t){ return std::string{}; } };
+  unpack_state_t unpack_state{ [](node_id_t, const std::string&){} };
+
+  double tolerance{ 0.1 };
+  size_t max_moves{ std::numeric_limits<size_t>::max() };
+
+  size_t num_dropped{};
+
+  template<typename Load>
+  emp::vector<Load> Gather(const emp::vector<Load>& local) const {
+    std::string buffer;
+    for (const auto& load : local) uitsl::pack_bytes( buffer, load );
+
+    emp::vector<Load> res;
+    for (const auto& gathered : uitsl::allgather_bytes(
+      buffer, mesh.GetComm()
+    )) {
+      std::string_view view{ gathered };
+      while ( view.size() ) res.push_back( uitsl::unpack_bytes<Load>(view) );
+    }
+    return res;
+  }
+
+public:
+
+  explicit MeshRebalancer(netuit::Mesh<ImplSpec>& mesh_) : mesh(mesh_) { ; }
+
+  /**
+   * @param pack serializes the state of a node leaving this proc.
+   * @param unpack restores the state of a node arriving at this proc.
+   */
+  void SetNodeState(pack_state_t pack, unpack_state_t unpack) {
+    pack_state = std::move(pack);
+    unpack_state = std::move(unpack);
+  }
+
+  /**
+   * @param tolerance_ skip moves while the gap between the busiest and
+   * idlest proc is within this fraction of mean per-proc cost.
+   * @param max_moves_ most nodes moved per call to Rebalance.
+   */
+  void SetPlanning(const double tolerance_, const size_t max_moves_) {
+    tolerance = tolerance_;
+    max_moves = max_moves_;
+  }
+
+  /**
+   * Gather loads, plan moves, and migrate nodes. Collective over the mesh's
+   * communicator.
+   *
+   * Nodes previously returned by `Mesh::GetSubmesh` must not be used
+   * afterwards.
+   *
+   * @param node_cost measured cost of each node this proc owns.
+   * @param edge_traffic measured traffic over each edge into a node this
+   * proc owns.
+   * @return number of nodes moved, across all procs.
+   */
+  size_t Rebalance(
+    const node_cost_t& node_cost,
+    const edge_traffic_t& edge_traffic=[](edge_id_t){ return 1.0; }
+  ) {
+    const uitsl::proc_id_t proc = uitsl::get_proc_id( mesh.GetComm() );
+    const auto topology = mesh.GetLocalTopology();
+
+    emp::vector<netuit::NodeLoad> node_loads;
+    for (const node_id_t node_id : topology.GetNodeIDs()) {
+      node_loads.push_back( { node_id, proc, node_cost(node_id) } );
+    }
+
+    // each edge is reported once, by the proc that owns its input end
+    emp::vector<netuit::EdgeLoad> edge_loads;
+    for (const auto& edge : topology.GetEdges()) {
+      if ( !topology.HasNode(edge.outlet_node_id) ) continue;
+      edge_loads.push_back( {
+        edge.inlet_node_id, edge.outlet_node_id, edge_traffic(edge.edge_id)
+      } );
+    }
+
+    const auto moves = netuit::PlanMigrations(
+      Gather( node_loads ),
+      Gather( edge_loads ),
+      uitsl::comm_size( mesh.GetComm() ),
+      tolerance,
+      max_moves
+    );
+    num_dropped += mesh.Migrate( moves, pack_state, unpack_state );
+
+    return moves.size();
+  }
+
+  /**
+   * @return number of drained messages this proc could not put again through
+   * their edge's rebuilt duct, over every call to `Rebalance`. See
+   * `Mesh::Migrate`.
+   */
+  size_t GetNumDropped() const { return num_dropped; }
+
+};
+
+} // namespace netuit
+
+#endif // #ifndef NETUIT_REBALANCE_MESHREBALANCER_HPP_INCLUDE
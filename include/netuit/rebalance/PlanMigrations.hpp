@@ -0,0 +1,152 @@
+#pragma once
+#ifndef NETUIT_REBALANCE_PLANMIGRATIONS_HPP_INCLUDE
+#define NETUIT_REBALANCE_PLANMIGRATIONS_HPP_INCLUDE
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <stddef.h>
+#include <unordered_map>
+#include <utility>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/optional.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../uitsl/mpi/proc_id_t.hpp"
+
+namespace netuit {
+
+/// Measured compute cost of one node.
+struct NodeLoad {
+  size_t node_id;
+  /// Proc node currently runs on.
+  uitsl::proc_id_t proc;
+  double cost;
+};
+
+/// Measured traffic over one edge.
+struct EdgeLoad {
+  /// Node that has this edge as an output.
+  size_t inlet_node_id;
+  /// Node that has this edge as an input.
+  size_t outlet_node_id;
+  double traffic;
+};
+
+/// Greedily plan node moves that even out per-proc compute cost.
+///
+/// Repeatedly moves one node from the proc with the highest total cost to
+/// the proc with the lowest, until they are within tolerance of each other.
+/// Among nodes cheap enough not to overshoot, the node that cuts the most
+/// traffic between procs moves first. Deterministic, so every proc given
+/// the same loads plans the same moves.
+///
+/// @param nodes cost of every node.
+/// @param edges traffic over every edge, each listed once.
+/// @param num_procs number of procs to balance over.
+/// @param tolerance stop once the gap between the busiest and idlest proc
+/// is within this fraction of mean per-proc cost.
+/// @param max_moves most moves to plan.
+/// @return (node id, destination proc) for each node that should move,
+/// sorted by node id.
+inline emp::vector<std::pair<size_t, uitsl::proc_id_t>> PlanMigrations(
+  const emp::vector<NodeLoad>& nodes,
+  const emp::vector<EdgeLoad>& edges,
+  const size_t num_procs,
+  const double tolerance=0.1,
+  const size_t max_moves=std::numeric_limits<size_t>::max()
+) {
+
+  // visit nodes in a fixed order regardless of how loads were gathered
+  emp::vector<size_t> order( nodes.size() );
+  std::iota( std::begin(order), std::end(order), 0 );
+  std::sort(
+    std::begin(order), std::end(order),
+    [&nodes](const size_t a, const size_t b){
+      return nodes[a].node_id < nodes[b].node_id;
+    }
+  );
+
+  std::unordered_map<size_t, size_t> indices;
+  for (size_t i{}; i < nodes.size(); ++i) indices[ nodes[i].node_id ] = i;
+
+  emp::vector<emp::vector<std::pair<size_t, double>>> neighbors(
+    nodes.size()
+  );
+  for (const auto& edge : edges) {
+    const size_t inlet = indices.at( edge.inlet_node_id );
+    const size_t outlet = indices.at( edge.outlet_node_id );
+    neighbors[inlet].emplace_back( outlet, edge.traffic );
+    neighbors[outlet].emplace_back( inlet, edge.traffic );
+  }
+
+  emp::vector<uitsl::proc_id_t> procs;
+  emp::vector<double> loads( num_procs );
+  for (const auto& node : nodes) {
+    emp_assert( static_cast<size_t>(node.proc) < num_procs );
+    procs.push_back( node.proc );
+    loads[ node.proc ] += node.cost;
+  }
+  const double mean_load = std::accumulate(
+    std::begin(loads), std::end(loads), 0.0
+  ) / num_procs;
+
+  const auto calc_traffic_to = [&](
+    const size_t node, const uitsl::proc_id_t proc
+  ){
+    double res{};
+    for (const auto& [neighbor, traffic] : neighbors[node]) {
+      if ( neighbor != node && procs[neighbor] == proc ) res += traffic;
+    }
+    return res;
+  };
+
+  for (size_t move{}; move < max_moves; ++move) {
+    const auto [idlest, busiest] = std::minmax_element(
+      std::begin(loads), std::end(loads)
+    );
+    const double gap = *busiest - *idlest;
+    if ( gap <= mean_load * tolerance ) break;
+
+    const uitsl::proc_id_t from = std::distance( std::begin(loads), busiest );
+    const uitsl::proc_id_t to = std::distance( std::begin(loads), idlest );
+
+    // moving a node costing more than half the gap would overshoot
+    emp::optional<size_t> best;
+    double best_gain{};
+    for (const size_t node : order) {
+      if ( procs[node] != from ) continue;
+      const double cost = nodes[node].cost;
+      if ( cost <= 0 || cost * 2 > gap ) continue;
+      const double gain = calc_traffic_to(node, to) - calc_traffic_to(node, from);
+      if (
+        !best.has_value()
+        || gain > best_gain
+        || (gain == best_gain && cost > nodes[*best].cost)
+      ) {
+        best = node;
+        best_gain = gain;
+      }
+    }
+    if ( !best.has_value() ) break;
+
+    loads[from] -= nodes[*best].cost;
+    loads[to] += nodes[*best].cost;
+    procs[*best] = to;
+  }
+
+  emp::vector<std::pair<size_t, uitsl::proc_id_t>> res;
+  for (const size_t node : order) {
+    if ( procs[node] != nodes[node].proc ) {
+      res.emplace_back( nodes[node].node_id, procs[node] );
+    }
+  }
+  return res;
+
+}
+
+} // namespace netuit
+
+#endif // #ifndef NETUIT_REBALANCE_PLANMIGRATIONS_HPP_INCLUDE
@@ -0,0 +1,220 @@
+#pragma once
+#ifndef NETUIT_SCHEDULE_MESHEXECUTOR_HPP_INCLUDE
+#define NETUIT_SCHEDULE_MESHEXECUTOR_HPP_INCLUDE
+
+#include <functional>
+#include <stddef.h>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../uitsl/parallel/thread_utils.hpp"
+#include "../../uitsl/parallel/WorkStealingExecutor.hpp"
+
+#include "../mesh/Mesh.hpp"
+#include "../mesh/MeshNode.hpp"
+
+namespace netuit {
+
+/**
+ * Runs an update on every node of a `netuit::Mesh` that lives on this
+ * process, in rounds, over a team of threads that balance load through
+ * `uitsl::WorkStealingExecutor`.
+ *
+ * Nodes start out on the thread the mesh assigned them to. A node whose
+ * local edges are all inter-thread may be stolen mid-round by an idle
+ * thread. Between rounds, nodes migrate toward threads that own more of
+ * their neighbors. Whenever a node changes thread, each affected local
+ * edge is re-emplaced with `ImplSpec::IntraDuct` if both its ends now share
+ * a thread and `ImplSpec::ThreadDuct` otherwise.
+ *
+ * Nodes with an inter-process edge never leave their thread.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ *
+ * @note Re-emplacing a duct discards anything in flight on it. Ducts must
+ * not be frozen.
+ */
+template<typename ImplSpec>
+class MeshExecutor {
+
+public:
+
+  using node_t = netuit::MeshNode<ImplSpec>;
+
+private:
+
+  // edge with both ends on this process
+  struct LocalEdge {
+    size_t outlet_node;
+    size_t input_idx;
+    size_t inlet_node;
+
+    size_t GetNeighbor(const size_t node) const {
+      return node == outlet_node ? inlet_node : outlet_node;
+    }
+  };
+
+  emp::vector<node_t> nodes;
+  emp::vector<emp::vector<LocalEdge>> node_edges;
+
+  uitsl::WorkStealingExecutor executor;
+
+  uitsl::thread_id_t GetOwner(const size_t node) const {
+    return executor.GetOwner( node );
+  }
+
+  // not while sharing an intra-thread duct with a node that may run
+  // concurrently on its owner's thread
+  bool IsStealable(const size_t node) const {
+    for (const auto& edge : node_edges[node]) {
+      const size_t neighbor = edge.GetNeighbor( node );
+      if ( neighbor != node && GetOwner(neighbor) == GetOwner(node) ) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  size_t CountNeighborsOwnedBy(
+    const size_t node,
+    const uitsl::thread_id_t thread
+  ) const {
+    size_t res{};
+    for (const auto& edge : node_edges[node]) {
+      const size_t neighbor = edge.GetNeighbor( node );
+      res += ( neighbor != node && GetOwner(neighbor) == thread );
+    }
+    return res;
+  }
+
+  void Rewire(const size_t node) {
+    using intra_t = typename ImplSpec::IntraDuct;
+    using thread_t = typename ImplSpec::ThreadDuct;
+
+    for (const auto& edge : node_edges[node]) {
+      auto& input = nodes[edge.outlet_node].GetInput( edge.input_idx );
+      const uitsl::thread_id_t outlet_thread = GetOwner( edge.outlet_node );
+      const uitsl::thread_id_t inlet_thread = GetOwner( edge.inlet_node );
+
+      if constexpr ( !std::is_same<intra_t, thread_t>::value ) {
+        if ( outlet_thread == inlet_thread ) {
+          if ( !input.HoldsIntraImpl().value_or(false) ) {
+            input.template EmplaceDuct<intra_t>();
+          }
+        } else if ( !input.HoldsThreadImpl().value_or(false) ) {
+          input.template EmplaceDuct<thread_t>();
+        }
+      }
+
+      input.RegisterOutletThread( outlet_thread );
+      input.RegisterInletThread( inlet_thread );
+    }
+  }
+
+public:
+
+  /**
+   * @param mesh mesh whose nodes on this process to run.
+   * @param num_threads number of threads to run on, must exceed every
+   * thread id mesh assigns nodes on this process to.
+   * @param update callable run on each node once per round.
+   */
+  MeshExecutor(
+    const netuit::Mesh<ImplSpec>& mesh,
+    const size_t num_threads,
+    std::function<void(node_t&)> update
+  ) : executor( num_threads ) {
+
+    emp::vector<uitsl::thread_id_t> initial_owners;
+    for (uitsl::thread_id_t thread{}; thread < num_threads; ++thread) {
+      for (auto& node : mesh.GetSubmesh(thread)) {
+        nodes.push_back( std::move(node) );
+        initial_owners.push_back( thread );
+      }
+    }
+
+    // match up both ends of each edge
+    std::unordered_map<size_t, std::pair<size_t, size_t>> input_ends;
+    std::unordered_map<size_t, size_t> output_ends;
+    for (size_t node{}; node < nodes.size(); ++node) {
+      for (size_t i{}; i < nodes[node].GetNumInputs(); ++i) {
+        input_ends[ nodes[node].GetInput(i).GetEdgeID() ] = {node, i};
+      }
+      for (const auto& output : nodes[node].GetOutputs()) {
+        output_ends[ output.GetEdgeID() ] = node;
+      }
+    }
+
+    node_edges.resize( nodes.size() );
+    emp::vector<bool> pinned( nodes.size() );
+    for (const auto& [edge_id, input_end] : input_ends) {
+      const auto& [outlet_node, input_idx] = input_end;
+      const auto it = output_ends.find( edge_id );
+      if ( it != output_ends.end() ) {
+        const LocalEdge edge{ outlet_node, input_idx, it->second };
+        node_edges[outlet_node].push_back( edge );
+        if ( edge.inlet_node != outlet_node ) {
+          node_edges[edge.inlet_node].push_back( edge );
+        }
+      } else pinned[outlet_node] = true;
+    }
+    for (const auto& [edge_id, inlet_node] : output_ends) {
+      if ( !input_ends.count(edge_id) ) pinned[inlet_node] = true;
+    }
+
+    for (size_t node{}; node < nodes.size(); ++node) {
+      executor.AddTask(
+        [this, node, update](){ update( nodes[node] ); },
+        initial_owners[node],
+        pinned[node]
+      );
+    }
+
+    executor.SetStealable( [this](const size_t node){
+      return IsStealable( node );
+    } );
+    executor.SetAffinity( [this](
+      const size_t node, const uitsl::thread_id_t thread
+    ){ return CountNeighborsOwnedBy( node, thread ); } );
+    executor.SetOnMigrate( [this](
+      const size_t node, uitsl::thread_id_t, uitsl::thread_id_t
+    ){ Rewire( node ); } );
+
+  }
+
+  // tasks refer back to this executor
+  MeshExecutor(const MeshExecutor&) = delete;
+  MeshExecutor(MeshExecutor&&) = delete;
+
+  /**
+   * Run update on every node num_rounds times, with all nodes finishing
+   * each round before any node starts the next.
+   *
+   * @param num_rounds number of rounds to run.
+   */
+  void Run(const size_t num_rounds) { executor.Run( num_rounds ); }
+
+  size_t GetNumNodes() const { return nodes.size(); }
+
+  node_t& GetNode(const size_t node) { return nodes[node]; }
+
+  const node_t& GetNode(const size_t node) const { return nodes[node]; }
+
+  /// Which thread does node currently run on?
+  uitsl::thread_id_t GetThread(const size_t node) const {
+    return GetOwner( node );
+  }
+
+  uitsl::WorkStealingExecutor& GetExecutor() { return executor; }
+
+  const uitsl::WorkStealingExecutor& GetExecutor() const { return executor; }
+
+};
+
+} // namespace netuit
+
+#endif // #ifndef NETUIT_SCHEDULE_MESHEXECUTOR_HPP_INCLUDE
@@ -0,0 +1,316 @@
+#pragma once
+#ifndef NETUIT_SCHEDULE_NODESCHEDULER_HPP_INCLUDE
+#define NETUIT_SCHEDULE_NODESCHEDULER_HPP_INCLUDE
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stddef.h>
+#include <unordered_set>
+#include <utility>
+
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+#include "../../../third-party/Empirical/third-party/robin-hood-hashing/src/include/robin_hood.h"
+
+#include "../../uit/setup/defaults.hpp"
+#include "../../uitsl/meta/HasMemberFunction.hpp"
+#include "../../uitsl/parallel/ReadinessHub.hpp"
+
+namespace netuit {
+
+namespace internal {
+
+UITSL_GENERATE_HAS_MEMBER_FUNCTION( GetReadyKey );
+UITSL_GENERATE_HAS_MEMBER_FUNCTION( TryResumePut );
+
+} // namespace internal
+
+/**
+ * Cooperative, single-threaded scheduler that resumes node logic only when
+ * a duct it awaits is ready.
+ *
+ * Node logic is written as continuations. `AwaitNext` resumes a
+ * continuation with an outlet's next value once one arrives, `AwaitPut`
+ * resumes a continuation once an inlet accepts a value, and `AwaitAnyInput`
+ * resumes a continuation once any input of a node has a next value. To
+ * keep waiting, a continuation arms another await.
+ *
+ * Each sweep polls only ready awaits, one nonblocking duct operation apiece,
+ * so nodes with nothing armed cost nothing. An await is ready when it was
+ * just armed, when a duct it waits on has been published to since it was
+ * last polled, or when some duct it waits on can't publish. Awaits that
+ * fail on ducts that can publish sleep until one of them does.
+ *
+ * Ducts publish through `uitsl::ReadinessHub` when their `ImplSpec` uses a
+ * `uitsl::ReadinessWait` wait strategy and their active implementation
+ * notifies, e.g., `uit::a::SerialPendingDuct`. Inter-process ducts never
+ * publish, so awaits on them are polled every sweep.
+ *
+ * A continuation runs at most once per await and awaits armed during a
+ * sweep are first polled on the next sweep.
+ *
+ * @tparam WaitStrategy how `Run` waits between sweeps that resume nothing.
+ *
+ * @note Outlets, inlets, and nodes passed to an await must outlive it.
+ */
+template<typename WaitStrategy=uit::DefaultWaitStrategy>
+class NodeScheduler {
+
+  // returns whether await was satisfied and its continuation resumed
+  using await_t = std::function<bool()>;
+
+  struct Await {
+    await_t attempt;
+
+    // ready keys of awaited ducts, empty if any awaited duct can't publish
+    emp::vector<const void*> keys;
+
+    // sleeping until a publish on one of keys?
+    bool parked{ false };
+  };
+  using await_ptr_t = std::shared_ptr<Await>;
+
+  // polled next sweep
+  emp::vector<await_ptr_t> ready;
+
+  // reused between sweeps to avoid reallocating
+  emp::vector<await_ptr_t> sweeping;
+  emp::vector<const void*> woken_keys;
+
+  // parked awaits, by key they sleep on
+  // entries for awaits that have since been woken through another key are
+  // pruned lazily
+  robin_hood::unordered_flat_map<
+    const void*, emp::vector<await_ptr_t>
+  > parked;
+
+  // keys with a subscription outstanding or posted but not yet drained
+  std::unordered_set<const void*> subscribed;
+
+  // collects keys published to since subscribing
+  uitsl::ReadinessHub::Inbox inbox;
+
+  size_t num_armed{};
+  size_t num_parked{};
+  size_t num_resumed{};
+
+  // ready key of spout, or nullptr if it can't publish
+  template<typename Spout>
+  static const void* GetReadyKey(const Spout& spout) {
+    if constexpr (
+      internal::HasMemberFunction_GetReadyKey<Spout, const void*()>::value
+    ) return spout.GetReadyKey();
+    else return nullptr;
+  }
+
+  void Arm(await_t&& attempt, emp::vector<const void*>&& keys) {
+    // an await that can't be woken by one of its ducts must be polled
+    if ( std::count( std::begin( keys ), std::end( keys ), nullptr ) ) {
+      keys.clear();
+    }
+    ready.push_back( std::make_shared<Await>(
+      Await{ std::move(attempt), std::move(keys) }
+    ) );
+    ++num_armed;
+  }
+
+  // subscribe before polling, so a publish racing the poll isn't lost
+  void Subscribe(const Await& await) {
+    for (const auto key : await.keys) {
+      if ( subscribed.insert( key ).second ) {
+        uitsl::ReadinessHub::Subscribe( key, inbox );
+      }
+    }
+  }
+
+  void Park(const await_ptr_t& await) {
+    for (const auto key : await->keys) {
+      auto& sleepers = parked[key];
+      // prune stale entries, including this await's own from earlier parks
+      sleepers.erase(
+        std::remove_if(
+          std::begin( sleepers ), std::end( sleepers ),
+          [](const auto& sleeper){ return !sleeper->parked; }
+        ),
+        std::end( sleepers )
+      );
+      sleepers.push_back( await );
+    }
+    await->parked = true;
+    ++num_parked;
+  }
+
+  void Wake(const void* key) {
+    subscribed.erase( key );
+    const auto it = parked.find( key );
+    if ( it == std::end( parked ) ) return;
+    for (auto& sleeper : it->second) {
+      if ( sleeper->parked ) {
+        sleeper->parked = false;
+        --num_parked;
+        sweeping.push_back( std::move(sleeper) );
+      }
+    }
+    parked.erase( it );
+  }
+
+public:
+
+  NodeScheduler() = default;
+
+  NodeScheduler(const NodeScheduler&) = delete;
+
+  /**
+   * Resume continuation with the next value outlet steps onto.
+   *
+   * @param outlet `uit::Outlet` or `netuit::MeshNodeInput` to step.
+   * @param continuation callable taking next value by const reference.
+   */
+  template<typename Outlet, typename Continuation>
+  void AwaitNext(Outlet& outlet, Continuation&& continuation) {
+    Arm(
+      [&outlet, continuation=std::forward<Continuation>(continuation)]()
+      mutable {
+        const auto next = outlet.GetNextOrNullopt();
+        if ( !next.has_value() ) return false;
+        continuation( next->get() );
+        return true;
+      },
+      { GetReadyKey( outlet ) }
+    );
+  }
+
+  /**
+   * Resume continuation once inlet accepts val.
+   *
+   * Put is retried through `TryResumePut`, so it counts as a single
+   * blocking put in inlet's instrumentation. Inlets without `TryResumePut`
+   * are retried through `TryPut`, where each refused attempt counts as a
+   * dropped put.
+   *
+   * @param inlet `uit::Inlet` or `netuit::MeshNodeOutput` to put into.
+   * @param val value to put.
+   * @param continuation callable taking no arguments.
+   */
+  template<typename Inlet, typename T, typename Continuation>
+  void AwaitPut(Inlet& inlet, T&& val, Continuation&& continuation) {
+    using value_t = typename std::decay<T>::type;
+    Arm(
+      [
+        &inlet,
+        val=std::forward<T>(val),
+        continuation=std::forward<Continuation>(continuation),
+        is_retry=false
+      ]() mutable {
+        if constexpr (
+          internal::HasMemberFunction_TryResumePut<
+            Inlet, bool(const value_t&, bool)
+          >::value
+        ) {
+          if ( !inlet.TryResumePut( val, is_retry ) ) {
+            is_retry = true;
+            return false;
+          }
+        } else if ( !inlet.TryPut( val ) ) return false;
+        continuation();
+        return true;
+      },
+      { GetReadyKey( inlet ) }
+    );
+  }
+
+  /**
+   * Resume continuation with the next value any of node's inputs steps
+   * onto.
+   *
+   * Inputs are polled round-robin, starting after whichever input resumed
+   * this node last, so a busy input can't starve the rest.
+   *
+   * @param node `netuit::MeshNode` whose inputs to step.
+   * @param continuation callable taking index of input and next value by
+   * const reference.
+   */
+  template<typename Node, typename Continuation>
+  void AwaitAnyInput(Node& node, Continuation&& continuation) {
+    emp::vector<const void*> keys;
+    for (size_t i{}; i < node.GetNumInputs(); ++i) {
+      keys.push_back( GetReadyKey( node.GetInput(i) ) );
+    }
+    Arm(
+      [
+        &node,
+        continuation=std::forward<Continuation>(continuation),
+        start=size_t{}
+      ]() mutable {
+        const size_t num_inputs = node.GetNumInputs();
+        for (size_t i{}; i < num_inputs; ++i) {
+          const size_t idx = (start + i) % num_inputs;
+          const auto next = node.GetInput(idx).GetNextOrNullopt();
+          if ( next.has_value() ) {
+            start = idx + 1;
+            continuation( idx, next->get() );
+            return true;
+          }
+        }
+        return false;
+      },
+      std::move(keys)
+    );
+  }
+
+  /**
+   * Poll each ready await once, resuming continuations of those that are
+   * satisfied. Parked awaits are skipped until woken.
+   *
+   * @return number of continuations resumed.
+   */
+  size_t RunOnce() {
+    inbox.Drain( woken_keys );
+    for (const auto key : woken_keys) Wake( key );
+    woken_keys.clear();
+
+    sweeping.insert(
+      std::end( sweeping ),
+      std::make_move_iterator( std::begin( ready ) ),
+      std::make_move_iterator( std::end( ready ) )
+    );
+    ready.clear();
+
+    size_t num_resumed_this_sweep{};
+    for (auto& await : sweeping) {
+      Subscribe( *await );
+      if ( await->attempt() ) {
+        ++num_resumed_this_sweep;
+        --num_armed;
+      } else if ( await->keys.empty() ) ready.push_back( std::move(await) );
+      else Park( await );
+    }
+    sweeping.clear();
+
+    num_resumed += num_resumed_this_sweep;
+    return num_resumed_this_sweep;
+  }
+
+  /**
+   * Sweep until no awaits remain armed, waiting between sweeps that resume
+   * nothing.
+   */
+  void Run() {
+    while ( GetNumArmed() ) WaitStrategy::Until(
+      [this](){ return RunOnce() || GetNumArmed() == 0; }
+    );
+  }
+
+  size_t GetNumArmed() const { return num_armed; }
+
+  /// @return number of armed awaits sleeping until a duct is published to.
+  size_t GetNumParked() const { return num_parked; }
+
+  size_t GetNumResumed() const { return num_resumed; }
+
+};
+
+} // namespace netuit
+
+#endif // #ifndef NETUIT_SCHEDULE_NODESCHEDULER_HPP_INCLUDE
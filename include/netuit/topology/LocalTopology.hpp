@@ -0,0 +1,180 @@
+#pragma once
+#ifndef NETUIT_TOPOLOGY_LOCALTOPOLOGY_HPP_INCLUDE
+#define NETUIT_TOPOLOGY_LOCALTOPOLOGY_HPP_INCLUDE
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <stddef.h>
+#include <tuple>
+#include <utility>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../uitsl/mpi/proc_id_t.hpp"
+
+#include "Topology.hpp"
+
+namespace netuit {
+
+/// One proc's share of a Topology: the nodes it owns and every edge with
+/// at least one end at an owned node. Nodes at the far end of cross-proc
+/// edges are referenced only by id.
+///
+/// Build with AddNode and AddEdge, e.g., from a pre-partitioned graph or a
+/// generator that can enumerate one partition's edges directly, so that no
+/// proc ever holds the whole graph. Use make_local_topology to carve one out
+/// of an existing global Topology instead.
+class LocalTopology {
+public:
+  using node_id_t = size_t;
+  using edge_id_t = size_t;
+
+  struct Edge {
+    edge_id_t edge_id;
+    /// Node that has this edge as an output.
+    node_id_t inlet_node_id;
+    /// Node that has this edge as an input.
+    node_id_t outlet_node_id;
+
+    bool operator<(const Edge& other) const {
+      return std::tie(edge_id, inlet_node_id, outlet_node_id) < std::tie(
+        other.edge_id, other.inlet_node_id, other.outlet_node_id
+      );
+    }
+
+    bool operator==(const Edge& other) const {
+      return std::tie(edge_id, inlet_node_id, outlet_node_id) == std::tie(
+        other.edge_id, other.inlet_node_id, other.outlet_node_id
+      );
+    }
+  };
+
+private:
+  // sorted and deduplicated by Canonicalize
+  emp::vector<node_id_t> node_ids;
+  emp::vector<Edge> edges;
+
+public:
+
+  /// Register a node as owned by this proc.
+  /// @param[in] node_id ID of node to register.
+  void AddNode(const node_id_t node_id) { node_ids.push_back(node_id); }
+
+  /// Register an edge touching at least one owned node. Edges between two
+  /// owned nodes may be added once or twice.
+  /// @param[in] edge_id ID of edge.
+  /// @param[in] inlet_node_id ID of node that has this edge as an output.
+  /// @param[in] outlet_node_id ID of node that has this edge as an input.
+  void AddEdge(
+    const edge_id_t edge_id,
+    const node_id_t inlet_node_id,
+    const node_id_t outlet_node_id
+  ) { edges.push_back( {edge_id, inlet_node_id, outlet_node_id} ); }
+
+  /// Sort nodes by ID and edges by edge ID, removing duplicates.
+  void Canonicalize() {
+    std::sort( std::begin(node_ids), std::end(node_ids) );
+    node_ids.erase(
+      std::unique( std::begin(node_ids), std::end(node_ids) ),
+      std::end(node_ids)
+    );
+
+    std::sort( std::begin(edges), std::end(edges) );
+    edges.erase(
+      std::unique( std::begin(edges), std::end(edges) ),
+      std::end(edges)
+    );
+
+    // each edge must have exactly one pair of endpoints
+    emp_assert( std::adjacent_find(
+      std::begin(edges),
+      std::end(edges),
+      [](const auto& a, const auto& b){ return a.edge_id == b.edge_id; }
+    ) == std::end(edges) );
+  }
+
+  /// @return IDs of owned nodes.
+  const emp::vector<node_id_t>& GetNodeIDs() const { return node_ids; }
+
+  /// @return Edges touching owned nodes.
+  const emp::vector<Edge>& GetEdges() const { return edges; }
+
+  /// @return Whether this proc owns node_id. Requires Canonicalize.
+  bool HasNode(const node_id_t node_id) const {
+    return std::binary_search(
+      std::begin(node_ids), std::end(node_ids), node_id
+    );
+  }
+
+};
+
+/// Carve out one proc's share of a global Topology.
+/// Working memory scales with the size of the share, not of the topology.
+/// @param[in] topology Global topology.
+/// @param[in] proc_assignment Map of node IDs to procs.
+/// @param[in] proc Proc to carve out share for.
+/// @return Canonicalized local topology.
+inline LocalTopology make_local_topology(
+  const Topology& topology,
+  const std::function<uitsl::proc_id_t(size_t)>& proc_assignment,
+  const uitsl::proc_id_t proc
+) {
+
+  using edge_id_t = LocalTopology::edge_id_t;
+  using node_id_t = LocalTopology::node_id_t;
+  using record_t = std::pair<edge_id_t, node_id_t>;
+
+  LocalTopology res;
+
+  // first pass: find owned nodes and the edges they touch
+  emp::vector<record_t> local_inputs, local_outputs;
+  for (node_id_t node_id = 0; node_id < topology.GetSize(); ++node_id) {
+    if ( proc_assignment(node_id) != proc ) continue;
+    res.AddNode(node_id);
+    for (const auto& input : topology[node_id].GetInputs()) {
+      local_inputs.emplace_back( input.GetEdgeID(), node_id );
+    }
+    for (const auto& output : topology[node_id].GetOutputs()) {
+      local_outputs.emplace_back( output.GetEdgeID(), node_id );
+    }
+  }
+  std::sort( std::begin(local_inputs), std::end(local_inputs) );
+  std::sort( std::begin(local_outputs), std::end(local_outputs) );
+
+  const auto find_record = [](
+    const emp::vector<record_t>& records, const edge_id_t edge_id
+  ) {
+    const auto it = std::lower_bound(
+      std::begin(records), std::end(records), record_t{edge_id, 0}
+    );
+    return (it != std::end(records) && it->first == edge_id)
+      ? it : std::end(records);
+  };
+
+  // second pass: find the far end of each of those edges
+  for (node_id_t node_id = 0; node_id < topology.GetSize(); ++node_id) {
+    for (const auto& output : topology[node_id].GetOutputs()) {
+      const auto it = find_record( local_inputs, output.GetEdgeID() );
+      if ( it != std::end(local_inputs) ) {
+        res.AddEdge( output.GetEdgeID(), node_id, it->second );
+      }
+    }
+    for (const auto& input : topology[node_id].GetInputs()) {
+      const auto it = find_record( local_outputs, input.GetEdgeID() );
+      if ( it != std::end(local_outputs) ) {
+        res.AddEdge( input.GetEdgeID(), it->second, node_id );
+      }
+    }
+  }
+
+  res.Canonicalize();
+
+  return res;
+
+}
+
+} // namespace netuit
+
+#endif // #ifndef NETUIT_TOPOLOGY_LOCALTOPOLOGY_HPP_INCLUDE
@@ -2,6 +2,8 @@
 #ifndef UIT_DUCTS_DUCT_HPP_INCLUDE
 #define UIT_DUCTS_DUCT_HPP_INCLUDE
 
+#include <algorithm>
+#include <atomic>
 #include <stddef.h>
 #include <string>
 #include <type_traits>
@@ -11,19 +13,27 @@
 #include "../../../third-party/Empirical/include/emp/base/assert.hpp"
 #include "../../../third-party/Empirical/include/emp/base/optional.hpp"
 #include "../../../third-party/Empirical/include/emp/meta/TypePack.hpp"
+#include "../../../third-party/Empirical/include/emp/polyfill/span.hpp"
 #include "../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
 
-#include "../../uitsl/containers/safe/unordered_map.hpp"
+#include "../../uitsl/datastructs/OutOfLine.hpp"
 #include "../../uitsl/math/math_utils.hpp"
 #include "../../uitsl/meta/HasMemberFunction.hpp"
+#include "../../uitsl/meta/is_instantiation_of.hpp"
 #include "../../uitsl/mpi/mpi_init_utils.hpp"
+#include "../../uitsl/parallel/ReadinessWait.hpp"
 #include "../../uitsl/parallel/thread_utils.hpp"
 #include "../../uitsl/utility/print_utils.hpp"
 
+#include "DuctMetadata.hpp"
+
 namespace uit {
 namespace internal {
 
+UITSL_GENERATE_HAS_MEMBER_FUNCTION( CanNotify );
 UITSL_GENERATE_HAS_MEMBER_FUNCTION( CanStep );
+UITSL_GENERATE_HAS_MEMBER_FUNCTION( TryPutMany );
+UITSL_GENERATE_HAS_MEMBER_FUNCTION( TryGetMany );
 
 /**
  * Performs data transmission between an `Inlet` and an `Outlet.
@@ -83,6 +93,11 @@ UITSL_GENERATE_HAS_MEMBER_FUNCTION( CanStep );
  *    in terms of a connection topology and a mapping to assign nodes to
  *    threads and processes without having to manually construct `Conduits` and
  *    emplace necessary thread-safe and/or process-safe `Duct` implementations.
+ * @note Implementation types larger than both `IntraDuct` and `ThreadDuct`
+ *   (typically, the `ProcDuct` implementations) are held on the heap through
+ *   `uitsl::OutOfLine`, so that they don't bloat every `Duct`'s
+ *   `std::variant`. Most `Duct`s only ever hold an intra-process
+ *   implementation.
  */
 template<typename ImplSpec>
 class Duct {
@@ -94,22 +109,80 @@ class Duct {
     typename ImplSpec::ProcOutletDuct
   >::make_unique;
 
-  typename ducts_t::template apply<std::variant> impl;
+  static constexpr size_t inline_capacity = std::max(
+    sizeof(typename ImplSpec::IntraDuct), sizeof(typename ImplSpec::ThreadDuct)
+  );
+
+  /// How implementation type Impl is stored within the `std::variant`.
+  template<typename Impl>
+  using stored_t = typename std::conditional<
+    ( sizeof(Impl) > inline_capacity ),
+    uitsl::OutOfLine<Impl>,
+    Impl
+  >::type;
+
+  template<typename... Impls>
+  using stored_variant_t = std::variant<stored_t<Impls>...>;
+
+  typename ducts_t::template apply<stored_variant_t> impl;
+
+  template<typename Impl>
+  static Impl& Unwrap(Impl& stored) { return stored; }
+
+  template<typename Impl>
+  static const Impl& Unwrap(const Impl& stored) { return stored; }
+
+  template<typename Impl>
+  static Impl& Unwrap(uitsl::OutOfLine<Impl>& stored) { return *stored; }
+
+  template<typename Impl>
+  static const Impl& Unwrap(const uitsl::OutOfLine<Impl>& stored) {
+    return *stored;
+  }
+
+  /// Call visitor with the active implementation, unwrapped from storage.
+  template <typename Visitor>
+  decltype(auto) Visit(Visitor&& visitor) {
+    return std::visit(
+      [&visitor](auto& stored) -> decltype(auto) {
+        return std::forward<Visitor>(visitor)( Unwrap(stored) );
+      },
+      impl
+    );
+  }
+
+  template <typename Visitor>
+  decltype(auto) Visit(Visitor&& visitor) const {
+    return std::visit(
+      [&visitor](const auto& stored) -> decltype(auto) {
+        return std::forward<Visitor>(visitor)( Unwrap(stored) );
+      },
+      impl
+    );
+  }
+
+  template<typename Impl>
+  bool Holds() const {
+    return std::holds_alternative<stored_t<Impl>>( impl );
+  }
+
+  /// Has the active implementation been locked in place?
+  bool frozen{ false };
 
   using T = typename ImplSpec::T;
 
   bool MaybeHoldsIntraImpl() const {
-    return std::holds_alternative<typename ImplSpec::IntraDuct>( impl );
+    return Holds<typename ImplSpec::IntraDuct>();
   }
 
   bool MaybeHoldsThreadImpl() const {
-    return std::holds_alternative<typename ImplSpec::ThreadDuct>( impl );
+    return Holds<typename ImplSpec::ThreadDuct>();
   }
 
   bool MaybeHoldsProcImpl() const {
     return (
-      std::holds_alternative<typename ImplSpec::ProcInletDuct>( impl )
-      || std::holds_alternative<typename ImplSpec::ProcOutletDuct>( impl )
+      Holds<typename ImplSpec::ProcInletDuct>()
+      || Holds<typename ImplSpec::ProcOutletDuct>()
     );
   }
 
@@ -123,23 +196,18 @@ class Duct {
 
   using uid_t_ = std::uintptr_t;
 
-  using t_registry_t = uitsl::safe::unordered_map<uid_t_, uitsl::thread_id_t>;
-  inline static t_registry_t inlet_thread_registry;
-  inline static t_registry_t outlet_thread_registry;
-
-  using p_registry_t = uitsl::safe::unordered_map<uid_t_, uitsl::proc_id_t>;
-  inline static p_registry_t inlet_proc_registry;
-  inline static p_registry_t outlet_proc_registry;
-
-  using edge_id_registry_t = uitsl::safe::unordered_map<uid_t_, size_t>;
-  inline static edge_id_registry_t edge_id_registry;
+  /// Where this duct sits within a mesh, for instrumentation purposes.
+  mutable DuctMetadataHandle metadata;
 
-  using node_id_registry_t = uitsl::safe::unordered_map<uid_t_, size_t>;
-  inline static node_id_registry_t inlet_node_id_registry;
-  inline static node_id_registry_t outlet_node_id_registry;
+  /// Values put into or gotten from a proc implementation. After a split,
+  /// each end is only ever written from the one thread that uses it.
+  std::atomic<size_t> num_proc_transfers{};
 
-  using mesh_id_registry_t = uitsl::safe::unordered_map<uid_t_, size_t>;
-  inline static mesh_id_registry_t mesh_id_registry;
+  template<typename Impl>
+  static constexpr bool IsProcImpl() {
+    return std::is_same<Impl, typename ImplSpec::ProcInletDuct>::value
+      || std::is_same<Impl, typename ImplSpec::ProcOutletDuct>::value;
+  }
 
 public:
 
@@ -172,6 +240,19 @@ public:
   : impl(std::forward<Args>(args)...)
   { ; }
 
+  /**
+   * In-place constructor.
+   *
+   * Initialize the `Duct` with `WhichDuct` active, constructed from args.
+   */
+  template <typename WhichDuct, typename... Args>
+  Duct(std::in_place_type_t<WhichDuct>, Args&&... args)
+  : impl(
+    std::in_place_type_t<stored_t<WhichDuct>>{},
+    std::forward<Args>(args)...
+  )
+  { ; }
+
   /**
    * TODO.
    *
@@ -181,7 +262,79 @@ public:
    */
   template <typename WhichDuct, typename... Args>
   void EmplaceImpl(Args&&... args) {
-    impl.template emplace<WhichDuct>(std::forward<Args>(args)...);
+    emp_assert( !frozen, "cannot emplace implementation into frozen Duct" );
+    impl.template emplace<stored_t<WhichDuct>>(std::forward<Args>(args)...);
+  }
+
+  /**
+   * Lock the active implementation in place.
+   *
+   * After freezing, `EmplaceImpl` may no longer be called, so references to
+   * the active implementation obtained through `GetImpl` or `VisitImpl`
+   * remain valid for the lifetime of the `Duct`.
+   */
+  void Freeze() { frozen = true; }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  bool IsFrozen() const { return frozen; }
+
+  /**
+   * Access the active implementation directly, bypassing variant dispatch.
+   *
+   * @tparam WhichDuct implementation type, which must be active.
+   * @return reference to the active implementation.
+   */
+  template <typename WhichDuct>
+  WhichDuct& GetImpl() {
+    emp_assert( Holds<WhichDuct>() );
+    return Unwrap( *std::get_if<stored_t<WhichDuct>>( &impl ) );
+  }
+
+  /**
+   * Call visitor with a reference to the active implementation.
+   *
+   * @param visitor callable accepting a reference to any implementation type.
+   * @return result of calling visitor.
+   */
+  template <typename Visitor>
+  decltype(auto) VisitImpl(Visitor&& visitor) {
+    return Visit(std::forward<Visitor>(visitor));
+  }
+
+  /**
+   * Key for waiting on the active implementation, matching the key that
+   * implementations pass to `WaitStrategy::Notify`.
+   *
+   * @return address of the active implementation.
+   */
+  const void* GetWaitKey() const {
+    return Visit( [](const auto& arg) -> const void* { return &arg; } );
+  }
+
+  /**
+   * Key that `uitsl::ReadinessHub` is published to whenever the active
+   * implementation makes progress.
+   *
+   * @return wait key, or nullptr if the active implementation doesn't
+   * notify or `ImplSpec::WaitStrategy` isn't a `uitsl::ReadinessWait`.
+   */
+  const void* GetReadyKey() const {
+    using wait_strategy_t = typename ImplSpec::WaitStrategy;
+    if constexpr (
+      uitsl::is_instantiation_of<uitsl::ReadinessWait, wait_strategy_t>::value
+    ) return Visit(
+      [](const auto& arg) -> const void* {
+        using impl_t = typename std::decay<decltype(arg)>::type;
+        if constexpr ( HasMemberFunction_CanNotify<impl_t, bool()>::value ) {
+          if ( impl_t::CanNotify() ) return &arg;
+        }
+        return nullptr;
+      }
+    ); else return nullptr;
   }
 
   /**
@@ -191,9 +344,13 @@ public:
    * @return TODO.
    */
   bool TryPut(const T& val) {
-    return std::visit(
-      [&val](auto& arg) -> bool { return arg.TryPut(val); },
-      impl
+    return Visit(
+      [this, &val](auto& arg) -> bool {
+        using impl_t = typename std::decay<decltype(arg)>::type;
+        const bool res = arg.TryPut(val);
+        CountTransfers<impl_t>( res );
+        return res;
+      }
     );
   }
 
@@ -205,9 +362,42 @@ public:
    */
   template<typename P>
   bool TryPut(P&& val) {
-    return std::visit(
-      [&val](auto& arg) -> bool { return arg.TryPut(std::forward<P>(val)); },
-      impl
+    return Visit(
+      [this, &val](auto& arg) -> bool {
+        using impl_t = typename std::decay<decltype(arg)>::type;
+        const bool res = arg.TryPut(std::forward<P>(val));
+        CountTransfers<impl_t>( res );
+        return res;
+      }
+    );
+  }
+
+  /**
+   * Put a contiguous batch of values, in order, with a single dispatch to
+   * the active implementation.
+   *
+   * Implementations that provide a native `TryPutMany` are called directly.
+   * Otherwise, values are forwarded to `TryPut` one at a time until a put is
+   * refused.
+   *
+   * @param vals values to put.
+   * @return number of leading values from `vals` that were accepted.
+   */
+  size_t TryPutMany(const std::span<const T> vals) {
+    return Visit(
+      [this, vals](auto& arg) -> size_t {
+        using impl_t = typename std::decay<decltype(arg)>::type;
+        size_t num_put{};
+        if constexpr (
+          HasMemberFunction_TryPutMany<impl_t, size_t(std::span<const T>)>
+          ::value
+        ) num_put = arg.TryPutMany(vals);
+        else while ( num_put < vals.size() && arg.TryPut(vals[num_put]) ) {
+          ++num_put;
+        }
+        CountTransfers<impl_t>( num_put );
+        return num_put;
+      }
     );
   }
 
@@ -216,9 +406,8 @@ public:
    *
    */
   bool TryFlush() {
-    return std::visit(
-      [](auto& arg) -> bool { return arg.TryFlush(); },
-      impl
+    return Visit(
+      [](auto& arg) -> bool { return arg.TryFlush(); }
     );
   }
 
@@ -228,9 +417,8 @@ public:
    * @return TODO.
    */
   const T& Get() const {
-    return std::visit(
-      [](auto& arg) -> const T& { return arg.Get(); },
-      impl
+    return Visit(
+      [](auto& arg) -> const T& { return arg.Get(); }
     );
   }
 
@@ -240,9 +428,8 @@ public:
    * @return TODO.
    */
   T& Get() {
-    return std::visit(
-      [](auto& arg) -> T& { return arg.Get(); },
-      impl
+    return Visit(
+      [](auto& arg) -> T& { return arg.Get(); }
     );
   }
 
@@ -253,11 +440,42 @@ public:
    * @return number of gets actually consumed.
    */
   size_t TryConsumeGets(const size_t requested) {
-    return std::visit(
-      [requested](auto& arg) -> size_t {
-        return arg.TryConsumeGets(requested);
-      },
-      impl
+    return Visit(
+      [this, requested](auto& arg) -> size_t {
+        using impl_t = typename std::decay<decltype(arg)>::type;
+        const size_t num_consumed = arg.TryConsumeGets(requested);
+        CountTransfers<impl_t>( num_consumed );
+        return num_consumed;
+      }
+    );
+  }
+
+  /**
+   * Step forward through up to `out.size()` values, copying each value
+   * stepped onto into `out`, with a single dispatch to the active
+   * implementation.
+   *
+   * After a nonzero return, `Get` refers to the last value copied into `out`.
+   * Implementations that provide a native `TryGetMany` are called directly.
+   * Otherwise, `TryConsumeGets` and `Get` are called once per value.
+   *
+   * @param out destination for values stepped onto.
+   * @return number of values written to the front of `out`.
+   */
+  size_t TryGetMany(const std::span<T> out) {
+    return Visit(
+      [this, out](auto& arg) -> size_t {
+        using impl_t = typename std::decay<decltype(arg)>::type;
+        size_t num_got{};
+        if constexpr (
+          HasMemberFunction_TryGetMany<impl_t, size_t(std::span<T>)>::value
+        ) num_got = arg.TryGetMany(out);
+        else while ( num_got < out.size() && arg.TryConsumeGets(1) ) {
+          out[num_got++] = arg.Get();
+        }
+        CountTransfers<impl_t>( num_got );
+        return num_got;
+      }
     );
   }
 
@@ -267,9 +485,8 @@ public:
    * @return TODO.
    */
   std::string WhichImplIsActive() const {
-    return std::visit(
-      [](auto& arg) -> std::string { return arg.GetName(); },
-      impl
+    return Visit(
+      [](auto& arg) -> std::string { return arg.GetName(); }
     );
   }
 
@@ -326,112 +543,118 @@ public:
   uid_t GetUID() const { return reinterpret_cast<uid_t>(this); }
 
   bool CanStep() const {
-    return std::visit(
+    return Visit(
       [](const auto& arg) -> bool {
         using impl_t = typename std::decay<decltype(arg)>::type;
         if constexpr ( HasMemberFunction_CanStep<impl_t, bool()>::value ) {
           return impl_t::CanStep();
         } /* else */ // removed to silence no return from non-void warning
         return false;
-      },
-      impl
+      }
+    );
+  }
+
+  /**
+   * Record values put into or gotten from implementation Impl. Only counted
+   * for proc implementations.
+   *
+   * Called from this class's own dispatch, and by `PinnedInlet` and
+   * `PinnedOutlet`, which bypass it.
+   *
+   * @param num_transferred number of values put or gotten.
+   */
+  template<typename Impl>
+  void CountTransfers(const size_t num_transferred) {
+    if constexpr ( IsProcImpl<Impl>() ) num_proc_transfers.store(
+      num_proc_transfers.load( std::memory_order_relaxed ) + num_transferred,
+      std::memory_order_relaxed
     );
   }
 
+  /**
+   * How many values have been put into this duct's proc implementation
+   * (inlet end) or gotten from it (outlet end)?
+   *
+   * Exact, unlike `Inlet` and `Outlet` counters, which are kept per spout and
+   * may be sampled. Used by `netuit::Mesh::Migrate` to drain values still in
+   * transit before tearing a split duct down.
+   *
+   * @return number of values transferred.
+   */
+  size_t GetNumProcTransfers() const {
+    return num_proc_transfers.load( std::memory_order_relaxed );
+  }
+
   /// Optional, for instrumentaiton purposes.
   void RegisterInletProc(const uitsl::proc_id_t proc) const {
-    inlet_proc_registry[GetUID()] = proc;
+    metadata.GetOrCreate().inlet_proc.Set(proc);
   }
 
   /// Optional, for instrumentaiton purposes.
   void RegisterOutletProc(const uitsl::proc_id_t proc) const {
-    outlet_proc_registry[GetUID()] = proc;
+    metadata.GetOrCreate().outlet_proc.Set(proc);
   }
 
   /// Optional, for instrumentaiton purposes.
   void RegisterInletThread(const uitsl::thread_id_t thread) const {
-    inlet_thread_registry[GetUID()] = thread;
+    metadata.GetOrCreate().inlet_thread.Set(thread);
   }
 
   /// Optional, for instrumentaiton purposes.
   void RegisterOutletThread(const uitsl::thread_id_t thread) const {
-    outlet_thread_registry[GetUID()] = thread;
+    metadata.GetOrCreate().outlet_thread.Set(thread);
   }
 
   /// Optional, for instrumentaiton purposes.
   void RegisterEdgeID(const size_t edge_id) const {
-    edge_id_registry[GetUID()] = edge_id;
+    metadata.GetOrCreate().edge_id.Set(edge_id);
   }
 
   /// Optional, for instrumentaiton purposes.
   void RegisterInletNodeID(const size_t node_id) const {
-    inlet_node_id_registry[GetUID()] = node_id;
+    metadata.GetOrCreate().inlet_node_id.Set(node_id);
   }
 
   /// Optional, for instrumentaiton purposes.
   void RegisterOutletNodeID(const size_t node_id) const {
-    outlet_node_id_registry[GetUID()] = node_id;
+    metadata.GetOrCreate().outlet_node_id.Set(node_id);
   }
 
   /// Optional, for instrumentaiton purposes.
   void RegisterMeshID(const size_t mesh_id) const {
-    mesh_id_registry[GetUID()] = mesh_id;
+    metadata.GetOrCreate().mesh_id.Set(mesh_id);
   }
 
   emp::optional<uitsl::proc_id_t> LookupInletProc() const {
-    return inlet_proc_registry.contains( GetUID() )
-      ? emp::optional<uitsl::proc_id_t>{ inlet_proc_registry.at( GetUID() ) }
-      : std::nullopt
-    ;
+    return metadata.Get().inlet_proc.Get();
   }
 
   emp::optional<uitsl::proc_id_t> LookupOutletProc() const {
-    return outlet_proc_registry.contains( GetUID() )
-      ? emp::optional<uitsl::proc_id_t>{ outlet_proc_registry.at( GetUID() ) }
-      : std::nullopt
-    ;
+    return metadata.Get().outlet_proc.Get();
   }
 
   emp::optional<uitsl::thread_id_t> LookupInletThread() const {
-    return inlet_thread_registry.contains( GetUID() )
-      ? emp::optional<uitsl::thread_id_t>{inlet_thread_registry.at( GetUID() )}
-      : std::nullopt
-    ;
+    return metadata.Get().inlet_thread.Get();
   }
 
   emp::optional<uitsl::thread_id_t> LookupOutletThread() const {
-    return outlet_thread_registry.contains( GetUID() )
-      ? emp::optional<uitsl::thread_id_t>{outlet_thread_registry.at( GetUID() )}
-      : std::nullopt
-    ;
+    return metadata.Get().outlet_thread.Get();
   }
 
   emp::optional<size_t> LookupEdgeID() const {
-    return edge_id_registry.contains( GetUID() )
-      ? emp::optional<size_t>{edge_id_registry.at( GetUID() )}
-      : std::nullopt
-    ;
+    return metadata.Get().edge_id.Get();
   }
 
   emp::optional<size_t> LookupInletNodeID() const {
-    return inlet_node_id_registry.contains( GetUID() )
-      ? emp::optional<size_t>{inlet_node_id_registry.at(GetUID())}
-      : std::nullopt
-    ;
+    return metadata.Get().inlet_node_id.Get();
   }
 
   emp::optional<size_t> LookupOutletNodeID() const {
-    return outlet_node_id_registry.contains( GetUID() )
-      ? emp::optional<size_t>{outlet_node_id_registry.at(GetUID())}
-      : std::nullopt
-    ;
+    return metadata.Get().outlet_node_id.Get();
   }
 
   emp::optional<size_t> LookupMeshID() const {
-    return mesh_id_registry.contains( GetUID() )
-      ? emp::optional<size_t>{mesh_id_registry.at(GetUID())}
-      : std::nullopt
-    ;
+    return metadata.Get().mesh_id.Get();
   }
 
   /**
@@ -451,9 +674,8 @@ public:
     ) << '\n';
     ss << uitsl::format_member(
       "std::variant impl",
-      std::visit(
-        [](auto& arg) -> std::string { return arg.ToString(); },
-        impl
+      Visit(
+        [](auto& arg) -> std::string { return arg.ToString(); }
       )
     );
     return ss.str();
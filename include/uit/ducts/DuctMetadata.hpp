@@ -0,0 +1,174 @@
+#pragma once
+#ifndef UIT_DUCTS_DUCTMETADATA_HPP_INCLUDE
+#define UIT_DUCTS_DUCTMETADATA_HPP_INCLUDE
+
+#include <atomic>
+#include <limits>
+#include <new>
+#include <stddef.h>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/optional.hpp"
+
+#include "../../uitsl/datastructs/SlabAllocator.hpp"
+#include "../../uitsl/mpi/proc_id_t.hpp"
+#include "../../uitsl/parallel/thread_utils.hpp"
+
+namespace uit {
+namespace internal {
+
+/// Is duct metadata recorded? Define UIT_NO_DUCT_METADATA to skip recording
+/// it, e.g., in release builds without instrumentation.
+#ifdef UIT_NO_DUCT_METADATA
+  inline constexpr bool duct_metadata_enabled = false;
+#else
+  inline constexpr bool duct_metadata_enabled = true;
+#endif
+
+/**
+ * A single optional value, set once while wiring up a mesh and read from any
+ * thread afterwards without locking.
+ *
+ * The maximum representable value is reserved to mean unset. When duct
+ * metadata is disabled, holds nothing and always reads as unset.
+ *
+ * @tparam Value integral type.
+ */
+template<typename Value>
+class DuctMetadataField {
+
+  static constexpr Value unset = std::numeric_limits<Value>::max();
+
+  #ifndef UIT_NO_DUCT_METADATA
+  std::atomic<Value> value{ unset };
+  #endif
+
+public:
+
+  void Set(const Value value_) {
+    emp_assert( value_ != unset );
+    #ifndef UIT_NO_DUCT_METADATA
+    value.store( value_, std::memory_order_relaxed );
+    #endif
+  }
+
+  emp::optional<Value> Get() const {
+    #ifndef UIT_NO_DUCT_METADATA
+    const Value res = value.load( std::memory_order_relaxed );
+    if ( res != unset ) return res;
+    #endif
+    return std::nullopt;
+  }
+
+};
+
+/**
+ * Where a `Duct` sits within a mesh, for instrumentation purposes.
+ *
+ * Held out of line by each `Duct`, through a `DuctMetadataHandle`.
+ */
+struct DuctMetadata {
+
+  DuctMetadataField<uitsl::proc_id_t> inlet_proc;
+  DuctMetadataField<uitsl::proc_id_t> outlet_proc;
+
+  DuctMetadataField<uitsl::thread_id_t> inlet_thread;
+  DuctMetadataField<uitsl::thread_id_t> outlet_thread;
+
+  DuctMetadataField<size_t> edge_id;
+
+  DuctMetadataField<size_t> inlet_node_id;
+  DuctMetadataField<size_t> outlet_node_id;
+
+  DuctMetadataField<size_t> mesh_id;
+
+};
+
+/**
+ * Owns a `DuctMetadata` allocated on first registration, so ducts never
+ * placed within a mesh pay only for a pointer and allocate nothing.
+ *
+ * Metadata is carved from a slab shared by every handle, so wiring up a
+ * mesh's edges takes one system allocation per chunk of edges rather than
+ * one per edge, and their metadata sits together in memory.
+ *
+ * Safe to register into and read from concurrently. When duct metadata is
+ * disabled, holds nothing and always reads as unset.
+ */
+class DuctMetadataHandle {
+
+  #ifndef UIT_NO_DUCT_METADATA
+  std::atomic<DuctMetadata*> ptr{};
+  #endif
+
+  static DuctMetadata& GetUnset() {
+    static DuctMetadata unset;
+    return unset;
+  }
+
+  // never destroyed, so that ducts destroyed during static destruction can
+  // still hand their metadata back
+  static uitsl::Slab& GetSlab() {
+    static uitsl::Slab& slab = *new uitsl::Slab;
+    return slab;
+  }
+
+  static DuctMetadata* Allocate() {
+    return new (
+      GetSlab().Allocate( sizeof(DuctMetadata), alignof(DuctMetadata) )
+    ) DuctMetadata;
+  }
+
+  static void Deallocate(DuctMetadata* const metadata) {
+    if ( metadata == nullptr ) return;
+    metadata->~DuctMetadata();
+    GetSlab().Deallocate(
+      metadata, sizeof(DuctMetadata), alignof(DuctMetadata)
+    );
+  }
+
+public:
+
+  DuctMetadataHandle() = default;
+
+  DuctMetadataHandle(const DuctMetadataHandle&) = delete;
+
+  ~DuctMetadataHandle() {
+    #ifndef UIT_NO_DUCT_METADATA
+    Deallocate( ptr.load( std::memory_order_acquire ) );
+    #endif
+  }
+
+  /// Get metadata to register into, allocating it if need be.
+  DuctMetadata& GetOrCreate() {
+    #ifndef UIT_NO_DUCT_METADATA
+    DuctMetadata* res = ptr.load( std::memory_order_acquire );
+    if ( res != nullptr ) return *res;
+
+    // another thread may race us to allocate, in which case use theirs
+    DuctMetadata* const created = Allocate();
+    if ( ptr.compare_exchange_strong(
+      res, created, std::memory_order_acq_rel, std::memory_order_acquire
+    ) ) return *created;
+    Deallocate( created );
+    return *res;
+    #else
+    return GetUnset();
+    #endif
+  }
+
+  /// Get registered metadata, all unset if nothing has been registered.
+  const DuctMetadata& Get() const {
+    #ifndef UIT_NO_DUCT_METADATA
+    const DuctMetadata* res = ptr.load( std::memory_order_acquire );
+    if ( res != nullptr ) return *res;
+    #endif
+    return GetUnset();
+  }
+
+};
+
+} // namespace internal
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_DUCTMETADATA_HPP_INCLUDE
@@ -2,6 +2,12 @@
 #ifndef UIT_DUCTS_INTRA_PUT_DROPPING_GET_STEPPING_TYPE_ANY_A__SERIALPENDINGDUCT_HPP_INCLUDE
 #define UIT_DUCTS_INTRA_PUT_DROPPING_GET_STEPPING_TYPE_ANY_A__SERIALPENDINGDUCT_HPP_INCLUDE
 
+#include <type_traits>
+
+#include "../../../../uitsl/meta/is_instantiation_of.hpp"
+#include "../../../../uitsl/parallel/ReadinessWait.hpp"
+#include "../../../../uitsl/parallel/SpinWait.hpp"
+
 #include "impl/PendingDuct.hpp"
 
 namespace uit {
@@ -18,7 +24,15 @@ class SerialPendingDuct
 : public uit::internal::PendingDuct<
   size_t,
   typename ImplSpec::T,
-  ImplSpec
+  ImplSpec,
+  // waiters share the putter's thread, so only notify to publish readiness
+  typename std::conditional<
+    uitsl::is_instantiation_of<
+      uitsl::ReadinessWait, typename ImplSpec::WaitStrategy
+    >::value,
+    typename ImplSpec::WaitStrategy,
+    uitsl::SpinWait
+  >::type
 > {
 
   /**
@@ -2,15 +2,19 @@
 #ifndef UIT_DUCTS_INTRA_PUT_DROPPING_GET_STEPPING_TYPE_ANY_IMPL_PENDINGDUCT_HPP_INCLUDE
 #define UIT_DUCTS_INTRA_PUT_DROPPING_GET_STEPPING_TYPE_ANY_IMPL_PENDINGDUCT_HPP_INCLUDE
 
+#include <algorithm>
 #include <stddef.h>
 #include <string>
+#include <type_traits>
 
 #include "../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../third-party/Empirical/include/emp/polyfill/span.hpp"
 #include "../../../../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
 
 #include "../../../../../uitsl/debug/occupancy_audit.hpp"
 #include "../../../../../uitsl/meta/a::static_test.hpp"
 #include "../../../../../uitsl/nonce/CircularIndex.hpp"
+#include "../../../../../uitsl/parallel/SpinWait.hpp"
 #include "../../../../../uitsl/utility/print_utils.hpp"
 
 namespace uit {
@@ -21,11 +25,14 @@ namespace internal {
  *
  * @tparam ImplSpec class with static and typedef members specifying
  * implementation details for the conduit framework.
+ * @tparam WaitStrategy notified whenever a put or consume might unblock a
+ * waiting thread.
  */
 template<
   typename PendingType,
   typename BufferElementType,
-  typename ImplSpec
+  typename ImplSpec,
+  typename WaitStrategy=uitsl::SpinWait
 >
 class PendingDuct {
 
@@ -55,6 +62,7 @@ class PendingDuct {
     ++pending_gets;
     ++put_position;
     emp_assert( pending_gets <= N );
+    WaitStrategy::Notify(this);
   }
 
   template<typename P>
@@ -64,6 +72,7 @@ class PendingDuct {
     ++pending_gets;
     ++put_position;
     emp_assert( pending_gets <= N );
+    WaitStrategy::Notify(this);
   }
 
   /**
@@ -96,6 +105,25 @@ public:
     else return false;
   }
 
+  /**
+   * Put as many leading values from vals as there is room for.
+   *
+   * All accepted values are published with a single update to
+   * `pending_gets`.
+   *
+   * @param vals TODO.
+   * @return number of values accepted.
+   */
+  size_t TryPutMany(const std::span<const T> vals) {
+    uitsl_occupancy_audit(1);
+    const size_t num_put = std::min( vals.size(), N - CountUnconsumedGets() );
+    for (size_t i = 0; i < num_put; ++i) buffer[put_position++] = vals[i];
+    pending_gets += num_put;
+    emp_assert( pending_gets <= N );
+    if ( num_put ) WaitStrategy::Notify(this);
+    return num_put;
+  }
+
   /**
    * TODO.
    *
@@ -113,9 +141,28 @@ public:
     const size_t num_consumed = std::min( requested, CountUnconsumedGets() );
     get_position += num_consumed;
     pending_gets -= num_consumed;
+    if ( num_consumed ) WaitStrategy::Notify(this);
     return num_consumed;
   }
 
+  /**
+   * Step through up to out.size() values, copying each into out.
+   *
+   * All consumed values are released with a single update to
+   * `pending_gets`.
+   *
+   * @param out TODO.
+   * @return number of values copied.
+   */
+  size_t TryGetMany(const std::span<T> out) {
+    uitsl_occupancy_audit(1);
+    const size_t num_got = std::min( out.size(), CountUnconsumedGets() );
+    for (size_t i = 0; i < num_got; ++i) out[i] = buffer[++get_position];
+    pending_gets -= num_got;
+    if ( num_got ) WaitStrategy::Notify(this);
+    return num_got;
+  }
+
   /**
    * TODO.
    *
@@ -139,6 +186,11 @@ public:
 
   static constexpr bool CanStep() { return true; }
 
+  // only waiters under ImplSpec's strategy can be notified
+  static constexpr bool CanNotify() {
+    return std::is_same<WaitStrategy, typename ImplSpec::WaitStrategy>::value;
+  }
+
   /**
    * TODO.
    *
@@ -2,12 +2,14 @@
 #ifndef UIT_DUCTS_INTRA_PUT_GROWING_GET_STEPPING_TYPE_ANY_A__DEQUEDUCT_HPP_INCLUDE
 #define UIT_DUCTS_INTRA_PUT_GROWING_GET_STEPPING_TYPE_ANY_A__DEQUEDUCT_HPP_INCLUDE
 
+#include <algorithm>
 #include <deque>
 #include <stddef.h>
 #include <string>
 
 #include "../../../../../third-party/Empirical/include/emp/base/assert.hpp"
 #include "../../../../../third-party/Empirical/include/emp/base/errors.hpp"
+#include "../../../../../third-party/Empirical/include/emp/polyfill/span.hpp"
 #include "../../../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
 
 #include "../../../../uitsl/meta/a::static_test.hpp"
@@ -53,6 +55,17 @@ public:
   template<typename P>
   bool TryPut(P&& val) { queue.push_back( std::forward<P>(val) ); return true; }
 
+  /**
+   * TODO.
+   *
+   * @param vals TODO.
+   * @return number of values accepted (always all of them).
+   */
+  size_t TryPutMany(const std::span<const T> vals) {
+    queue.insert( std::end(queue), std::begin(vals), std::end(vals) );
+    return vals.size();
+  }
+
   /**
    * TODO.
    *
@@ -73,6 +86,22 @@ public:
     return num_consumed;
   }
 
+  /**
+   * TODO.
+   *
+   * @param out TODO.
+   * @return number of values copied.
+   */
+  size_t TryGetMany(const std::span<T> out) {
+    const size_t num_got = std::min( out.size(), CountUnconsumedGets() );
+    std::copy_n( std::next(std::begin(queue)), num_got, std::begin(out) );
+    queue.erase(
+      std::begin(queue),
+      std::next(std::begin(queue), num_got)
+    );
+    return num_got;
+  }
+
   /**
    * TODO.
    *
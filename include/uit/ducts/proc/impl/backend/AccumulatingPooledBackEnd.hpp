@@ -40,7 +40,8 @@ class AccumulatingPooledBackEnd {
 public:
 
   using inlet_pool_t = uit::InletMemoryAccumulatingPool<PoolSpec_t>;
-  using outlet_pool_t = uit::OutletMemoryPool<PoolSpec_t>;
+  // accumulating inlet pools always wait on every member
+  using outlet_pool_t = uit::OutletMemoryPool<PoolSpec_t, false>;
 
 private:
 
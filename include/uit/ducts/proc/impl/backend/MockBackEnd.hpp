@@ -17,6 +17,9 @@ public:
 
   void Initialize() { ; }
 
+  /// Ducts hold no back end state, so they may be added after Initialize.
+  static constexpr bool CanAddAfterInitialize() { return true; }
+
 
 };
 
@@ -0,0 +1,397 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_BACKEND_NEIGHBORHOODBACKEND_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_BACKEND_NEIGHBORHOODBACKEND_HPP_INCLUDE
+
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+#include <numeric>
+#include <stddef.h>
+#include <tuple>
+#include <utility>
+
+#include <mpi.h>
+
+#include "../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../../../../uitsl/debug/safe_cast.hpp"
+#include "../../../../../uitsl/meta/t::static_test.hpp"
+#include "../../../../../uitsl/mpi/audited_routines.hpp"
+#include "../../../../../uitsl/mpi/comm_utils.hpp"
+
+#include "../../../../setup/InterProcAddress.hpp"
+
+namespace uit {
+
+/**
+ * Moves every inter-process edge of a proc in one neighborhood collective.
+ *
+ * `Initialize` builds a distributed graph communicator whose neighbors are
+ * exactly the procs this proc shares an edge with. Each round, the values
+ * put on all edges towards a neighbor are packed contiguously and every
+ * neighbor is exchanged with in a single `MPI_Ineighbor_alltoallv`, instead
+ * of one message per edge.
+ *
+ * Meant for bulk-synchronous use, where every edge moves every step. A round
+ * goes out once every inlet on this proc has flushed, as soon as the
+ * previous round has completed. Procs with no inlets post a round whenever
+ * an outlet is polled after the previous round has completed. Rounds are
+ * collective, so a proc that stops flushing stalls its neighbors.
+ *
+ * All ducts on a proc must be driven from one thread. A round still in flight
+ * at destruction is left to complete in the background, so procs that
+ * request different numbers of rounds leak their unmatched rounds. Ducts
+ * can't be added after `Initialize`, so `netuit::Mesh::Migrate` rejects
+ * this back end at compile time.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class NeighborhoodBackEnd {
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::t::static_test<T>(), uitsl_t_message );
+
+  using address_t = uit::InterProcAddress;
+
+  // a single edge's entry in a round
+  struct Record {
+    T value;
+    bool fresh; // was a value put on the edge this round?
+  };
+
+  const MPI_Comm comm;
+
+  // neighbors only, carries rounds
+  MPI_Comm graph_comm{ MPI_COMM_NULL };
+
+  // sorted by (neighbor, address) during initialization, so that each
+  // neighbor's edges are contiguous and in the same order on both ends
+  emp::vector<address_t> inlet_addresses;
+  emp::vector<address_t> outlet_addresses;
+
+  // byte counts and displacements per neighbor
+  emp::vector<int> send_counts;
+  emp::vector<int> send_displacements;
+  emp::vector<int> receive_counts;
+  emp::vector<int> receive_displacements;
+
+  // per inlet, values put for the next round
+  emp::vector<Record> staging;
+  // per inlet, values of the round in flight
+  emp::vector<Record> sending;
+  // per outlet, values of the round in flight
+  emp::vector<Record> receiving;
+
+  // per outlet, most recent value received
+  emp::vector<T> latest;
+  // per outlet, number of values received since last consumed
+  emp::vector<size_t> num_pending;
+
+  // per inlet, flushed since the last round was requested?
+  emp::vector<char> flushed;
+  size_t num_flushed{};
+
+  bool round_requested{ false };
+  size_t num_rounds_posted{};
+
+  MPI_Request request{ MPI_REQUEST_NULL };
+
+  // rounds left in flight by destroyed back ends
+  struct Orphan {
+    MPI_Request request;
+    emp::vector<Record> sending;
+    emp::vector<Record> receiving;
+  };
+  inline static emp::vector<Orphan> orphans;
+  inline static std::mutex orphans_mutex;
+
+  static void ReapOrphans() {
+    const std::lock_guard guard{ orphans_mutex };
+    orphans.erase(
+      std::remove_if(
+        std::begin( orphans ), std::end( orphans ),
+        [](auto& orphan){
+          int flag{};
+          UITSL_Test(
+            &orphan.request, // MPI_Request *request
+            &flag, // int *flag
+            MPI_STATUS_IGNORE // MPI_Status *status
+          );
+          return flag;
+        }
+      ),
+      std::end( orphans )
+    );
+  }
+
+  static uitsl::proc_id_t InletNeighbor(const address_t& address) {
+    return address.GetOutletProc();
+  }
+
+  static uitsl::proc_id_t OutletNeighbor(const address_t& address) {
+    return address.GetInletProc();
+  }
+
+  template<typename Neighbor>
+  static bool Precedes(
+    const address_t& a, const address_t& b, const Neighbor neighbor
+  ) {
+    return std::tuple{ neighbor(a), a } < std::tuple{ neighbor(b), b };
+  }
+
+  template<typename Neighbor>
+  static size_t Lookup(
+    const emp::vector<address_t>& addresses,
+    const address_t& address,
+    const Neighbor neighbor
+  ) {
+    const auto it = std::lower_bound(
+      std::begin( addresses ), std::end( addresses ),
+      address,
+      [neighbor](const auto& a, const auto& b){
+        return Precedes( a, b, neighbor );
+      }
+    );
+    emp_assert( it != std::end( addresses ) && *it == address );
+    return std::distance( std::begin( addresses ), it );
+  }
+
+  // sort addresses and tally the bytes exchanged with each neighbor
+  template<typename Neighbor>
+  static emp::vector<int> Arrange(
+    emp::vector<address_t>& addresses,
+    emp::vector<int>& counts,
+    emp::vector<int>& displacements,
+    const Neighbor neighbor
+  ) {
+    std::sort(
+      std::begin( addresses ), std::end( addresses ),
+      [neighbor](const auto& a, const auto& b){
+        return Precedes( a, b, neighbor );
+      }
+    );
+
+    emp::vector<int> neighbors;
+    for (const auto& address : addresses) {
+      if ( neighbors.empty() || neighbors.back() != neighbor(address) ) {
+        neighbors.push_back( neighbor(address) );
+        counts.push_back( 0 );
+      }
+      counts.back() += uitsl::safe_cast<int>( sizeof(Record) );
+    }
+
+    displacements.resize( counts.size() );
+    std::exclusive_scan(
+      std::begin( counts ), std::end( counts ),
+      std::begin( displacements ),
+      0
+    );
+
+    return neighbors;
+  }
+
+  void Post() {
+    emp_assert( request == MPI_REQUEST_NULL );
+
+    std::swap( staging, sending );
+    for (auto& record : staging) record.fresh = false;
+
+    UITSL_Ineighbor_alltoallv(
+      sending.data(), // const void *sendbuf
+      send_counts.data(), // const int sendcounts[]
+      send_displacements.data(), // const int sdispls[]
+      MPI_BYTE, // MPI_Datatype sendtype
+      receiving.data(), // void *recvbuf
+      receive_counts.data(), // const int recvcounts[]
+      receive_displacements.data(), // const int rdispls[]
+      MPI_BYTE, // MPI_Datatype recvtype
+      graph_comm, // MPI_Comm comm
+      &request // MPI_Request *request
+    );
+
+    round_requested = false;
+    ++num_rounds_posted;
+  }
+
+  void Unpack() {
+    for (size_t i{}; i < receiving.size(); ++i) {
+      if ( receiving[i].fresh ) {
+        latest[i] = receiving[i].value;
+        ++num_pending[i];
+      }
+    }
+  }
+
+  // complete the round in flight, if possible, then post the next one
+  void Progress() {
+    emp_assert( IsInitialized() );
+
+    if ( request != MPI_REQUEST_NULL ) {
+      int flag{};
+      UITSL_Test(
+        &request, // MPI_Request *request
+        &flag, // int *flag
+        MPI_STATUS_IGNORE // MPI_Status *status
+      );
+      if ( !flag ) return;
+      Unpack();
+    }
+
+    if ( round_requested ) Post();
+  }
+
+  bool IsMine(const address_t& address, const uitsl::proc_id_t proc) const {
+    return address.GetComm() == comm && proc == uitsl::get_rank( comm );
+  }
+
+public:
+
+  NeighborhoodBackEnd(const MPI_Comm comm_=MPI_COMM_WORLD) : comm(comm_) { ; }
+
+  NeighborhoodBackEnd(const NeighborhoodBackEnd&) = delete;
+
+  NeighborhoodBackEnd& operator=(const NeighborhoodBackEnd&) = delete;
+
+  ~NeighborhoodBackEnd() {
+    if ( !IsInitialized() ) return;
+
+    int flag{ true };
+    if ( request != MPI_REQUEST_NULL ) UITSL_Test(
+      &request, // MPI_Request *request
+      &flag, // int *flag
+      MPI_STATUS_IGNORE // MPI_Status *status
+    );
+
+    // collective requests can't be cancelled or freed, so keep the round
+    // and its buffers around until it completes
+    if ( !flag ) {
+      const std::lock_guard guard{ orphans_mutex };
+      orphans.push_back(
+        { request, std::move(sending), std::move(receiving) }
+      );
+    }
+    ReapOrphans();
+
+    // pending operations complete normally on a freed communicator
+    UITSL_Comm_free( &graph_comm );
+  }
+
+  bool IsInitialized() const { return graph_comm != MPI_COMM_NULL; }
+
+  /// Register an inlet duct, ignored unless it belongs to this proc.
+  void RegisterInletSlot(const address_t& address) {
+    emp_assert( !IsInitialized() );
+    if ( IsMine( address, address.GetInletProc() ) ) {
+      inlet_addresses.push_back( address );
+    }
+  }
+
+  /// Register an outlet duct, ignored unless it belongs to this proc.
+  void RegisterOutletSlot(const address_t& address) {
+    emp_assert( !IsInitialized() );
+    if ( IsMine( address, address.GetOutletProc() ) ) {
+      outlet_addresses.push_back( address );
+    }
+  }
+
+  /// Build the neighborhood. Collective over comm, call after every duct has
+  /// registered.
+  void Initialize() {
+    emp_assert( !IsInitialized() );
+
+    ReapOrphans();
+
+    const auto destinations = Arrange(
+      inlet_addresses, send_counts, send_displacements, InletNeighbor
+    );
+    const auto sources = Arrange(
+      outlet_addresses, receive_counts, receive_displacements, OutletNeighbor
+    );
+
+    UITSL_Dist_graph_create_adjacent(
+      comm, // MPI_Comm comm_old
+      uitsl::safe_cast<int>( sources.size() ), // int indegree
+      sources.data(), // const int sources[]
+      MPI_UNWEIGHTED, // const int sourceweights[]
+      uitsl::safe_cast<int>( destinations.size() ), // int outdegree
+      destinations.data(), // const int destinations[]
+      MPI_UNWEIGHTED, // const int destweights[]
+      MPI_INFO_NULL, // MPI_Info info
+      0, // int reorder
+      &graph_comm // MPI_Comm *comm_dist_graph
+    );
+
+    staging.resize( inlet_addresses.size(), Record{ T{}, false } );
+    sending.resize( inlet_addresses.size(), Record{ T{}, false } );
+    flushed.resize( inlet_addresses.size() );
+    receiving.resize( outlet_addresses.size(), Record{ T{}, false } );
+    latest.resize( outlet_addresses.size() );
+    num_pending.resize( outlet_addresses.size() );
+
+    emp_assert( IsInitialized() );
+  }
+
+  /// Get index of an inlet duct's slot. This is a log-time operation so the
+  /// index should be cached by the caller.
+  size_t LookupInletSlot(const address_t& address) const {
+    emp_assert( IsInitialized() );
+    return Lookup( inlet_addresses, address, InletNeighbor );
+  }
+
+  /// Get index of an outlet duct's slot. This is a log-time operation so the
+  /// index should be cached by the caller.
+  size_t LookupOutletSlot(const address_t& address) const {
+    emp_assert( IsInitialized() );
+    return Lookup( outlet_addresses, address, OutletNeighbor );
+  }
+
+  /// Stage a value for the next round. Fails if the slot already has one.
+  bool TryPut(const T& val, const size_t slot) {
+    // a requested round may be able to go out now, clearing the slot
+    if ( staging[slot].fresh ) Progress();
+    if ( staging[slot].fresh ) return false;
+    staging[slot] = Record{ val, true };
+    return true;
+  }
+
+  /// Mark a slot ready for the next round, which is requested once every
+  /// slot is ready. Fails while a requested round is waiting to go out.
+  bool TryFlush(const size_t slot) {
+    Progress();
+    if ( round_requested ) return false;
+
+    if ( !flushed[slot] ) {
+      flushed[slot] = true;
+      ++num_flushed;
+    }
+
+    if ( num_flushed == flushed.size() ) {
+      std::fill( std::begin( flushed ), std::end( flushed ), false );
+      num_flushed = 0;
+      round_requested = true;
+      Progress();
+    }
+
+    return true;
+  }
+
+  /// Take the values received for a slot since it was last polled.
+  /// @return number of values received, of which only the latest is kept.
+  size_t TryConsumeGets(const size_t slot) {
+    if ( inlet_addresses.empty() ) round_requested = true;
+    Progress();
+    return std::exchange( num_pending[slot], 0 );
+  }
+
+  const T& Get(const size_t slot) const { return latest[slot]; }
+
+  T& Get(const size_t slot) { return latest[slot]; }
+
+};
+
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_BACKEND_NEIGHBORHOODBACKEND_HPP_INCLUDE
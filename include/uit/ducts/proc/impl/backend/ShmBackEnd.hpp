@@ -0,0 +1,179 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_BACKEND_SHMBACKEND_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_BACKEND_SHMBACKEND_HPP_INCLUDE
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <mutex>
+#include <stddef.h>
+#include <string>
+#include <unistd.h>
+
+#include <mpi.h>
+
+#include "../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../../../../../uitsl/datastructs/ShmMirroredRingBuffer.hpp"
+#include "../../../../../uitsl/mpi/audited_routines.hpp"
+
+#include "../../../../setup/InterProcAddress.hpp"
+
+namespace uit {
+
+/**
+ * Sets up one shared memory ring per inter-process edge.
+ *
+ * Ducts acquire an unmapped ring from the back end during construction.
+ * `Initialize` then maps every pending ring. MPI is used only for this
+ * handshake: the outlet proc creates the segment and sends its name to the
+ * inlet proc, which attaches and acknowledges so the outlet proc can unlink
+ * the name. Afterwards, transmission touches only shared memory.
+ *
+ * Both procs of every edge must share a node.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class ShmBackEnd {
+
+  using T = typename ImplSpec::T;
+  constexpr inline static size_t N{ImplSpec::N};
+
+public:
+
+  using ring_t = uitsl::ShmMirroredRingBuffer<T, N>;
+
+private:
+
+  using address_t = uit::InterProcAddress;
+  using name_t = std::array<char, 64>;
+
+  struct registration_t {
+    address_t address;
+    std::shared_ptr<ring_t> ring;
+  };
+
+  // rings still waiting on Initialize
+  emp::vector<registration_t> pending_outlet_rings;
+  emp::vector<registration_t> pending_inlet_rings;
+
+  std::mutex mutex;
+
+  static name_t MakeName() {
+    static size_t counter{};
+    const std::string name{
+      "/uit_shm_" + std::to_string( getpid() )
+      + "_" + std::to_string( counter++ )
+    };
+
+    name_t res{};
+    emp_assert( name.size() < res.size() );
+    std::copy( std::begin(name), std::end(name), std::begin(res) );
+    return res;
+  }
+
+  std::shared_ptr<ring_t> Register(
+    emp::vector<registration_t>& registry, const address_t& address
+  ) {
+    const std::lock_guard guard{ mutex };
+    registry.push_back( { address, std::make_shared<ring_t>() } );
+    return registry.back().ring;
+  }
+
+public:
+
+  /**
+   * Get the ring an outlet duct will pop from, mapped at `Initialize`.
+   */
+  std::shared_ptr<ring_t> AcquireOutletRing(const address_t& address) {
+    return Register( pending_outlet_rings, address );
+  }
+
+  /**
+   * Get the ring an inlet duct will push to, mapped at `Initialize`.
+   */
+  std::shared_ptr<ring_t> AcquireInletRing(const address_t& address) {
+    return Register( pending_inlet_rings, address );
+  }
+
+  void Initialize() {
+
+    const std::lock_guard guard{ mutex };
+
+    emp::vector<name_t> names( pending_outlet_rings.size() );
+    emp::vector<MPI_Request> requests( 2 * pending_outlet_rings.size() );
+
+    // outlet side: create segments and advertise their names
+    for (size_t i = 0; i < pending_outlet_rings.size(); ++i) {
+      const auto& [address, ring] = pending_outlet_rings[i];
+
+      names[i] = MakeName();
+      ring->Create( names[i].data() );
+
+      UITSL_Isend(
+        names[i].data(), // const void *buf
+        names[i].size(), // int count
+        MPI_CHAR, // MPI_Datatype datatype
+        address.GetInletProc(), // int dest
+        address.GetTag(), // int tag
+        address.GetComm(), // MPI_Comm comm
+        &requests[2 * i] // MPI_Request * request
+      );
+      UITSL_Irecv(
+        nullptr, // void *buf
+        0, // int count
+        MPI_CHAR, // MPI_Datatype datatype
+        address.GetInletProc(), // int source
+        address.GetTag(), // int tag
+        address.GetComm(), // MPI_Comm comm
+        &requests[2 * i + 1] // MPI_Request *request
+      );
+    }
+
+    // inlet side: attach to advertised segments and acknowledge
+    for (const auto& [address, ring] : pending_inlet_rings) {
+      name_t name;
+      UITSL_Recv(
+        name.data(), // void *buf
+        name.size(), // int count
+        MPI_CHAR, // MPI_Datatype datatype
+        address.GetOutletProc(), // int source
+        address.GetTag(), // int tag
+        address.GetComm(), // MPI_Comm comm
+        MPI_STATUS_IGNORE // MPI_Status *status
+      );
+
+      ring->Attach( name.data() );
+
+      UITSL_Send(
+        nullptr, // const void *buf
+        0, // int count
+        MPI_CHAR, // MPI_Datatype datatype
+        address.GetOutletProc(), // int dest
+        address.GetTag(), // int tag
+        address.GetComm() // MPI_Comm comm
+      );
+    }
+
+    UITSL_Waitall(
+      requests.size(), // int count
+      requests.data(), // MPI_Request array_of_requests[]
+      MPI_STATUSES_IGNORE // MPI_Status * array_of_statuses
+    );
+
+    // both sides are mapped, so names are no longer needed
+    for (const auto& [address, ring] : pending_outlet_rings) ring->Unlink();
+
+    pending_outlet_rings.clear();
+    pending_inlet_rings.clear();
+
+  }
+
+};
+
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_BACKEND_SHMBACKEND_HPP_INCLUDE
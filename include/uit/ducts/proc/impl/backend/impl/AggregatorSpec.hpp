@@ -2,14 +2,12 @@
 #ifndef UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_AGGREGATORSPEC_HPP_INCLUDE
 #define UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_AGGREGATORSPEC_HPP_INCLUDE
 
-#include <map>
-
-#include "../../../../../../../third-party/cereal/include/cereal/types/map.hpp"
-
 #include "../../../../../spouts/wrappers/TrivialSpoutWrapper.hpp"
 
 #include "../../../../mock/ThrowDuct.hpp"
 
+#include "FlatAggregate.hpp"
+
 namespace uit {
 
 template<
@@ -22,7 +20,7 @@ class AggregatorSpec {
 
 public:
 
-  using T = std::multimap< int, typename ImplSpec::T >;
+  using T = uit::FlatAggregate< typename ImplSpec::T >;
   template<typename Inlet>
   using inlet_wrapper_t =
     typename uit::TrivialSpoutWrapper<T>::template inlet_wrapper_t<Inlet>;
@@ -34,6 +32,10 @@ public:
   constexpr inline static size_t N{ ImplSpec::N };
   constexpr inline static size_t B{ ImplSpec::B };
 
+  using WaitStrategy = typename ImplSpec::WaitStrategy;
+  using CounterPolicy = typename ImplSpec::CounterPolicy;
+  using FlushPolicy = typename ImplSpec::FlushPolicy;
+
   using IntraDuct = uit::ThrowDuct<THIS_T>;
   using ThreadDuct = uit::ThrowDuct<THIS_T>;
 
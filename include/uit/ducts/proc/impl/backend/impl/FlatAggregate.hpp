@@ -0,0 +1,172 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_FLATAGGREGATE_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_FLATAGGREGATE_HPP_INCLUDE
+
+#include <cstdint>
+#include <cstring>
+#include <stddef.h>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../../../../../../../third-party/cereal/include/cereal/archives/binary.hpp"
+#include "../../../../../../../third-party/cereal/include/cereal/types/vector.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/io/ContiguousStream.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/io/MemoryIStream.hpp"
+
+namespace uit {
+
+/**
+ * Batch of tagged values packed back-to-back into a single contiguous arena
+ * as (tag, length, payload) records sorted by tag, or sorted by tag within
+ * each run of records spliced in from another aggregate.
+ *
+ * Appending never allocates once the arena has grown to its steady-state
+ * size, and clearing keeps capacity so the same aggregate can be refilled
+ * every flush. Trivially copyable values are copied in as raw bytes; other
+ * values are cereal-encoded record by record.
+ *
+ * Serializes as one opaque byte blob.
+ *
+ * @tparam T type of aggregated values.
+ */
+template<typename T>
+class FlatAggregate {
+
+  // copied onto the wire as raw bytes, so must hold no padding
+  struct RecordHeader {
+    size_t length;
+    std::int64_t tag; // widened from int to fill out the header
+  };
+  static_assert(
+    sizeof(RecordHeader) == sizeof(size_t) + sizeof(std::int64_t)
+  );
+
+  // vector of char serializes as a single binary blob
+  std::vector<char> arena;
+  size_t num_records{};
+
+  #ifndef NDEBUG
+    int last_tag{};
+  #endif
+
+  constexpr inline static bool is_trivial{
+    std::is_trivially_copyable<T>::value
+  };
+
+  size_t Reserve(const size_t length) {
+    const size_t offset = arena.size();
+    arena.resize( offset + sizeof(RecordHeader) + length );
+    return offset;
+  }
+
+  void WriteRecord(const int tag, const char* payload, const size_t length) {
+    const size_t offset = Reserve( length );
+    const RecordHeader header{ length, tag };
+    std::memcpy( arena.data() + offset, &header, sizeof(RecordHeader) );
+    std::memcpy(
+      arena.data() + offset + sizeof(RecordHeader), payload, length
+    );
+  }
+
+public:
+
+  using value_type = T;
+
+  /**
+   * Append a record. Records must be appended in nondecreasing tag order.
+   *
+   * @param tag tag identifying the record's destination.
+   * @param val value to store.
+   */
+  void Append(const int tag, const T& val) {
+    emp_assert( num_records == 0 || last_tag <= tag, last_tag, tag );
+    #ifndef NDEBUG
+      last_tag = tag;
+    #endif
+
+    if constexpr ( is_trivial ) WriteRecord(
+      tag, reinterpret_cast<const char*>( &val ), sizeof(T)
+    ); else {
+      thread_local emp::ContiguousStream buffer;
+      buffer.Reset();
+      { // oarchive flushes on destruction
+        cereal::BinaryOutputArchive oarchive( buffer );
+        oarchive( val );
+      }
+      WriteRecord( tag, buffer.GetData(), buffer.GetSize() );
+    }
+
+    ++num_records;
+  }
+
+  /**
+   * Append records already encoded by another aggregate.
+   *
+   * @param data first byte of the records, as returned by `GetData`.
+   * @param num_bytes number of bytes occupied by the records.
+   * @param count number of records.
+   */
+  void Splice(const char* data, const size_t num_bytes, const size_t count) {
+    if ( num_bytes == 0 ) return;
+    const size_t offset = arena.size();
+    arena.resize( offset + num_bytes );
+    std::memcpy( arena.data() + offset, data, num_bytes );
+    num_records += count;
+  }
+
+  /**
+   * Decode every record in storage order.
+   *
+   * @param fun callable taking `const int` tag and `T&&` value.
+   */
+  template<typename Fun>
+  void ForEach(Fun&& fun) const {
+    size_t offset{};
+    for (size_t i{}; i < num_records; ++i) {
+      RecordHeader header;
+      std::memcpy( &header, arena.data() + offset, sizeof(RecordHeader) );
+      offset += sizeof(RecordHeader);
+      emp_assert( offset + header.length <= arena.size() );
+
+      T val;
+      if constexpr ( is_trivial ) {
+        emp_assert( header.length == sizeof(T) );
+        std::memcpy( &val, arena.data() + offset, sizeof(T) );
+      } else {
+        emp::MemoryIStream imemstream( arena.data() + offset, header.length );
+        cereal::BinaryInputArchive iarchive( imemstream );
+        iarchive( val );
+      }
+      offset += header.length;
+
+      fun( static_cast<int>( header.tag ), std::move(val) );
+    }
+  }
+
+  /// @return number of records.
+  size_t size() const { return num_records; }
+
+  bool empty() const { return num_records == 0; }
+
+  /// @return number of bytes occupied by records.
+  size_t GetByteSize() const { return arena.size(); }
+
+  /// @return first byte of the first record.
+  const char* GetData() const { return arena.data(); }
+
+  /// Remove all records, keeping the arena's capacity.
+  void clear() {
+    arena.clear();
+    num_records = 0;
+  }
+
+  template<class Archive>
+  void serialize(Archive& archive) { archive( num_records, arena ); }
+
+};
+
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_FLATAGGREGATE_HPP_INCLUDE
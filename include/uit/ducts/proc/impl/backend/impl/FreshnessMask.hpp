@@ -0,0 +1,93 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_FRESHNESSMASK_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_FRESHNESSMASK_HPP_INCLUDE
+
+#include <climits>
+#include <cstring>
+#include <stddef.h>
+#include <type_traits>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+namespace uit {
+
+/**
+ * Records which members of a pool contributed a fresh value to a send, as
+ * bits packed into spare entries appended to the pool's buffer.
+ *
+ * A pool buffer holds one entry per member followed by `CalcNumEntries`
+ * mask entries, so the mask travels in the same message as the values.
+ *
+ * @tparam value_type type of pool entries, must be trivially copyable.
+ */
+template<typename value_type>
+class FreshnessMask {
+
+  static_assert( std::is_trivially_copyable<value_type>::value );
+
+  constexpr inline static size_t bits_per_entry{
+    CHAR_BIT * sizeof(value_type)
+  };
+
+  static unsigned char* GetBytes(
+    emp::vector<value_type>& buffer, const size_t num_members
+  ) {
+    emp_assert( buffer.size() == num_members + CalcNumEntries(num_members) );
+    return reinterpret_cast<unsigned char*>( buffer.data() + num_members );
+  }
+
+  static const unsigned char* GetBytes(
+    const emp::vector<value_type>& buffer, const size_t num_members
+  ) {
+    emp_assert( buffer.size() == num_members + CalcNumEntries(num_members) );
+    return reinterpret_cast<const unsigned char*>(
+      buffer.data() + num_members
+    );
+  }
+
+public:
+
+  /// How many entries must be appended to hold num_members bits?
+  static constexpr size_t CalcNumEntries(const size_t num_members) {
+    return ( num_members + bits_per_entry - 1 ) / bits_per_entry;
+  }
+
+  /// Mark every member stale.
+  static void Clear(
+    emp::vector<value_type>& buffer, const size_t num_members
+  ) {
+    std::memset(
+      GetBytes( buffer, num_members ),
+      0,
+      CalcNumEntries( num_members ) * sizeof(value_type)
+    );
+  }
+
+  /// Mark member index fresh.
+  static void Mark(
+    emp::vector<value_type>& buffer,
+    const size_t num_members,
+    const size_t index
+  ) {
+    emp_assert( index < num_members, index, num_members );
+    GetBytes( buffer, num_members )[ index / CHAR_BIT ]
+      |= 1u << ( index % CHAR_BIT );
+  }
+
+  /// Is member index fresh?
+  static bool IsMarked(
+    const emp::vector<value_type>& buffer,
+    const size_t num_members,
+    const size_t index
+  ) {
+    emp_assert( index < num_members, index, num_members );
+    return GetBytes( buffer, num_members )[ index / CHAR_BIT ]
+      & ( 1u << ( index % CHAR_BIT ) );
+  }
+
+};
+
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_FRESHNESSMASK_HPP_INCLUDE
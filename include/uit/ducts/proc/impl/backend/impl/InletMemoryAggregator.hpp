@@ -3,10 +3,12 @@
 #define UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_INLETMEMORYAGGREGATOR_HPP_INCLUDE
 
 #include <algorithm>
+#include <iterator>
 
 #include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
 #include "../../../../../../../third-party/Empirical/include/emp/base/optional.hpp"
 #include "../../../../../../../third-party/Empirical/include/emp/base/vector.hpp"
+#include "../../../../../../../third-party/Empirical/third-party/robin-hood-hashing/src/include/robin_hood.h"
 
 #include "../../../../../fixtures/Sink.hpp"
 #include "../../../../../setup/InterProcAddress.hpp"
@@ -24,35 +26,83 @@ class InletMemoryAggregator {
   using inlet_wrapper_t = typename AggregatorSpec::template inlet_wrapper_t<T>;
   emp::optional<inlet_wrapper_t<uit::Inlet<AggregatorSpec>>> inlet;
 
-  // multimap of tag -> data
+  // flat (tag, length, payload) records encoded from staging, held across
+  // failed send attempts until handed off to the inlet
   using T = typename AggregatorSpec::T;
-  T buffer{};
+  T aggregate{};
+  bool aggregate_pending{};
+
+  using value_type = typename T::value_type;
+
+  // per-tag staging, encoded as records as values are put, indexed by slot
+  // in ascending tag order
+  emp::vector<int> slot_tags;
+  emp::vector<T> staging;
+  robin_hood::unordered_flat_map<int, size_t> slot_lookup;
+  size_t num_staged{};
+  // encoded size of everything staged, which is what the flush policy sees
+  size_t num_staged_bytes{};
 
   constexpr static inline size_t B{ AggregatorSpec::B };
 
-  // incremented every time TryFlush is called
-  // then reset to zero once every member of the pool has called
+  // incremented the first time each member calls TryFlush
+  // then reset to zero once the aggregate is sent
   size_t pending_flush_counter{};
+  // which slots' members have called TryFlush since the last send?
+  emp::vector<bool> flush_flags;
+
+  // only consulted from TryFlush, so a deadline passes unnoticed until
+  // some member next flushes
+  using flush_policy_t = typename AggregatorSpec::FlushPolicy;
+  flush_policy_t flush_policy{};
+
+  // gather everything staged into one round, in tag order
+  void EncodeAggregate() {
+    emp_assert( !aggregate_pending );
+
+    aggregate.clear();
+    for (auto& records : staging) {
+      aggregate.Splice(
+        records.GetData(), records.GetByteSize(), records.size()
+      );
+      records.clear();
+    }
+    num_staged = 0;
+    num_staged_bytes = 0;
+
+    aggregate_pending = true;
+  }
 
-  #ifndef NDEBUG
-    std::unordered_set<size_t> flush_index_checker;
-  #endif
+  // hand the encoded round off to the inlet, if there is one
+  bool TrySendAggregate() {
+    if ( !aggregate_pending ) return true;
 
-  using value_type = typename AggregatorSpec::T::mapped_type;
+    // proc inlet ducts only take the value on a successful put
+    if ( inlet->TryPut( std::move(aggregate) ) ) {
+      // moved-from aggregate must be reset before reuse
+      aggregate.clear();
+      aggregate_pending = false;
+      return true;
+    } else return false;
+  }
 
   bool FlushAggregate() {
     emp_assert( IsInitialized() );
 
     pending_flush_counter = 0;
-    #ifndef NDEBUG
-      flush_index_checker.clear();
-    #endif
-
-    if ( buffer.empty() ) return inlet->TryFlush();
-    else if ( inlet->TryPut( std::move(buffer) ) ) {
-      buffer.clear();
-      return inlet->TryFlush();
-    } else return false;
+    std::fill( std::begin( flush_flags ), std::end( flush_flags ), false );
+    flush_policy.Reset();
+
+    // a round that failed to send goes out as encoded before anything
+    // staged after it, which keeps each tag's values in order
+    if ( !TrySendAggregate() ) return false;
+
+    if ( num_staged ) {
+      EncodeAggregate();
+      if ( !TrySendAggregate() ) return false;
+    }
+
+    return inlet->TryFlush();
 
   }
 
@@ -82,8 +132,13 @@ public:
     emp_assert( IsInitialized() );
     CheckCallingProc();
 
-    if (buffer.count(tag) < B) {
-      buffer.emplace( std::make_pair( tag, val) );
+    emp_assert( slot_lookup.count(tag), tag );
+    auto& records = staging[ slot_lookup.find(tag)->second ];
+    if (records.size() < B) {
+      const size_t prev_bytes = records.GetByteSize();
+      records.Append( tag, val );
+      num_staged_bytes += records.GetByteSize() - prev_bytes;
+      ++num_staged;
       return true;
     } else return false;
 
@@ -91,13 +146,29 @@ public:
 
   // TODO add move overload?
 
+  /// Mark the querying duct's staged values ready to send. Sends once every
+  /// member has flushed or, under an enabled flush policy, once the policy
+  /// says so. Deadlines are only checked here, so an aggregate whose
+  /// members all stop flushing waits past its deadline.
   bool TryFlush(const int tag) {
     emp_assert( IsInitialized() );
     CheckCallingProc();
 
-    emp_assert( flush_index_checker.insert(tag).second );
-
-    if ( ++pending_flush_counter == GetSize() ) return FlushAggregate();
+    emp_assert( slot_lookup.count(tag), tag );
+    const size_t slot = slot_lookup.find(tag)->second;
+
+    // without a flush policy, members must take turns
+    emp_assert( flush_policy_t::enabled || !flush_flags[slot], tag );
+    if ( !flush_flags[slot] ) {
+      flush_flags[slot] = true;
+      ++pending_flush_counter;
+    }
+
+    // members that have yet to flush send whatever they have staged
+    if (
+      pending_flush_counter == GetSize()
+      || flush_policy.ShouldFlush( num_staged_bytes )
+    ) return FlushAggregate();
     else return true;
 
   }
@@ -118,6 +189,18 @@ public:
 
     std::sort( std::begin( addresses ), std::end( addresses ) );
 
+    std::transform(
+      std::begin( addresses ), std::end( addresses ),
+      std::back_inserter( slot_tags ),
+      [](const auto& address){ return address.GetTag(); }
+    );
+    std::sort( std::begin( slot_tags ), std::end( slot_tags ) );
+    staging.resize( slot_tags.size() );
+    flush_flags.resize( slot_tags.size() );
+    for (size_t slot{}; slot < slot_tags.size(); ++slot) {
+      slot_lookup.emplace( slot_tags[slot], slot );
+    }
+
     auto backend = std::make_shared<
       typename AggregatorSpec::ProcBackEnd
     >();
@@ -3,6 +3,7 @@
 #define UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_INLETMEMORYPOOL_HPP_INCLUDE
 
 #include <algorithm>
+#include <utility>
 
 #include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
 #include "../../../../../../../third-party/Empirical/include/emp/base/optional.hpp"
@@ -12,6 +13,8 @@
 #include "../../../../../setup/InterProcAddress.hpp"
 #include "../../../../../spouts/Inlet.hpp"
 
+#include "FreshnessMask.hpp"
+
 namespace uit {
 
 template<typename PoolSpec>
@@ -27,31 +30,44 @@ class InletMemoryPool {
   using T = typename PoolSpec::T;
   T buffer{};
 
-  // incremented every time TryPut is called
-  // then reset to zero once every member of the pool has called
+  // incremented the first time each member calls TryPut
+  // then reset to zero once the pool is sent
   size_t pending_put_counter{};
+  // which members have called TryPut since the pool was last sent?
+  emp::vector<bool> put_flags;
   // did the most recent put request succeed?
   // (can we put new entries in the buffer?)
   bool last_put_status{ true };
 
-  #ifndef NDEBUG
-    std::unordered_set<size_t> put_index_checker;
-  #endif
+  // only consulted from TryPut, so a deadline passes unnoticed until
+  // some member next puts
+  using flush_policy_t = typename PoolSpec::FlushPolicy;
+  flush_policy_t flush_policy{};
 
   using value_type = typename PoolSpec::T::value_type;
 
+  // under an enabled flush policy, sends may go out before every member has
+  // put, so each send marks which members' entries are fresh
+  using freshness_mask_t = uit::FreshnessMask<value_type>;
+
   bool PutPool() {
     emp_assert( IsInitialized() );
 
     pending_put_counter = 0;
-    #ifndef NDEBUG
-      put_index_checker.clear();
-    #endif
-
-    const bool res = inlet->TryPut( std::move(buffer) );
-    buffer.resize( GetSize() );
-
-    return res;
+    std::fill( std::begin( put_flags ), std::end( put_flags ), false );
+    flush_policy.Reset();
+
+    if constexpr ( flush_policy_t::enabled ) {
+      // keep buffer intact so that members missing from a later send
+      // go out with their most recent value, marked stale
+      const bool res = inlet->TryPut( std::as_const(buffer) );
+      freshness_mask_t::Clear( buffer, GetSize() );
+      return res;
+    } else {
+      const bool res = inlet->TryPut( std::move(buffer) );
+      buffer.resize( GetSize() );
+      return res;
+    }
   }
 
   void CheckCallingProc() const {
@@ -65,6 +81,13 @@ public:
 
   size_t GetSize() const { return addresses.size(); }
 
+  /// How many entries does each send carry?
+  size_t GetMessageSize() const {
+    if constexpr ( flush_policy_t::enabled ) {
+      return GetSize() + freshness_mask_t::CalcNumEntries( GetSize() );
+    } else return GetSize();
+  }
+
   /// Retister a duct for an entry in the pool.
   void Register(const address_t& address) {
     emp_assert( !IsInitialized() );
@@ -91,22 +114,36 @@ public:
     );
   }
 
-  /// Get the querying duct's current value from the underlying duct.
+  /// Set the querying duct's entry in the pool. Sends once every member has
+  /// put or, under an enabled flush policy, once the policy says so.
+  /// Deadlines are only checked here, so a pool whose members all stop
+  /// putting waits past its deadline.
   bool TryPut(const value_type& val, const size_t index) {
     emp_assert( IsInitialized() );
     CheckCallingProc();
 
     if ( last_put_status ) {
       buffer[index] = val;
-      emp_assert( put_index_checker.insert(index).second );
+      if constexpr ( flush_policy_t::enabled ) {
+        freshness_mask_t::Mark( buffer, GetSize(), index );
+      }
     }
 
     const bool res = last_put_status;
 
-    if ( ++pending_put_counter == GetSize() ) {
-      last_put_status = PutPool();
+    // without a flush policy, members must take turns
+    // otherwise, putting again before the pool is sent overwrites the entry
+    emp_assert( flush_policy_t::enabled || !put_flags[index], index );
+    if ( !put_flags[index] ) {
+      put_flags[index] = true;
+      ++pending_put_counter;
     }
 
+    if (
+      pending_put_counter == GetSize()
+      || flush_policy.ShouldFlush( pending_put_counter * sizeof(value_type) )
+    ) last_put_status = PutPool();
+
     return res;
 
   }
@@ -136,10 +173,11 @@ public:
 
     std::sort( std::begin( addresses ), std::end( addresses ) );
 
-    buffer.resize( GetSize() );
+    buffer.resize( GetMessageSize() );
+    put_flags.resize( GetSize() );
     auto backend = std::make_shared<
       typename PoolSpec::ProcBackEnd
-    >( GetSize() );
+    >( GetMessageSize() );
 
     auto sink = uit::Sink<PoolSpec>{
       std::in_place_type_t<
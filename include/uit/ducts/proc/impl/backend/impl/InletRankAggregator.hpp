@@ -0,0 +1,276 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_INLETRANKAGGREGATOR_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_INLETRANKAGGREGATOR_HPP_INCLUDE
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <stddef.h>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/optional.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/vector.hpp"
+#include "../../../../../../../third-party/Empirical/third-party/robin-hood-hashing/src/include/robin_hood.h"
+
+#include "../../../../../../uitsl/parallel/cache_line.hpp"
+
+#include "../../../../../fixtures/Sink.hpp"
+#include "../../../../../setup/InterProcAddress.hpp"
+#include "../../../../../spouts/Inlet.hpp"
+
+namespace uit {
+
+/**
+ * Aggregates values from every duct sharing an inlet proc and outlet proc,
+ * whichever threads those ducts live on, into one message per round.
+ *
+ * Once a duct flushes, its staged values are encoded and appended to a
+ * shared arena at an offset reserved with a single atomic increment. The
+ * thread whose flush completes a round ships the arena through the backing
+ * inlet. Other threads never wait on it, and a failed shipment is retried
+ * by whichever thread flushes next. A round only ends once its aggregate has
+ * been both put and flushed.
+ *
+ * The arena grows between rounds to fit the largest round seen so far.
+ * Until then, contributions that overflow it are spliced in from their
+ * duct's own buffer instead.
+ */
+template<typename AggregatorSpec>
+class InletRankAggregator {
+
+  using address_t = uit::InterProcAddress;
+  emp::vector<address_t> addresses;
+
+  template<typename T>
+  using inlet_wrapper_t = typename AggregatorSpec::template inlet_wrapper_t<T>;
+  emp::optional<inlet_wrapper_t<uit::Inlet<AggregatorSpec>>> inlet;
+
+  using T = typename AggregatorSpec::T;
+  using value_type = typename T::value_type;
+
+  constexpr static inline size_t B{ AggregatorSpec::B };
+
+  // only touched by the owning duct's thread,
+  // except that the shipping thread reads encoded and spilled
+  // once every slot has contributed to the current round
+  struct alignas(uitsl::CACHE_LINE_SIZE) Slot {
+    emp::vector<value_type> staged;
+    T encoded;
+    size_t num_contributed{}; // rounds contributed to
+    bool spilled{}; // did encoded overflow the arena?
+  };
+
+  emp::vector<Slot> slots;
+  robin_hood::unordered_flat_map<int, size_t> slot_lookup;
+
+  // contributions to the current round, packed back to back
+  // only resized by the shipping thread, between rounds
+  emp::vector<char> arena;
+
+  alignas(uitsl::CACHE_LINE_SIZE) std::atomic<size_t> num_bytes_reserved{};
+  std::atomic<size_t> num_contributors{};
+
+  alignas(uitsl::CACHE_LINE_SIZE) std::atomic<size_t> round{};
+  std::atomic_flag shipping = ATOMIC_FLAG_INIT;
+
+  // assembled from the arena by the shipping thread, reused across rounds
+  T aggregate{};
+
+  // has the current round's aggregate been put, awaiting only a flush?
+  // only touched by the shipping thread
+  bool put_pending{};
+
+  Slot& GetSlot(const int tag) {
+    emp_assert( slot_lookup.count(tag), tag );
+    return slots[ slot_lookup.find(tag)->second ];
+  }
+
+  void Contribute(Slot& slot, const int tag) {
+
+    slot.encoded.clear();
+    for (const auto& val : slot.staged) slot.encoded.Append( tag, val );
+    slot.staged.clear();
+
+    const size_t num_bytes = slot.encoded.GetByteSize();
+    const size_t offset = num_bytes_reserved.fetch_add(
+      num_bytes, std::memory_order_relaxed
+    );
+    slot.spilled = offset + num_bytes > arena.size();
+    if ( !slot.spilled && num_bytes ) std::memcpy(
+      arena.data() + offset, slot.encoded.GetData(), num_bytes
+    );
+
+    ++slot.num_contributed;
+    // publishes the writes above to whichever thread ships the round
+    num_contributors.fetch_add( 1, std::memory_order_release );
+
+  }
+
+  bool Put() {
+
+    // reservations are handed out in order, so every contribution that fit
+    // precedes every contribution that spilled
+    size_t num_bytes{};
+    size_t num_records{};
+    for (const auto& slot : slots) if ( !slot.spilled ) {
+      num_bytes += slot.encoded.GetByteSize();
+      num_records += slot.encoded.size();
+    }
+
+    aggregate.clear();
+    aggregate.Splice( arena.data(), num_bytes, num_records );
+    for (const auto& slot : slots) if ( slot.spilled ) aggregate.Splice(
+      slot.encoded.GetData(), slot.encoded.GetByteSize(), slot.encoded.size()
+    );
+
+    return aggregate.empty() || inlet->TryPut( aggregate );
+
+  }
+
+  bool Ship() {
+
+    if ( !put_pending && !Put() ) return false;
+    put_pending = true;
+
+    // hold the round open until its aggregate is on its way
+    if ( !inlet->TryFlush() ) return false;
+    put_pending = false;
+
+    const size_t num_reserved = num_bytes_reserved.load(
+      std::memory_order_relaxed
+    );
+    if ( num_reserved > arena.size() ) arena.resize( num_reserved );
+
+    num_bytes_reserved.store( 0, std::memory_order_relaxed );
+    num_contributors.store( 0, std::memory_order_relaxed );
+    // publishes the resets above to the next round's contributors
+    round.fetch_add( 1, std::memory_order_release );
+
+    return true;
+
+  }
+
+  bool TryShip() {
+
+    if (
+      num_contributors.load( std::memory_order_acquire ) != GetSize()
+    ) return true;
+
+    // another thread is already shipping this round
+    if ( shipping.test_and_set( std::memory_order_acquire ) ) return true;
+
+    // the round may have shipped before we took the flag
+    const bool res = (
+      num_contributors.load( std::memory_order_acquire ) != GetSize()
+      || Ship()
+    );
+
+    shipping.clear( std::memory_order_release );
+
+    return res;
+
+  }
+
+  void CheckCallingProc() const {
+    [[maybe_unused]] const auto& rep = addresses.front();
+    emp_assert( rep.GetInletProc() == uitsl::get_rank( rep.GetComm() ) );
+  }
+
+public:
+
+  bool IsInitialized() const { return inlet.has_value(); }
+
+  size_t GetSize() const { return addresses.size(); }
+
+  /// Register a duct for an entry in the pool.
+  void Register(const address_t& address) {
+    emp_assert( !IsInitialized() );
+    emp_assert( std::find(
+      std::begin( addresses ), std::end( addresses ),
+      address
+    ) == std::end( addresses ) );
+    addresses.push_back(address);
+  }
+
+  /// Stage a value for the querying duct's next contribution.
+  bool TryPut(const value_type& val, const int tag) {
+    emp_assert( IsInitialized() );
+    CheckCallingProc();
+
+    auto& staged = GetSlot( tag ).staged;
+    if ( staged.size() < B ) {
+      staged.push_back( val );
+      return true;
+    } else return false;
+
+  }
+
+  /// Contribute the querying duct's staged values to the current round.
+  /// Fails while values staged since the duct's last contribution wait on
+  /// a round that has yet to ship.
+  bool TryFlush(const int tag) {
+    emp_assert( IsInitialized() );
+    CheckCallingProc();
+
+    Slot& slot = GetSlot( tag );
+
+    if (
+      slot.num_contributed == round.load( std::memory_order_acquire )
+    ) Contribute( slot, tag );
+    else if ( !slot.staged.empty() ) {
+      TryShip();
+      return false;
+    }
+
+    return TryShip();
+
+  }
+
+  /// Call after all members have requested a position in the pool.
+  void Initialize() {
+
+    emp_assert( !IsInitialized() );
+
+    emp_assert( std::adjacent_find(
+      std::begin(addresses), std::end(addresses),
+      [](const auto& a, const auto& b){
+        return a.GetInletProc() != b.GetInletProc()
+          || a.GetOutletProc() != b.GetOutletProc()
+          || a.GetComm() != b.GetComm()
+        ;
+      }
+    ) == std::end(addresses) );
+
+    // outlet side must pick the same representative address
+    std::sort( std::begin( addresses ), std::end( addresses ) );
+
+    slots.resize( addresses.size() );
+    for (size_t slot{}; slot < addresses.size(); ++slot) {
+      slot_lookup.emplace( addresses[slot].GetTag(), slot );
+    }
+
+    auto backend = std::make_shared<
+      typename AggregatorSpec::ProcBackEnd
+    >();
+
+    auto sink = uit::Sink<AggregatorSpec>{
+      std::in_place_type_t<
+        typename AggregatorSpec::ProcInletDuct
+      >{},
+      addresses.front(),
+      backend
+    };
+
+    backend->Initialize();
+
+    inlet = sink.GetInlet();
+
+    emp_assert( IsInitialized() );
+
+  }
+
+};
+
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_INLETRANKAGGREGATOR_HPP_INCLUDE
@@ -3,12 +3,14 @@
 #define UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_OUTLETMEMORYAGGREGATOR_HPP_INCLUDE
 
 #include <algorithm>
+#include <iterator>
+#include <limits>
+#include <utility>
 
 #include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
 #include "../../../../../../../third-party/Empirical/include/emp/base/optional.hpp"
 #include "../../../../../../../third-party/Empirical/include/emp/base/vector.hpp"
-
-#include "../../../../../../uitsl/algorithm/upper_uniquify.hpp"
+#include "../../../../../../../third-party/Empirical/third-party/robin-hood-hashing/src/include/robin_hood.h"
 
 #include "../../../../../fixtures/Source.hpp"
 #include "../../../../../setup/InterProcAddress.hpp"
@@ -28,9 +30,59 @@ class OutletMemoryAggregator {
   >;
   emp::optional<outlet_wrapper_t<uit::Outlet<AggregatorSpec>>> outlet;
 
-  // multimap of index -> value_type
   using T = typename AggregatorSpec::T;
-  T buffer{};
+  using value_type = typename T::value_type;
+
+  // received values for a single tag, oldest first
+  // front is the tag's current value, so a slot is never empty
+  struct Slot {
+    emp::vector<value_type> values;
+    size_t head{};
+    bool hit_since_last_consume{ true };
+
+    size_t size() const { return values.size() - head; }
+
+    value_type& front() { return values[head]; }
+
+    const value_type& front() const { return values[head]; }
+
+    void push_back(value_type&& val) { values.push_back( std::move(val) ); }
+
+    void pop_front(const size_t count) {
+      emp_assert( count < size() );
+      head += count;
+      // compact once the consumed prefix dominates, amortized O(1) per pop
+      if ( head * 2 >= values.size() ) {
+        values.erase(
+          std::begin( values ), std::next( std::begin( values ), head )
+        );
+        head = 0;
+      }
+    }
+
+    // keep only the most recent value
+    void collapse() { pop_front( size() - 1 ); }
+  };
+
+  emp::vector<Slot> slots;
+  robin_hood::unordered_flat_map<int, size_t> slot_lookup;
+
+  Slot& GetSlot(const int tag) {
+    emp_assert( slot_lookup.count(tag), tag );
+    return slots[ slot_lookup.find(tag)->second ];
+  }
+
+  const Slot& GetSlot(const int tag) const {
+    emp_assert( slot_lookup.count(tag), tag );
+    return slots[ slot_lookup.find(tag)->second ];
+  }
+
+  // distribute the outlet's current aggregate into per-tag slots
+  void Demultiplex() {
+    outlet->Get().ForEach( [this](const int tag, value_type&& val){
+      GetSlot( tag ).push_back( std::move(val) );
+    } );
+  }
 
   // incremented every time TryConsumeGets is called with
   // requested == std::numeric_limits<size_t>::max()
@@ -40,16 +92,13 @@ class OutletMemoryAggregator {
   size_t current_request{}; // num jump steps requested in current round
   size_t current_num_consumed{}; // num jump steps realized in current round
 
-  using value_type = typename AggregatorSpec::T::mapped_type;
-
-  std::unordered_map<int, bool> hit_since_last_consume;
   bool dry_flag{ false };
 
   bool PreventRedundantDryConsumes(const int tag) {
     if ( !dry_flag ) return true;
-    else if ( hit_since_last_consume.at(tag) ) {
+    else if ( GetSlot(tag).hit_since_last_consume ) {
       dry_flag = false;
-      for (auto& [k, v] : hit_since_last_consume) v = false;
+      for (auto& slot : slots) slot.hit_since_last_consume = false;
       return true;
     } else return false;
   }
@@ -57,20 +106,15 @@ class OutletMemoryAggregator {
   size_t DoTryStepGets(const size_t num_requested, const int tag) {
 
     size_t num_requested_countdown{ num_requested };
+    Slot& slot = GetSlot( tag );
 
     do {
 
-      emp_assert( buffer.count( tag ) );
-
-      const auto lower_bound = buffer.lower_bound( tag );
       const size_t cur_step = std::min(
         num_requested_countdown,
-        buffer.count( tag ) - 1
-      );
-      buffer.erase(
-        lower_bound,
-        std::next(lower_bound, cur_step)
+        slot.size() - 1
       );
+      slot.pop_front( cur_step );
       num_requested_countdown -= cur_step;
 
     } while (
@@ -82,12 +126,12 @@ class OutletMemoryAggregator {
         return res;
       }()
       && [this](){
-        buffer.merge( outlet->Get() );
+        Demultiplex();
         return true;
       }()
     );
 
-    hit_since_last_consume[tag] = true;
+    slot.hit_since_last_consume = true;
 
     return num_requested - num_requested_countdown;
 
@@ -105,9 +149,9 @@ class OutletMemoryAggregator {
       buffer_steps * outlet->Get().size() / GetSize()
     );
 
-    buffer.merge( outlet->Get() );
+    if ( buffer_steps ) Demultiplex();
 
-    uitsl::upper_uniquify( buffer );
+    for (auto& slot : slots) slot.collapse();
 
     return approx_steps;
 
@@ -137,16 +181,14 @@ public:
   value_type& Get(const int tag) {
     emp_assert( IsInitialized() );
     CheckCallingProc();
-    emp_assert( buffer.count(tag) );
-    return buffer.lower_bound(tag)->second;
+    return GetSlot( tag ).front();
   }
 
   /// Get the querying duct's current value from the underlying duct.
   const value_type& Get(const int tag) const {
     emp_assert( IsInitialized() );
     CheckCallingProc();
-    emp_assert( buffer.count(tag) );
-    return buffer.lower_bound(tag)->second;
+    return GetSlot( tag ).front();
   }
 
   /// Every member of the pool should call this with same requested.
@@ -188,6 +230,9 @@ public:
     ) == std::end(addresses) );
     emp_assert( !addresses.empty() );
 
+    // inlet side must pick the same representative address
+    std::sort( std::begin( addresses ), std::end( addresses ) );
+
     auto backend = std::make_shared<
       typename AggregatorSpec::ProcBackEnd
     >();
@@ -204,23 +249,11 @@ public:
 
     outlet = source.GetOutlet();
 
-    std::transform(
-      std::begin(addresses),
-      std::end(addresses),
-      std::inserter( buffer, std::end(buffer) ),
-      [](const auto& address){
-        return std::pair{ address.GetTag(), value_type{} };
-      }
-    );
-
-    std::transform(
-      std::begin(addresses),
-      std::end(addresses),
-      std::inserter( hit_since_last_consume, std::end(hit_since_last_consume) ),
-      [](const auto& address){
-        return std::pair{ address.GetTag(), true };
-      }
-    );
+    slots.resize( addresses.size() );
+    for (size_t slot{}; slot < addresses.size(); ++slot) {
+      slots[slot].values.emplace_back();
+      slot_lookup.emplace( addresses[slot].GetTag(), slot );
+    }
 
     emp_assert( IsInitialized() );
 
@@ -15,9 +15,22 @@
 
 #include "../RuntimeSizeBackEnd.hpp"
 
+#include "FreshnessMask.hpp"
+
 namespace uit {
 
-template<typename PoolSpec>
+/**
+ * TODO
+ *
+ * @tparam PoolSpec class with static and typedef members specifying
+ * implementation details for the pool.
+ * @tparam TracksFreshness do sends carry a `uit::FreshnessMask`, as sent
+ * by an `InletMemoryPool` under an enabled flush policy?
+ */
+template<
+  typename PoolSpec,
+  bool TracksFreshness=PoolSpec::FlushPolicy::enabled
+>
 class OutletMemoryPool {
 
   using address_t = uit::InterProcAddress;
@@ -40,9 +53,32 @@ class OutletMemoryPool {
 
   using value_type = typename PoolSpec::T::value_type;
 
+  using freshness_mask_t = uit::FreshnessMask<value_type>;
+
+  // fresh entries each member stepped past in current round
+  emp::vector<size_t> current_num_fresh;
+
   void DoTryConsumeGets(const size_t requested) {
     current_request = requested;
-    current_num_consumed = outlet->TryStep(requested);
+
+    if constexpr ( TracksFreshness ) {
+      // step one send at a time to tally each member's fresh entries
+      std::fill(
+        std::begin( current_num_fresh ), std::end( current_num_fresh ), 0
+      );
+      current_num_consumed = 0;
+      while (
+        current_num_consumed < requested && outlet->TryStep( 1 )
+      ) {
+        ++current_num_consumed;
+        const auto& message = outlet->Get();
+        for (size_t index{}; index < GetSize(); ++index) {
+          current_num_fresh[index] += freshness_mask_t::IsMarked(
+            message, GetSize(), index
+          );
+        }
+      }
+    } else current_num_consumed = outlet->TryStep(requested);
 
     emp_assert( std::all_of(
       std::begin(address_checker),
@@ -68,6 +104,13 @@ public:
 
   size_t GetSize() const { return addresses.size(); }
 
+  /// How many entries does each send carry?
+  size_t GetMessageSize() const {
+    if constexpr ( TracksFreshness ) {
+      return GetSize() + freshness_mask_t::CalcNumEntries( GetSize() );
+    } else return GetSize();
+  }
+
   /// Retister a duct for an entry in the pool.
   void Register(const address_t& address) {
     emp_assert( !IsInitialized() );
@@ -109,8 +152,11 @@ public:
   }
 
   /// Every member of the pool should call this with same requested.
+  /// Under an enabled flush policy, counts only sends that carried a fresh
+  /// entry for the querying duct.
   size_t TryConsumeGets(
     const size_t requested,
+    const size_t index,
     const address_t& address // only incl for debug safety check
   ) {
     emp_assert( IsInitialized() );
@@ -127,7 +173,8 @@ public:
     ++consume_call_counter;
     consume_call_counter %= GetSize();
 
-    return current_num_consumed;
+    if constexpr ( TracksFreshness ) return current_num_fresh[index];
+    else return current_num_consumed;
   }
 
   /// Call after all members have requested a position in the pool.
@@ -155,10 +202,11 @@ public:
       >{},
       addresses.front(),
       backend,
-      uit::RuntimeSizeBackEnd<PoolSpec>{ GetSize() }
+      uit::RuntimeSizeBackEnd<PoolSpec>{ GetMessageSize() }
     };
 
     outlet = source.GetOutlet();
+    current_num_fresh.resize( GetSize() );
 
     emp_assert( IsInitialized() );
 
@@ -167,7 +215,7 @@ public:
   void Initialize() {
     auto backend = std::make_shared<
       typename PoolSpec::ProcBackEnd
-    >( GetSize() );
+    >( GetMessageSize() );
     Initialize(backend);
     backend->Initialize();
   }
@@ -0,0 +1,231 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_OUTLETRANKAGGREGATOR_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_OUTLETRANKAGGREGATOR_HPP_INCLUDE
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <stddef.h>
+#include <utility>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/optional.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/vector.hpp"
+#include "../../../../../../../third-party/Empirical/third-party/robin-hood-hashing/src/include/robin_hood.h"
+#include "../../../../../../../third-party/SPSCQueue/include/rigtorp/SPSCQueue.h"
+
+#include "../../../../../fixtures/Source.hpp"
+#include "../../../../../setup/InterProcAddress.hpp"
+#include "../../../../../spouts/Outlet.hpp"
+
+namespace uit {
+
+/**
+ * Demultiplexes aggregates sent by an `InletRankAggregator` to the ducts
+ * they were bound for, whichever threads those ducts live on.
+ *
+ * Whichever thread runs dry first receives every aggregate available from
+ * the backing outlet and hands each value to its duct's thread through a
+ * single-producer, single-consumer queue. Threads that find another thread
+ * already receiving return without waiting. Values that overflow a duct's
+ * queue are held back, in order, until a later receive. At most N values
+ * are held back per duct; beyond that, the oldest are dropped.
+ */
+template<typename AggregatorSpec>
+class OutletRankAggregator {
+
+  using address_t = uit::InterProcAddress;
+  emp::vector<address_t> addresses;
+
+  template<typename T>
+  using outlet_wrapper_t = typename AggregatorSpec::template outlet_wrapper_t<
+    T
+  >;
+  emp::optional<outlet_wrapper_t<uit::Outlet<AggregatorSpec>>> outlet;
+
+  using T = typename AggregatorSpec::T;
+  using value_type = typename T::value_type;
+
+  constexpr static inline size_t N{ AggregatorSpec::N };
+
+  // the receiving thread is the only producer at any one time,
+  // and the owning duct's thread is the only consumer
+  struct Slot {
+    rigtorp::SPSCQueue<value_type> queue{ N };
+    std::deque<value_type> backlog; // only touched by the receiving thread
+    value_type current{};
+    std::atomic<size_t> num_dropped{};
+
+    void Push(value_type&& val) {
+      if ( backlog.empty() && queue.try_push( std::move(val) ) ) return;
+      backlog.push_back( std::move(val) );
+      // keep a stalled duct from holding back values without bound
+      if ( backlog.size() > N ) {
+        backlog.pop_front();
+        num_dropped.fetch_add( 1, std::memory_order_relaxed );
+      }
+    }
+
+    /// @return whether any held back values were handed off.
+    bool Drain() {
+      const size_t num_backlogged = backlog.size();
+      while (
+        backlog.size() && queue.try_push( std::move( backlog.front() ) )
+      ) backlog.pop_front();
+      return backlog.size() != num_backlogged;
+    }
+  };
+
+  emp::vector<std::unique_ptr<Slot>> slots;
+  robin_hood::unordered_flat_map<int, size_t> slot_lookup;
+
+  std::atomic_flag receiving = ATOMIC_FLAG_INIT;
+
+  Slot& GetSlot(const int tag) {
+    emp_assert( slot_lookup.count(tag), tag );
+    return *slots[ slot_lookup.find(tag)->second ];
+  }
+
+  const Slot& GetSlot(const int tag) const {
+    emp_assert( slot_lookup.count(tag), tag );
+    return *slots[ slot_lookup.find(tag)->second ];
+  }
+
+  /// @return whether any values were handed off.
+  bool TryReceive() {
+
+    // another thread is already receiving
+    if ( receiving.test_and_set( std::memory_order_acquire ) ) return false;
+
+    bool res{};
+    for (auto& slot : slots) res |= slot->Drain();
+
+    while ( outlet->TryStep( 1 ) ) {
+      res = true;
+      outlet->Get().ForEach( [this](const int tag, value_type&& val){
+        GetSlot( tag ).Push( std::move(val) );
+      } );
+    }
+
+    // hands the queues' producer side to the next receiving thread
+    receiving.clear( std::memory_order_release );
+
+    return res;
+
+  }
+
+  void CheckCallingProc() const {
+    [[maybe_unused]] const auto& rep = addresses.front();
+    emp_assert( rep.GetOutletProc() == uitsl::get_rank( rep.GetComm() ) );
+  }
+
+public:
+
+  bool IsInitialized() const { return outlet.has_value(); }
+
+  size_t GetSize() const { return addresses.size(); }
+
+  /// Register a duct for an entry in the pool.
+  void Register(const address_t& address) {
+    emp_assert( !IsInitialized() );
+    emp_assert( std::find(
+      std::begin( addresses ), std::end( addresses ), address
+    ) == std::end(addresses) );
+    addresses.push_back(address);
+  }
+
+  /// Get the querying duct's current value.
+  value_type& Get(const int tag) {
+    emp_assert( IsInitialized() );
+    CheckCallingProc();
+    return GetSlot( tag ).current;
+  }
+
+  /// Get the querying duct's current value.
+  const value_type& Get(const int tag) const {
+    emp_assert( IsInitialized() );
+    CheckCallingProc();
+    return GetSlot( tag ).current;
+  }
+
+  /// How many values bound for the querying duct were dropped because it
+  /// fell too far behind?
+  size_t GetNumDropped(const int tag) const {
+    emp_assert( IsInitialized() );
+    return GetSlot( tag ).num_dropped.load( std::memory_order_relaxed );
+  }
+
+  /// Members may call this independently, from any thread.
+  size_t TryConsumeGets(
+    const size_t requested,
+    const int tag
+  ) {
+    emp_assert( IsInitialized() );
+    CheckCallingProc();
+
+    Slot& slot = GetSlot( tag );
+
+    size_t num_consumed{};
+    do for (
+      value_type* val;
+      num_consumed < requested && ( val = slot.queue.front() );
+      ++num_consumed
+    ) {
+      slot.current = std::move( *val );
+      slot.queue.pop();
+    } while ( num_consumed < requested && TryReceive() );
+
+    return num_consumed;
+
+  }
+
+  /// Call after all members have requested a position in the pool.
+  void Initialize() {
+
+    emp_assert( !IsInitialized() );
+
+    emp_assert( std::adjacent_find(
+      std::begin(addresses), std::end(addresses),
+      [](const auto& a, const auto& b){
+        return a.GetInletProc() != b.GetInletProc()
+          || a.GetOutletProc() != b.GetOutletProc()
+          || a.GetComm() != b.GetComm()
+        ;
+      }
+    ) == std::end(addresses) );
+    emp_assert( !addresses.empty() );
+
+    // inlet side must pick the same representative address
+    std::sort( std::begin( addresses ), std::end( addresses ) );
+
+    auto backend = std::make_shared<
+      typename AggregatorSpec::ProcBackEnd
+    >();
+
+    auto source = uit::Source<AggregatorSpec>{
+      std::in_place_type_t<
+        typename AggregatorSpec::ProcOutletDuct
+      >{},
+      addresses.front(),
+      backend
+    };
+
+    backend->Initialize();
+
+    outlet = source.GetOutlet();
+
+    for (size_t slot{}; slot < addresses.size(); ++slot) {
+      slots.push_back( std::make_unique<Slot>() );
+      slot_lookup.emplace( addresses[slot].GetTag(), slot );
+    }
+
+    emp_assert( IsInitialized() );
+
+  }
+
+};
+
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_BACKEND_IMPL_OUTLETRANKAGGREGATOR_HPP_INCLUDE
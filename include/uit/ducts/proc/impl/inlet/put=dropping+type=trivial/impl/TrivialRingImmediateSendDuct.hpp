@@ -12,6 +12,7 @@
 
 #include "../../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
 #include "../../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../../../third-party/Empirical/include/emp/polyfill/span.hpp"
 #include "../../../../../../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
 
 #include "../../../../../../../uitsl/datastructs/RingBuffer.hpp"
@@ -140,6 +141,21 @@ public:
     else return false;
   }
 
+  /**
+   * Post sends for as many leading values from vals as there is room for.
+   *
+   * Completed sends are flushed once for the whole batch.
+   *
+   * @param vals TODO.
+   * @return number of values accepted.
+   */
+  size_t TryPutMany(const std::span<const T> vals) {
+    FlushFinalizedSends();
+    const size_t num_put = std::min( vals.size(), N - buffer.GetSize() );
+    for (size_t i = 0; i < num_put; ++i) DoPut( vals[i] );
+    return num_put;
+  }
+
   /**
    * TODO.
    */
@@ -0,0 +1,216 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_IMPL_TRIVIALRINGPERSISTENTSENDDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_IMPL_TRIVIALRINGPERSISTENTSENDDUCT_HPP_INCLUDE
+
+#include <algorithm>
+#include <memory>
+#include <stddef.h>
+#include <string>
+
+#include <mpi.h>
+
+#include "../../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../../third-party/Empirical/include/emp/base/array.hpp"
+#include "../../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../../../third-party/Empirical/include/emp/polyfill/span.hpp"
+#include "../../../../../../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+#include "../../../../../../../uitsl/meta/t::static_test.hpp"
+#include "../../../../../../../uitsl/mpi/audited_routines.hpp"
+#include "../../../../../../../uitsl/mpi/mpi_init_utils.hpp"
+#include "../../../../../../../uitsl/mpi/request_utils.hpp"
+#include "../../../../../../../uitsl/nonce/CircularIndex.hpp"
+#include "../../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../../setup/InterProcAddress.hpp"
+
+#include "../../../backend/MockBackEnd.hpp"
+
+namespace uit {
+namespace internal {
+
+/**
+ * Ring of persistent send requests, one per buffer slot.
+ *
+ * Each slot's send is initialized once at construction. A put copies its
+ * value into the next free slot and restarts that slot's request, so the
+ * MPI library skips per-message request setup.
+ *
+ * @tparam PersistentSendInitFunctor functor wrapping `MPI_Send_init` or a
+ * variant thereof.
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename PersistentSendInitFunctor, typename ImplSpec>
+class TrivialRingPersistentSendDuct {
+
+public:
+
+  using BackEndImpl = uit::MockBackEnd<ImplSpec>;
+
+private:
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::t::static_test<T>(), uitsl_t_message );
+  constexpr inline static size_t N{ImplSpec::N};
+
+  emp::array<T, N> buffer{};
+  emp::array<MPI_Request, N> requests;
+
+  // slot the next put will be sent from
+  uitsl::CircularIndex<N> head{};
+  // number of started sends not yet known to have completed
+  size_t num_pending{};
+
+  const uit::InterProcAddress address;
+
+  uitsl::CircularIndex<N> GetTail() const {
+    uitsl::CircularIndex<N> tail{ head };
+    return tail - num_pending;
+  }
+
+  bool TryFinalizeSend() {
+    emp_assert( num_pending );
+
+    if ( uitsl::test_completion( requests[ GetTail() ] ) ) {
+      --num_pending;
+      return true;
+    } else return false;
+  }
+
+  void FlushFinalizedSends() { while (num_pending && TryFinalizeSend()); }
+
+  void CancelPendingSend() {
+    emp_assert( num_pending );
+    UITSL_Cancel( &requests[ GetTail() ] );
+    --num_pending;
+  }
+
+  /**
+   * Start persistent sends for `count` consecutive slots beginning at head.
+   *
+   * @param count number of slots, must not wrap past the end of the ring.
+   */
+  void StartRun(const size_t count) {
+    emp_assert( static_cast<size_t>(head) + count <= N );
+    if ( count == 1 ) UITSL_Start( &requests[head] );
+    else if ( count ) UITSL_Startall( count, &requests[head] );
+    head += count;
+    num_pending += count;
+  }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  bool IsReadyForPut() {
+    FlushFinalizedSends();
+    return num_pending < N;
+  }
+
+public:
+
+  TrivialRingPersistentSendDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end
+  ) : address(address_) {
+    for (size_t i = 0; i < N; ++i) PersistentSendInitFunctor{}(
+      &buffer[i], // const void *buf
+      sizeof(T), // int count
+      MPI_BYTE, // MPI_Datatype datatype
+      address.GetOutletProc(), // int dest
+      address.GetTag(), // int tag
+      address.GetComm(), // MPI_Comm comm
+      &requests[i] // MPI_Request *request
+    );
+  }
+
+  ~TrivialRingPersistentSendDuct() {
+    FlushFinalizedSends();
+    while ( num_pending ) CancelPendingSend();
+    // active requests are deallocated once their cancellation completes
+    for (auto& request : requests) UITSL_Request_free( &request );
+  }
+
+  /**
+   * TODO.
+   *
+   * @param val TODO.
+   */
+  bool TryPut(const T& val) {
+    if ( IsReadyForPut() ) {
+      buffer[head] = val;
+      StartRun( 1 );
+      return true;
+    } else return false;
+  }
+
+  /**
+   * Send as many leading values from vals as there are free slots for.
+   *
+   * Each contiguous run of slots is started with a single `MPI_Startall`.
+   *
+   * @param vals TODO.
+   * @return number of values accepted.
+   */
+  size_t TryPutMany(const std::span<const T> vals) {
+    FlushFinalizedSends();
+    const size_t num_put = std::min( vals.size(), N - num_pending );
+
+    // at most two runs, split where the ring wraps around
+    const size_t first_run = std::min( num_put, N - head );
+    std::copy_n( std::begin(vals), first_run, std::next(
+      std::begin(buffer), head
+    ) );
+    StartRun( first_run );
+
+    const size_t second_run = num_put - first_run;
+    std::copy_n(
+      std::next( std::begin(vals), first_run ),
+      second_run,
+      std::begin(buffer)
+    );
+    StartRun( second_run );
+
+    return num_put;
+  }
+
+  /**
+   * TODO.
+   */
+  bool TryFlush() const { return true; }
+
+  [[noreturn]] size_t TryConsumeGets(size_t) const {
+    emp_always_assert(
+      false, "ConsumeGets called on TrivialRingPersistentSendDuct"
+    );
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] const T& Get() const {
+    emp_always_assert(false, "Get called on TrivialRingPersistentSendDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] T& Get() {
+    emp_always_assert(false, "Get called on TrivialRingPersistentSendDuct");
+    __builtin_unreachable();
+  }
+
+  static std::string GetType() { return "TrivialRingPersistentSendDuct"; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetType() << '\n';
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << '\n';
+    ss << uitsl::format_member("InterProcAddress address", address) << '\n';
+    return ss.str();
+  }
+
+};
+
+} // namespace internal
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_IMPL_TRIVIALRINGPERSISTENTSENDDUCT_HPP_INCLUDE
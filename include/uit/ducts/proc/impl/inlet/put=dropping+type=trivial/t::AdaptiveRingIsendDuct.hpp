@@ -0,0 +1,205 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__ADAPTIVERINGISENDDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__ADAPTIVERINGISENDDUCT_HPP_INCLUDE
+
+#include <memory>
+#include <stddef.h>
+#include <string>
+
+#include <mpi.h>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/vector.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/polyfill/span.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+#include "../../../../../../uitsl/datastructs/RingBuffer.hpp"
+#include "../../../../../../uitsl/debug/err_audit.hpp"
+#include "../../../../../../uitsl/meta/t::static_test.hpp"
+#include "../../../../../../uitsl/mpi/audited_routines.hpp"
+#include "../../../../../../uitsl/mpi/mpi_init_utils.hpp"
+#include "../../../../../../uitsl/nonce/AdaptiveDepth.hpp"
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/MockBackEnd.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Ring of immediate sends whose depth adapts at runtime, up to `N`.
+ *
+ * A put that would be dropped because every slot holds a pending send
+ * instead doubles depth, so puts only drop once depth reaches `N`. Depth
+ * halves when pending sends stay well below it. Slots are allocated the
+ * first time depth calls for them.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class AdaptiveRingIsendDuct {
+
+public:
+
+  using BackEndImpl = uit::MockBackEnd<ImplSpec>;
+
+private:
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::t::static_test<T>(), uitsl_t_message );
+  constexpr inline static size_t N{ImplSpec::N};
+
+  struct Slot {
+    T val;
+    MPI_Request request{ MPI_REQUEST_NULL };
+  };
+
+  // allocated on demand, addresses stay put while sends are pending
+  emp::vector<std::unique_ptr<Slot>> slots;
+  emp::vector<Slot*> free_slots;
+
+  // oldest send at tail
+  uitsl::RingBuffer<Slot*, N> pending;
+
+  uitsl::AdaptiveDepth<N> depth;
+
+  const uit::InterProcAddress address;
+
+  Slot& AcquireSlot() {
+    if ( free_slots.empty() ) {
+      return *slots.emplace_back( std::make_unique<Slot>() );
+    }
+    Slot& res = *free_slots.back();
+    free_slots.pop_back();
+    return res;
+  }
+
+  bool TryFinalizeSend() {
+    Slot& slot = *pending.GetTail();
+    emp_assert( !uitsl::test_null( slot.request ) );
+
+    if ( uitsl::test_completion( slot.request ) ) {
+      free_slots.push_back( pending.GetPopTail() );
+      return true;
+    } else return false;
+  }
+
+  void CancelPendingSend() {
+    Slot& slot = *pending.GetPopTail();
+    emp_assert( !uitsl::test_null( slot.request ) );
+
+    UITSL_Cancel( &slot.request );
+    UITSL_Request_free( &slot.request );
+  }
+
+  void FlushFinalizedSends() { while (pending.GetSize() && TryFinalizeSend()); }
+
+  bool HasRoom() {
+    return pending.GetSize() < depth.GetDepth() || depth.ReportSaturation();
+  }
+
+  void DoPut(const T& val) {
+    Slot& slot = AcquireSlot();
+    slot.val = val;
+
+    UITSL_Isend(
+      &slot.val,
+      sizeof(T),
+      MPI_BYTE,
+      address.GetOutletProc(),
+      address.GetTag(),
+      address.GetComm(),
+      &slot.request
+    );
+    emp_assert( !uitsl::test_null( slot.request ) );
+
+    uitsl_err_audit(!   pending.PushHead( &slot )   );
+  }
+
+public:
+
+  AdaptiveRingIsendDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end
+  ) : address(address_)
+  { ; }
+
+  ~AdaptiveRingIsendDuct() {
+    FlushFinalizedSends();
+    while ( pending.GetSize() ) CancelPendingSend();
+  }
+
+  /**
+   * TODO.
+   *
+   * @param val TODO.
+   */
+  bool TryPut(const T& val) {
+    FlushFinalizedSends();
+    depth.ReportOccupancy( pending.GetSize() );
+    if ( HasRoom() ) { DoPut(val); return true; }
+    else return false;
+  }
+
+  /**
+   * Post sends for as many leading values from vals as there is room for.
+   *
+   * Completed sends are flushed once for the whole batch.
+   *
+   * @param vals TODO.
+   * @return number of values accepted.
+   */
+  size_t TryPutMany(const std::span<const T> vals) {
+    FlushFinalizedSends();
+    depth.ReportOccupancy( pending.GetSize() );
+    size_t num_put{};
+    while ( num_put < vals.size() && HasRoom() ) DoPut( vals[num_put++] );
+    return num_put;
+  }
+
+  /**
+   * TODO.
+   */
+  bool TryFlush() const { return true; }
+
+  [[noreturn]] size_t TryConsumeGets(size_t) const {
+    emp_always_assert(false, "ConsumeGets called on AdaptiveRingIsendDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] const T& Get() const {
+    emp_always_assert(false, "Get called on AdaptiveRingIsendDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] T& Get() {
+    emp_always_assert(false, "Get called on AdaptiveRingIsendDuct");
+    __builtin_unreachable();
+  }
+
+  /**
+   * @return current maximum number of pending sends.
+   */
+  size_t GetDepth() const { return depth.GetDepth(); }
+
+  static std::string GetName() { return "AdaptiveRingIsendDuct"; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetName() << '\n';
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << '\n';
+    ss << uitsl::format_member("InterProcAddress address", address) << '\n';
+    ss << uitsl::format_member("size_t GetDepth()", GetDepth()) << '\n';
+    return ss.str();
+  }
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__ADAPTIVERINGISENDDUCT_HPP_INCLUDE
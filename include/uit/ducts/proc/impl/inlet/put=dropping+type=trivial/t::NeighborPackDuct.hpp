@@ -0,0 +1,108 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__NEIGHBORPACKDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__NEIGHBORPACKDUCT_HPP_INCLUDE
+
+#include <memory>
+#include <stddef.h>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/optional.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/NeighborhoodBackEnd.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Packs puts into its proc's next neighborhood exchange round.
+ *
+ * At most one value per round is accepted, further puts are dropped until
+ * the round goes out. Flushing marks this duct ready, and the round goes out
+ * once every inlet on the proc is ready.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class NeighborPackDuct {
+
+public:
+
+  using BackEndImpl = uit::NeighborhoodBackEnd<ImplSpec>;
+
+private:
+
+  using T = typename ImplSpec::T;
+
+  const uit::InterProcAddress address;
+
+  std::shared_ptr<BackEndImpl> back_end;
+
+  emp::optional<size_t> slot;
+
+  size_t GetSlot() {
+    if ( !slot.has_value() ) slot = back_end->LookupInletSlot( address );
+    return *slot;
+  }
+
+public:
+
+  NeighborPackDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end_
+  ) : address(address_)
+  , back_end(back_end_)
+  { back_end->RegisterInletSlot( address ); }
+
+  /**
+   * TODO.
+   *
+   * @param val TODO.
+   * @return TODO.
+   */
+  bool TryPut(const T& val) { return back_end->TryPut( val, GetSlot() ); }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  bool TryFlush() { return back_end->TryFlush( GetSlot() ); }
+
+  [[noreturn]] size_t TryConsumeGets(size_t) const {
+    emp_always_assert(false, "ConsumeGets called on NeighborPackDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] const T& Get() const {
+    emp_always_assert(false, "Get called on NeighborPackDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] T& Get() {
+    emp_always_assert(false, "Get called on NeighborPackDuct");
+    __builtin_unreachable();
+  }
+
+  static std::string GetName() { return "NeighborPackDuct"; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetName() << '\n';
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << '\n';
+    ss << uitsl::format_member("InterProcAddress address", address) << '\n';
+    return ss.str();
+  }
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__NEIGHBORPACKDUCT_HPP_INCLUDE
@@ -0,0 +1,206 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__PROGRESSRINGISENDDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__PROGRESSRINGISENDDUCT_HPP_INCLUDE
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <stddef.h>
+#include <string>
+
+#include <mpi.h>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/array.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/optional.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/polyfill/span.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+#include "../../../../../../uitsl/meta/t::static_test.hpp"
+#include "../../../../../../uitsl/mpi/audited_routines.hpp"
+#include "../../../../../../uitsl/mpi/mpi_init_utils.hpp"
+#include "../../../../../../uitsl/mpi/ProgressEngine.hpp"
+#include "../../../../../../uitsl/parallel/cache_line.hpp"
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/MockBackEnd.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Ring of immediate sends that are posted and completed by the process-wide
+ * `uitsl::ProgressEngine` rather than by the putting thread.
+ *
+ * Puts copy into a free ring slot and publish it through an atomic counter,
+ * without making any MPI calls. Puts are dropped when every slot holds a
+ * send that has not yet completed.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class ProgressRingIsendDuct {
+
+public:
+
+  using BackEndImpl = uit::MockBackEnd<ImplSpec>;
+
+private:
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::t::static_test<T>(), uitsl_t_message );
+  constexpr inline static size_t N{ImplSpec::N};
+
+  emp::array<T, N> data;
+
+  // owned by progress thread
+  emp::array<MPI_Request, N> requests;
+  size_t num_posted{};
+
+  // written only by putting thread
+  alignas(uitsl::CACHE_LINE_SIZE) std::atomic<size_t> num_staged{};
+
+  // written only by progress thread
+  alignas(uitsl::CACHE_LINE_SIZE) std::atomic<size_t> num_released{};
+
+  const uit::InterProcAddress address;
+
+  const uitsl::ProgressEngine::task_t progress_task{
+    [this](){ return Progress(); }
+  };
+  emp::optional<uitsl::ProgressEngine::Registration> registration;
+
+  void PostSend(const size_t slot) {
+    UITSL_Isend(
+      &data[slot],
+      sizeof(T),
+      MPI_BYTE,
+      address.GetOutletProc(),
+      address.GetTag(),
+      address.GetComm(),
+      &requests[slot]
+    );
+    emp_assert( !uitsl::test_null( requests[slot] ) );
+  }
+
+  // called from progress thread, returns whether anything was posted or
+  // completed
+  bool Progress() {
+    const size_t staged = num_staged.load( std::memory_order_acquire );
+    const size_t prev_posted = num_posted;
+    for (; num_posted < staged; ++num_posted) PostSend( num_posted % N );
+
+    const size_t prev_released = num_released.load(std::memory_order_relaxed);
+    size_t released = prev_released;
+    while (
+      released < num_posted
+      && uitsl::test_completion( requests[released % N] )
+    ) ++released;
+    num_released.store( released, std::memory_order_release );
+
+    return num_posted != prev_posted || released != prev_released;
+  }
+
+  size_t CountFreeSlots() const {
+    return N - (
+      num_staged.load( std::memory_order_relaxed )
+      - num_released.load( std::memory_order_acquire )
+    );
+  }
+
+  void DoPut(const T& val) {
+    const size_t staged = num_staged.load( std::memory_order_relaxed );
+    data[staged % N] = val;
+    num_staged.store( staged + 1, std::memory_order_release );
+    uitsl::ProgressEngine::Get().Wake();
+  }
+
+public:
+
+  ProgressRingIsendDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end
+  ) : address(address_) {
+    if ( uitsl::get_rank( address.GetComm() ) == address.GetInletProc() ) {
+      registration.emplace( progress_task );
+    }
+  }
+
+  ~ProgressRingIsendDuct() {
+    // wait out any sweep in progress, then take over the requests
+    registration.reset();
+    for (size_t i = num_released; i < num_posted; ++i) {
+      auto& request = requests[i % N];
+      if ( !uitsl::test_completion( request ) ) {
+        UITSL_Cancel( &request );
+        UITSL_Request_free( &request );
+      }
+    }
+  }
+
+  /**
+   * TODO.
+   *
+   * @param val TODO.
+   */
+  bool TryPut(const T& val) {
+    if ( CountFreeSlots() ) { DoPut(val); return true; }
+    else return false;
+  }
+
+  /**
+   * Stage as many leading values from vals as there are free slots for,
+   * publishing them to the progress thread all at once.
+   *
+   * @param vals TODO.
+   * @return number of values accepted.
+   */
+  size_t TryPutMany(const std::span<const T> vals) {
+    const size_t staged = num_staged.load( std::memory_order_relaxed );
+    const size_t num_put = std::min( vals.size(), CountFreeSlots() );
+    for (size_t i = 0; i < num_put; ++i) data[(staged + i) % N] = vals[i];
+    num_staged.store( staged + num_put, std::memory_order_release );
+    if ( num_put ) uitsl::ProgressEngine::Get().Wake();
+    return num_put;
+  }
+
+  /**
+   * TODO.
+   */
+  bool TryFlush() const { return true; }
+
+  [[noreturn]] size_t TryConsumeGets(size_t) const {
+    emp_always_assert(false, "ConsumeGets called on ProgressRingIsendDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] const T& Get() const {
+    emp_always_assert(false, "Get called on ProgressRingIsendDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] T& Get() {
+    emp_always_assert(false, "Get called on ProgressRingIsendDuct");
+    __builtin_unreachable();
+  }
+
+  static std::string GetName() { return "ProgressRingIsendDuct"; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetName() << '\n';
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << '\n';
+    ss << uitsl::format_member("InterProcAddress address", address) << '\n';
+    return ss.str();
+  }
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__PROGRESSRINGISENDDUCT_HPP_INCLUDE
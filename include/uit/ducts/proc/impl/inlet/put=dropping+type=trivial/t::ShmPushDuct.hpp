@@ -0,0 +1,120 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__SHMPUSHDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__SHMPUSHDUCT_HPP_INCLUDE
+
+#include <memory>
+#include <stddef.h>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/polyfill/span.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+#include "../../../../../../uitsl/meta/t::static_test.hpp"
+#include "../../../../../../uitsl/mpi/mpi_init_utils.hpp"
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/ShmBackEnd.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Pushes directly into a shared memory ring mapped by the outlet proc.
+ *
+ * Puts are dropped when the ring is full. No MPI calls are made after
+ * `ShmBackEnd::Initialize`.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class ShmPushDuct {
+
+public:
+
+  using BackEndImpl = uit::ShmBackEnd<ImplSpec>;
+
+private:
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::t::static_test<T>(), uitsl_t_message );
+
+  const uit::InterProcAddress address;
+
+  std::shared_ptr<typename BackEndImpl::ring_t> ring;
+
+public:
+
+  ShmPushDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end
+  ) : address(address_)
+  , ring(
+    uitsl::get_rank(address.GetComm()) == address.GetInletProc()
+      ? back_end->AcquireInletRing(address)
+      : nullptr
+  ) { ; }
+
+  /**
+   * TODO.
+   *
+   * @param val TODO.
+   * @return TODO.
+   */
+  bool TryPut(const T& val) {
+    emp_assert( ring && ring->IsInitialized() );
+    return ring->PushHead(val);
+  }
+
+  /**
+   * Put a contiguous batch of values with a single copy into the ring.
+   *
+   * @param vals TODO.
+   * @return number of leading values from vals that were accepted.
+   */
+  size_t TryPutMany(const std::span<const T> vals) {
+    emp_assert( ring && ring->IsInitialized() );
+    return ring->PushHeadMany(vals);
+  }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  bool TryFlush() const { return true; }
+
+  [[noreturn]] size_t TryConsumeGets(size_t) const {
+    emp_always_assert(false, "ConsumeGets called on ShmPushDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] const T& Get() const {
+    emp_always_assert(false, "Get called on ShmPushDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] T& Get() {
+    emp_always_assert(false, "Get called on ShmPushDuct");
+    __builtin_unreachable();
+  }
+
+  static std::string GetName() { return "ShmPushDuct"; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetName() << '\n';
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << '\n';
+    ss << uitsl::format_member("InterProcAddress address", address) << '\n';
+    return ss.str();
+  }
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_INLET_PUT_DROPPING_TYPE_TRIVIAL_T__SHMPUSHDUCT_HPP_INCLUDE
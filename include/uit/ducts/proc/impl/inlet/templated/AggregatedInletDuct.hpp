@@ -29,16 +29,19 @@ namespace uit {
  *
  * @tparam ImplSpec class with static and typedef members specifying
  * implementation details for the conduit framework.
+ * @tparam BackEnd backend template grouping ducts into aggregates.
  */
 template<
   template<typename> typename BackingDuct,
-  typename ImplSpec
+  typename ImplSpec,
+  template<typename, template<typename> typename> typename BackEnd
+    =uit::AggregatedBackEnd
 >
 class AggregatedInletDuct {
 
 public:
 
-  using BackEndImpl = uit::AggregatedBackEnd<ImplSpec, BackingDuct>;
+  using BackEndImpl = BackEnd<ImplSpec, BackingDuct>;
 
 private:
 
@@ -23,6 +23,10 @@ public:
   constexpr inline static size_t N{ ImplSpec::N };
   constexpr inline static size_t B{ ImplSpec::B };
 
+  using WaitStrategy = typename ImplSpec::WaitStrategy;
+  using CounterPolicy = typename ImplSpec::CounterPolicy;
+  using FlushPolicy = typename ImplSpec::FlushPolicy;
+
   using IntraDuct = uit::ThrowDuct<THIS_T>;
   using ThreadDuct = uit::ThrowDuct<THIS_T>;
 
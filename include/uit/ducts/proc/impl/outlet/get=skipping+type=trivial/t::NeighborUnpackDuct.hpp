@@ -0,0 +1,119 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_OUTLET_GET_SKIPPING_TYPE_TRIVIAL_T__NEIGHBORUNPACKDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_OUTLET_GET_SKIPPING_TYPE_TRIVIAL_T__NEIGHBORUNPACKDUCT_HPP_INCLUDE
+
+#include <limits>
+#include <memory>
+#include <stddef.h>
+#include <utility>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/optional.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/NeighborhoodBackEnd.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Unpacks values from its proc's neighborhood exchange rounds.
+ *
+ * Polling drives the proc's rounds forward. Only the latest value received
+ * is kept.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class NeighborUnpackDuct {
+
+public:
+
+  using BackEndImpl = uit::NeighborhoodBackEnd<ImplSpec>;
+
+private:
+
+  using T = typename ImplSpec::T;
+
+  const uit::InterProcAddress address;
+
+  std::shared_ptr<BackEndImpl> back_end;
+
+  emp::optional<size_t> slot;
+
+  size_t GetSlot() const {
+    if ( !slot.has_value() ) {
+      const_cast<NeighborUnpackDuct*>(this)->slot
+        = back_end->LookupOutletSlot( address );
+    }
+    return *slot;
+  }
+
+public:
+
+  NeighborUnpackDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end_
+  ) : address(address_)
+  , back_end(back_end_)
+  { back_end->RegisterOutletSlot( address ); }
+
+  [[noreturn]] bool TryPut(const T&) const {
+    emp_always_assert(false, "TryPut called on NeighborUnpackDuct");
+    __builtin_unreachable();
+  }
+
+  [[noreturn]] bool TryFlush() const {
+    emp_always_assert(false, "Flush called on NeighborUnpackDuct");
+    __builtin_unreachable();
+  }
+
+  /**
+   * TODO.
+   *
+   * @param num_requested TODO.
+   * @return number items consumed.
+   */
+  size_t TryConsumeGets(const size_t num_requested) {
+    emp_assert( num_requested == std::numeric_limits<size_t>::max() );
+    return back_end->TryConsumeGets( GetSlot() );
+  }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  const T& Get() const { return std::as_const(*back_end).Get( GetSlot() ); }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  T& Get() { return back_end->Get( GetSlot() ); }
+
+  static std::string GetName() { return "NeighborUnpackDuct"; }
+
+  static constexpr bool CanStep() { return false; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetName() << '\n';
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << '\n';
+    ss << uitsl::format_member("InterProcAddress address", address) << '\n';
+    return ss.str();
+  }
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_OUTLET_GET_SKIPPING_TYPE_TRIVIAL_T__NEIGHBORUNPACKDUCT_HPP_INCLUDE
@@ -0,0 +1,270 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_OUTLET_GET_STEPPING_TYPE_TRIVIAL_T__ADAPTIVERINGIRECVDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_OUTLET_GET_STEPPING_TYPE_TRIVIAL_T__ADAPTIVERINGIRECVDUCT_HPP_INCLUDE
+
+#include <algorithm>
+#include <memory>
+#include <stddef.h>
+#include <string>
+
+#include <mpi.h>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/vector.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/polyfill/span.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+#include "../../../../../../uitsl/datastructs/RingBuffer.hpp"
+#include "../../../../../../uitsl/debug/err_audit.hpp"
+#include "../../../../../../uitsl/meta/t::static_test.hpp"
+#include "../../../../../../uitsl/mpi/audited_routines.hpp"
+#include "../../../../../../uitsl/mpi/mpi_init_utils.hpp"
+#include "../../../../../../uitsl/nonce/AdaptiveDepth.hpp"
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/MockBackEnd.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Ring of receives whose depth adapts at runtime, up to `N`.
+ *
+ * Depth bounds posted plus received-but-unconsumed receives. Depth doubles
+ * whenever a get finds every slot laden and halves when the backlog of
+ * unconsumed receives stays well below it. Posted receives beyond depth
+ * are not canceled, just not reposted once consumed. Slots are allocated
+ * the first time depth calls for them.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class AdaptiveRingIrecvDuct {
+
+public:
+
+  using BackEndImpl = uit::MockBackEnd<ImplSpec>;
+
+private:
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::t::static_test<T>(), uitsl_t_message );
+  constexpr inline static size_t N{ImplSpec::N};
+
+  struct Slot {
+    T val;
+    MPI_Request request{ MPI_REQUEST_NULL };
+  };
+
+  // allocated on demand, addresses stay put while receives are posted
+  emp::vector<std::unique_ptr<Slot>> slots;
+  emp::vector<Slot*> free_slots;
+
+  // oldest at tail
+  uitsl::RingBuffer<Slot*, N> posted;
+  uitsl::RingBuffer<Slot*, N> received;
+
+  // value-initialized initial Get item
+  T current{};
+
+  uitsl::AdaptiveDepth<N> depth;
+
+  const uit::InterProcAddress address;
+
+  Slot& AcquireSlot() {
+    if ( free_slots.empty() ) {
+      return *slots.emplace_back( std::make_unique<Slot>() );
+    }
+    Slot& res = *free_slots.back();
+    free_slots.pop_back();
+    return res;
+  }
+
+  void PostReceiveRequests() {
+    while ( posted.GetSize() + received.GetSize() < depth.GetDepth() ) {
+      Slot& slot = AcquireSlot();
+
+      UITSL_Irecv(
+        &slot.val,
+        sizeof(T),
+        MPI_BYTE,
+        address.GetInletProc(),
+        address.GetTag(),
+        address.GetComm(),
+        &slot.request
+      );
+      emp_assert( !uitsl::test_null( slot.request ) );
+
+      uitsl_err_audit(!   posted.PushHead( &slot )   );
+    }
+  }
+
+  void CancelReceiveRequest() {
+    Slot& slot = *posted.GetPopTail();
+    emp_assert( !uitsl::test_null( slot.request ) );
+
+    UITSL_Cancel( &slot.request );
+    UITSL_Request_free( &slot.request );
+  }
+
+  // receives on the same source and tag match in posting order
+  void TryFulfillReceiveRequests() {
+    while (
+      posted.GetSize()
+      && uitsl::test_completion( posted.GetTail()->request )
+    ) uitsl_err_audit(!   received.PushHead( posted.GetPopTail() )   );
+  }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  size_t CountUnconsumedGets() {
+    TryFulfillReceiveRequests();
+
+    const size_t backlog = received.GetSize();
+    if ( posted.IsEmpty() && backlog >= depth.GetDepth() ) {
+      if ( depth.ReportSaturation() ) PostReceiveRequests();
+    } else depth.ReportOccupancy( backlog );
+
+    return backlog;
+  }
+
+  void ConsumeGet() {
+    Slot* const slot = received.GetPopTail();
+    current = slot->val;
+    free_slots.push_back( slot );
+  }
+
+public:
+
+  AdaptiveRingIrecvDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end
+  ) : address(address_) {
+    PostReceiveRequests();
+  }
+
+  ~AdaptiveRingIrecvDuct() {
+    while ( posted.GetSize() ) CancelReceiveRequest();
+  }
+
+  [[noreturn]] bool TryPut(const T&) const {
+    emp_always_assert(false, "TryPut called on AdaptiveRingIrecvDuct");
+    __builtin_unreachable();
+  }
+
+  /**
+   * TODO.
+   *
+   */
+  [[noreturn]] bool TryFlush() const {
+    emp_always_assert(false, "Flush called on AdaptiveRingIrecvDuct");
+    __builtin_unreachable();
+  }
+
+  /**
+   * TODO.
+   *
+   * @param num_requested TODO.
+   * @return number items consumed.
+   */
+  size_t TryConsumeGets(const size_t num_requested) {
+
+    size_t requested_countdown{ num_requested };
+    size_t batch_countdown{ CountUnconsumedGets() };
+    bool full_batch = (batch_countdown >= depth.GetDepth());
+
+    while ( batch_countdown && requested_countdown ) {
+
+      --batch_countdown;
+      --requested_countdown;
+      ConsumeGet();
+
+      if (batch_countdown == 0) {
+        PostReceiveRequests();
+        if (full_batch) {
+          batch_countdown = CountUnconsumedGets();
+          full_batch = (batch_countdown >= depth.GetDepth());
+        }
+      }
+    }
+    PostReceiveRequests();
+
+    return num_requested - requested_countdown;
+  }
+
+  /**
+   * Step through up to out.size() received values, copying each into out.
+   *
+   * @param out TODO.
+   * @return number of values copied.
+   */
+  size_t TryGetMany(const std::span<T> out) {
+
+    size_t num_got{};
+    size_t batch_countdown{ CountUnconsumedGets() };
+    bool full_batch = (batch_countdown >= depth.GetDepth());
+
+    while ( batch_countdown && num_got < out.size() ) {
+
+      --batch_countdown;
+      ConsumeGet();
+      out[num_got++] = current;
+
+      if (batch_countdown == 0) {
+        PostReceiveRequests();
+        if (full_batch) {
+          batch_countdown = CountUnconsumedGets();
+          full_batch = (batch_countdown >= depth.GetDepth());
+        }
+      }
+    }
+    PostReceiveRequests();
+
+    return num_got;
+  }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  const T& Get() const { return current; }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  T& Get() { return current; }
+
+  /**
+   * @return current maximum number of posted plus unconsumed receives.
+   */
+  size_t GetDepth() const { return depth.GetDepth(); }
+
+  static std::string GetName() { return "AdaptiveRingIrecvDuct"; }
+
+  static constexpr bool CanStep() { return true; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetName() << '\n';
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << '\n';
+    ss << uitsl::format_member("InterProcAddress address", address) << '\n';
+    ss << uitsl::format_member("size_t GetDepth()", GetDepth()) << '\n';
+    return ss.str();
+  }
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_OUTLET_GET_STEPPING_TYPE_TRIVIAL_T__ADAPTIVERINGIRECVDUCT_HPP_INCLUDE
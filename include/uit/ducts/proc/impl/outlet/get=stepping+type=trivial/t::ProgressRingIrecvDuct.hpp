@@ -0,0 +1,229 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_OUTLET_GET_STEPPING_TYPE_TRIVIAL_T__PROGRESSRINGIRECVDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_OUTLET_GET_STEPPING_TYPE_TRIVIAL_T__PROGRESSRINGIRECVDUCT_HPP_INCLUDE
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <stddef.h>
+#include <string>
+
+#include <mpi.h>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/array.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/optional.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/polyfill/span.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+#include "../../../../../../uitsl/meta/t::static_test.hpp"
+#include "../../../../../../uitsl/mpi/audited_routines.hpp"
+#include "../../../../../../uitsl/mpi/mpi_init_utils.hpp"
+#include "../../../../../../uitsl/mpi/ProgressEngine.hpp"
+#include "../../../../../../uitsl/parallel/cache_line.hpp"
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/MockBackEnd.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Ring of receives that are posted, completed, and reposted by the
+ * process-wide `uitsl::ProgressEngine` rather than by the getting thread.
+ *
+ * Completed slots are handed to the getting thread through an atomic
+ * counter, and consumed slots are handed back the same way, so gets make no
+ * MPI calls.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class ProgressRingIrecvDuct {
+
+public:
+
+  using BackEndImpl = uit::MockBackEnd<ImplSpec>;
+
+private:
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::t::static_test<T>(), uitsl_t_message );
+  constexpr inline static size_t N{ImplSpec::N};
+
+  emp::array<T, N> data;
+
+  // owned by progress thread
+  emp::array<MPI_Request, N> requests;
+  size_t num_posted{};
+
+  // written only by progress thread
+  alignas(uitsl::CACHE_LINE_SIZE) std::atomic<size_t> num_received{};
+
+  // written only by getting thread
+  alignas(uitsl::CACHE_LINE_SIZE) std::atomic<size_t> num_consumed{};
+
+  // value-initialized initial Get item
+  T current{};
+
+  const uit::InterProcAddress address;
+
+  const uitsl::ProgressEngine::task_t progress_task{
+    [this](){ return Progress(); }
+  };
+  emp::optional<uitsl::ProgressEngine::Registration> registration;
+
+  void PostReceive(const size_t slot) {
+    UITSL_Irecv(
+      &data[slot],
+      sizeof(T),
+      MPI_BYTE,
+      address.GetInletProc(),
+      address.GetTag(),
+      address.GetComm(),
+      &requests[slot]
+    );
+    emp_assert( !uitsl::test_null( requests[slot] ) );
+  }
+
+  // called from progress thread, returns whether anything was posted or
+  // completed
+  bool Progress() {
+    // repost into slots the getting thread has handed back
+    const size_t consumed = num_consumed.load( std::memory_order_acquire );
+    const size_t prev_posted = num_posted;
+    for (; num_posted < consumed + N; ++num_posted) {
+      PostReceive( num_posted % N );
+    }
+
+    // receives on the same source and tag match in posting order
+    const size_t prev_received = num_received.load(std::memory_order_relaxed);
+    size_t received = prev_received;
+    while (
+      received < num_posted
+      && uitsl::test_completion( requests[received % N] )
+    ) ++received;
+    num_received.store( received, std::memory_order_release );
+
+    return num_posted != prev_posted || received != prev_received;
+  }
+
+  size_t CountUnconsumedGets() const {
+    return num_received.load( std::memory_order_acquire )
+      - num_consumed.load( std::memory_order_relaxed );
+  }
+
+public:
+
+  ProgressRingIrecvDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end
+  ) : address(address_) {
+    if ( uitsl::get_rank( address.GetComm() ) == address.GetOutletProc() ) {
+      registration.emplace( progress_task );
+    }
+  }
+
+  ~ProgressRingIrecvDuct() {
+    // wait out any sweep in progress, then take over the requests
+    registration.reset();
+    for (size_t i = num_received; i < num_posted; ++i) {
+      auto& request = requests[i % N];
+      if ( !uitsl::test_completion( request ) ) {
+        UITSL_Cancel( &request );
+        UITSL_Request_free( &request );
+      }
+    }
+  }
+
+  [[noreturn]] bool TryPut(const T&) const {
+    emp_always_assert(false, "TryPut called on ProgressRingIrecvDuct");
+    __builtin_unreachable();
+  }
+
+  /**
+   * TODO.
+   *
+   */
+  [[noreturn]] bool TryFlush() const {
+    emp_always_assert(false, "Flush called on ProgressRingIrecvDuct");
+    __builtin_unreachable();
+  }
+
+  /**
+   * TODO.
+   *
+   * @param num_requested TODO.
+   * @return number items consumed.
+   */
+  size_t TryConsumeGets(const size_t num_requested) {
+    const size_t num_stepped = std::min(
+      num_requested, CountUnconsumedGets()
+    );
+    if ( num_stepped == 0 ) return 0;
+
+    const size_t consumed = num_consumed.load( std::memory_order_relaxed );
+    current = data[ (consumed + num_stepped - 1) % N ];
+    num_consumed.store( consumed + num_stepped, std::memory_order_release );
+    uitsl::ProgressEngine::Get().Wake();
+
+    return num_stepped;
+  }
+
+  /**
+   * Step through up to out.size() received values, copying each into out.
+   *
+   * All copied slots are handed back to the progress thread at once.
+   *
+   * @param out TODO.
+   * @return number of values copied.
+   */
+  size_t TryGetMany(const std::span<T> out) {
+    const size_t num_got = std::min( out.size(), CountUnconsumedGets() );
+    if ( num_got == 0 ) return 0;
+
+    const size_t consumed = num_consumed.load( std::memory_order_relaxed );
+    for (size_t i = 0; i < num_got; ++i) out[i] = data[(consumed + i) % N];
+    current = out[num_got - 1];
+    num_consumed.store( consumed + num_got, std::memory_order_release );
+    uitsl::ProgressEngine::Get().Wake();
+
+    return num_got;
+  }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  const T& Get() const { return current; }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  T& Get() { return current; }
+
+  static std::string GetName() { return "ProgressRingIrecvDuct"; }
+
+  static constexpr bool CanStep() { return true; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetName() << '\n';
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << '\n';
+    ss << uitsl::format_member("InterProcAddress address", address) << '\n';
+    return ss.str();
+  }
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_OUTLET_GET_STEPPING_TYPE_TRIVIAL_T__PROGRESSRINGIRECVDUCT_HPP_INCLUDE
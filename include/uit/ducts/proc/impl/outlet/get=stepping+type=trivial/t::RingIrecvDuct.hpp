@@ -11,6 +11,7 @@
 
 #include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
 #include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/polyfill/span.hpp"
 #include "../../../../../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
 
 #include "../../../../../../uitsl/datastructs/RingBuffer.hpp"
@@ -198,6 +199,37 @@ public:
     return num_consumed;
   }
 
+  /**
+   * Step through up to out.size() received values, copying each into out.
+   *
+   * Receive requests are tested once per batch of up to N values rather
+   * than once per value.
+   *
+   * @param out TODO.
+   * @return number of values copied.
+   */
+  size_t TryGetMany(const std::span<T> out) {
+
+    size_t num_got{};
+    size_t batch_countdown{ CountUnconsumedGets() };
+    bool full_batch = (batch_countdown == N);
+
+    while ( batch_countdown && num_got < out.size() ) {
+
+      --batch_countdown;
+      uitsl_err_audit(!   data.PopTail()   );
+      out[num_got++] = data.GetTail();
+      PostReceiveRequest();
+
+      if (full_batch && batch_countdown == 0) {
+        batch_countdown = CountUnconsumedGets();
+        full_batch = (batch_countdown == N);
+      }
+    }
+
+    return num_got;
+  }
+
   /**
    * TODO.
    *
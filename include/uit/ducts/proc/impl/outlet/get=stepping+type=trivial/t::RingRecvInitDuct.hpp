@@ -0,0 +1,177 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_OUTLET_GET_STEPPING_TYPE_TRIVIAL_T__RINGRECVINITDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_OUTLET_GET_STEPPING_TYPE_TRIVIAL_T__RINGRECVINITDUCT_HPP_INCLUDE
+
+#include <memory>
+#include <stddef.h>
+#include <string>
+
+#include <mpi.h>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/array.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/polyfill/span.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+#include "../../../../../../uitsl/meta/t::static_test.hpp"
+#include "../../../../../../uitsl/mpi/audited_routines.hpp"
+#include "../../../../../../uitsl/mpi/mpi_init_utils.hpp"
+#include "../../../../../../uitsl/mpi/request_utils.hpp"
+#include "../../../../../../uitsl/nonce/CircularIndex.hpp"
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/MockBackEnd.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Ring of persistent receive requests, one per buffer slot.
+ *
+ * Each slot's receive is initialized once at construction and started
+ * immediately. Consuming a slot copies its value out then restarts that
+ * slot's request, so the MPI library skips per-message request setup.
+ * Slots are restarted in ring order, so messages land in ring order.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class RingRecvInitDuct {
+
+public:
+
+  using BackEndImpl = uit::MockBackEnd<ImplSpec>;
+
+private:
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::t::static_test<T>(), uitsl_t_message );
+  constexpr inline static size_t N{ImplSpec::N};
+
+  emp::array<T, N> buffer;
+  emp::array<MPI_Request, N> requests;
+
+  // oldest slot, whose receive will complete next
+  uitsl::CircularIndex<N> tail{};
+
+  // current get item
+  T cache{};
+
+  const uit::InterProcAddress address;
+
+  /**
+   * Copy out the tail slot's value if its receive has completed, then
+   * restart it.
+   *
+   * @return true if a value was received.
+   */
+  bool TryConsumeTail() {
+    if ( !uitsl::test_completion( requests[tail] ) ) return false;
+
+    cache = buffer[tail];
+    UITSL_Start( &requests[tail] );
+    ++tail;
+    return true;
+  }
+
+public:
+
+  RingRecvInitDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end
+  ) : address(address_) {
+    for (size_t i = 0; i < N; ++i) UITSL_Recv_init(
+      &buffer[i], // void *buf
+      sizeof(T), // int count
+      MPI_BYTE, // MPI_Datatype datatype
+      address.GetInletProc(), // int source
+      address.GetTag(), // int tag
+      address.GetComm(), // MPI_Comm comm
+      &requests[i] // MPI_Request *request
+    );
+    UITSL_Startall( N, requests.data() );
+  }
+
+  ~RingRecvInitDuct() {
+    while ( TryConsumeGets( N ) );
+    for (auto& request : requests) {
+      emp_assert( !uitsl::test_null( request ) );
+      UITSL_Cancel( &request );
+      UITSL_Request_free( &request );
+    }
+  }
+
+  [[noreturn]] bool TryPut(const T&) const {
+    emp_always_assert(false, "TryPut called on RingRecvInitDuct");
+    __builtin_unreachable();
+  }
+
+  /**
+   * TODO.
+   *
+   */
+  [[noreturn]] bool TryFlush() const {
+    emp_always_assert(false, "Flush called on RingRecvInitDuct");
+    __builtin_unreachable();
+  }
+
+  /**
+   * TODO.
+   *
+   * @param num_requested TODO.
+   * @return number items consumed.
+   */
+  size_t TryConsumeGets(const size_t num_requested) {
+    size_t num_consumed{};
+    while ( num_consumed < num_requested && TryConsumeTail() ) ++num_consumed;
+    return num_consumed;
+  }
+
+  /**
+   * Step through up to out.size() received values, copying each into out.
+   *
+   * @param out TODO.
+   * @return number of values copied.
+   */
+  size_t TryGetMany(const std::span<T> out) {
+    size_t num_got{};
+    while ( num_got < out.size() && TryConsumeTail() ) out[num_got++] = cache;
+    return num_got;
+  }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  const T& Get() const { return cache; }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  T& Get() { return cache; }
+
+  static std::string GetName() { return "RingRecvInitDuct"; }
+
+  static constexpr bool CanStep() { return true; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetName() << '\n';
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << '\n';
+    ss << uitsl::format_member("InterProcAddress address", address) << '\n';
+    return ss.str();
+  }
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_OUTLET_GET_STEPPING_TYPE_TRIVIAL_T__RINGRECVINITDUCT_HPP_INCLUDE
@@ -0,0 +1,145 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_IMPL_OUTLET_GET_STEPPING_TYPE_TRIVIAL_T__SHMPOPDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_IMPL_OUTLET_GET_STEPPING_TYPE_TRIVIAL_T__SHMPOPDUCT_HPP_INCLUDE
+
+#include <algorithm>
+#include <memory>
+#include <stddef.h>
+
+#include "../../../../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/polyfill/span.hpp"
+#include "../../../../../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+#include "../../../../../../uitsl/meta/t::static_test.hpp"
+#include "../../../../../../uitsl/mpi/mpi_init_utils.hpp"
+#include "../../../../../../uitsl/utility/print_utils.hpp"
+
+#include "../../../../../setup/InterProcAddress.hpp"
+
+#include "../../backend/ShmBackEnd.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Pops from a shared memory ring that the inlet proc pushes into.
+ *
+ * The most recently consumed value is copied out of the ring before its
+ * slot is released, so `Get` stays valid while the inlet proc keeps
+ * pushing.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class ShmPopDuct {
+
+public:
+
+  using BackEndImpl = uit::ShmBackEnd<ImplSpec>;
+
+private:
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::t::static_test<T>(), uitsl_t_message );
+
+  T cache{};
+
+  const uit::InterProcAddress address;
+
+  std::shared_ptr<typename BackEndImpl::ring_t> ring;
+
+public:
+
+  ShmPopDuct(
+    const uit::InterProcAddress& address_,
+    std::shared_ptr<BackEndImpl> back_end
+  ) : address(address_)
+  , ring(
+    uitsl::get_rank(address.GetComm()) == address.GetOutletProc()
+      ? back_end->AcquireOutletRing(address)
+      : nullptr
+  ) { ; }
+
+  [[noreturn]] bool TryPut(const T&) const {
+    emp_always_assert(false, "TryPut called on ShmPopDuct");
+    __builtin_unreachable();
+  }
+
+  /**
+   * TODO.
+   *
+   */
+  [[noreturn]] bool TryFlush() const {
+    emp_always_assert(false, "Flush called on ShmPopDuct");
+    __builtin_unreachable();
+  }
+
+  /**
+   * TODO.
+   *
+   * @param requested TODO.
+   * @return number items consumed.
+   */
+  size_t TryConsumeGets(const size_t requested) {
+    emp_assert( ring && ring->IsInitialized() );
+
+    const size_t num_consumed = std::min( requested, ring->GetSize() );
+    if ( num_consumed ) {
+      cache = ring->Get( num_consumed - 1 );
+      ring->PopTail( num_consumed );
+    }
+    return num_consumed;
+  }
+
+  /**
+   * Step through up to out.size() values with a single copy out of the ring.
+   *
+   * @param out TODO.
+   * @return number of values copied.
+   */
+  size_t TryGetMany(const std::span<T> out) {
+    emp_assert( ring && ring->IsInitialized() );
+
+    const size_t num_got = std::min( out.size(), ring->GetSize() );
+    if ( num_got ) {
+      ring->CopyTail( out.first(num_got) );
+      cache = out[num_got - 1];
+      ring->PopTail( num_got );
+    }
+    return num_got;
+  }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  const T& Get() const { return cache; }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  T& Get() { return cache; }
+
+  static std::string GetName() { return "ShmPopDuct"; }
+
+  static constexpr bool CanStep() { return true; }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetName() << '\n';
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << '\n';
+    ss << uitsl::format_member("InterProcAddress address", address) << '\n';
+    return ss.str();
+  }
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_IMPL_OUTLET_GET_STEPPING_TYPE_TRIVIAL_T__SHMPOPDUCT_HPP_INCLUDE
@@ -81,7 +81,7 @@ public:
   size_t TryConsumeGets(const size_t num_requested) {
 
     if (!pool.has_value()) SetupPool();
-    return pool->get().TryConsumeGets(num_requested, address);
+    return pool->get().TryConsumeGets(num_requested, pool_index, address);
 
   }
 
@@ -0,0 +1,38 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_SKIPPING_TYPE_TRIVIAL_INLET_NEIGHBORPACK_OUTLET_NEIGHBORUNPACK_T__INPONUDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_PUT_DROPPING_GET_SKIPPING_TYPE_TRIVIAL_INLET_NEIGHBORPACK_OUTLET_NEIGHBORUNPACK_T__INPONUDUCT_HPP_INCLUDE
+
+#include <type_traits>
+
+#include "../impl/inlet/put=dropping+type=trivial/t::NeighborPackDuct.hpp"
+#include "../impl/outlet/get=skipping+type=trivial/t::NeighborUnpackDuct.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Inter-process duct for bulk-synchronous meshes, moving all of a proc's
+ * inter-process edges in one neighborhood collective per step.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+struct InpOnuDuct {
+
+  using InletImpl = uit::t::NeighborPackDuct<ImplSpec>;
+  using OutletImpl = uit::t::NeighborUnpackDuct<ImplSpec>;
+
+  static_assert(std::is_same<
+    typename InletImpl::BackEndImpl,
+    typename OutletImpl::BackEndImpl
+  >::value);
+
+  using BackEndImpl = typename InletImpl::BackEndImpl;
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_SKIPPING_TYPE_TRIVIAL_INLET_NEIGHBORPACK_OUTLET_NEIGHBORUNPACK_T__INPONUDUCT_HPP_INCLUDE
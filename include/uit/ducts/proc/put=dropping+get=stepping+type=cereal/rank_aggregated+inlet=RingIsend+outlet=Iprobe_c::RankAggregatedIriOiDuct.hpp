@@ -0,0 +1,50 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_STEPPING_TYPE_CEREAL_RANK_AGGREGATED_INLET_RINGISEND_OUTLET_IPROBE_C__RANKAGGREGATEDIRIOIDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_PUT_DROPPING_GET_STEPPING_TYPE_CEREAL_RANK_AGGREGATED_INLET_RINGISEND_OUTLET_IPROBE_C__RANKAGGREGATEDIRIOIDUCT_HPP_INCLUDE
+
+#include <type_traits>
+
+#include "../impl/backend/RankAggregatedBackEnd.hpp"
+#include "../impl/inlet/templated/AggregatedInletDuct.hpp"
+#include "../impl/outlet/templated/AggregatedOutletDuct.hpp"
+
+#include "inlet=RingIsend+outlet=Iprobe_c::IriOiDuct.hpp"
+
+namespace uit {
+namespace c {
+
+/**
+ * Aggregates all messages between a pair of procs, across threads, into
+ * messages sent through a `uit::c::IriOiDuct`.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class RankAggregatedIriOiDuct {
+
+  template<typename Spec>
+  using BackingDuct = uit::c::IriOiDuct<Spec>;
+
+public:
+
+  using InletImpl = uit::AggregatedInletDuct<
+    BackingDuct, ImplSpec, uit::RankAggregatedBackEnd
+  >;
+  using OutletImpl = uit::AggregatedOutletDuct<
+    BackingDuct, ImplSpec, uit::RankAggregatedBackEnd
+  >;
+
+  static_assert(std::is_same<
+    typename InletImpl::BackEndImpl,
+    typename OutletImpl::BackEndImpl
+  >::value);
+
+  using BackEndImpl = typename InletImpl::BackEndImpl;
+
+};
+
+} // namespace c
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_STEPPING_TYPE_CEREAL_RANK_AGGREGATED_INLET_RINGISEND_OUTLET_IPROBE_C__RANKAGGREGATEDIRIOIDUCT_HPP_INCLUDE
@@ -0,0 +1,37 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_STEPPING_TYPE_TRIVIAL_INLET_ADAPTIVERINGISEND_OUTLET_ADAPTIVERINGIRECV_T__IARIOARIDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_PUT_DROPPING_GET_STEPPING_TYPE_TRIVIAL_INLET_ADAPTIVERINGISEND_OUTLET_ADAPTIVERINGIRECV_T__IARIOARIDUCT_HPP_INCLUDE
+
+#include <type_traits>
+
+#include "../impl/inlet/put=dropping+type=trivial/t::AdaptiveRingIsendDuct.hpp"
+#include "../impl/outlet/get=stepping+type=trivial/t::AdaptiveRingIrecvDuct.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * TODO
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+struct IariOariDuct {
+
+  using InletImpl = uit::t::AdaptiveRingIsendDuct<ImplSpec>;
+  using OutletImpl = uit::t::AdaptiveRingIrecvDuct<ImplSpec>;
+
+  static_assert(std::is_same<
+    typename InletImpl::BackEndImpl,
+    typename OutletImpl::BackEndImpl
+  >::value);
+
+  using BackEndImpl = typename InletImpl::BackEndImpl;
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_STEPPING_TYPE_TRIVIAL_INLET_ADAPTIVERINGISEND_OUTLET_ADAPTIVERINGIRECV_T__IARIOARIDUCT_HPP_INCLUDE
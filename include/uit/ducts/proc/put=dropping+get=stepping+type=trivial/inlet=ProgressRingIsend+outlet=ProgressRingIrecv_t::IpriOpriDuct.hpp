@@ -0,0 +1,37 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_STEPPING_TYPE_TRIVIAL_INLET_PROGRESSRINGISEND_OUTLET_PROGRESSRINGIRECV_T__IPRIOPRIDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_PUT_DROPPING_GET_STEPPING_TYPE_TRIVIAL_INLET_PROGRESSRINGISEND_OUTLET_PROGRESSRINGIRECV_T__IPRIOPRIDUCT_HPP_INCLUDE
+
+#include <type_traits>
+
+#include "../impl/inlet/put=dropping+type=trivial/t::ProgressRingIsendDuct.hpp"
+#include "../impl/outlet/get=stepping+type=trivial/t::ProgressRingIrecvDuct.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * TODO
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+struct IpriOpriDuct {
+
+  using InletImpl = uit::t::ProgressRingIsendDuct<ImplSpec>;
+  using OutletImpl = uit::t::ProgressRingIrecvDuct<ImplSpec>;
+
+  static_assert(std::is_same<
+    typename InletImpl::BackEndImpl,
+    typename OutletImpl::BackEndImpl
+  >::value);
+
+  using BackEndImpl = typename InletImpl::BackEndImpl;
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_STEPPING_TYPE_TRIVIAL_INLET_PROGRESSRINGISEND_OUTLET_PROGRESSRINGIRECV_T__IPRIOPRIDUCT_HPP_INCLUDE
@@ -0,0 +1,38 @@
+#pragma once
+#ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_STEPPING_TYPE_TRIVIAL_INLET_SHMPUSH_OUTLET_SHMPOP_T__ISPOSPDUCT_HPP_INCLUDE
+#define UIT_DUCTS_PROC_PUT_DROPPING_GET_STEPPING_TYPE_TRIVIAL_INLET_SHMPUSH_OUTLET_SHMPOP_T__ISPOSPDUCT_HPP_INCLUDE
+
+#include <type_traits>
+
+#include "../impl/inlet/put=dropping+type=trivial/t::ShmPushDuct.hpp"
+#include "../impl/outlet/get=stepping+type=trivial/t::ShmPopDuct.hpp"
+
+namespace uit {
+namespace t {
+
+/**
+ * Inter-process duct for procs on the same node, transmitting through a
+ * shared memory ring instead of MPI.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+struct IspOspDuct {
+
+  using InletImpl = uit::t::ShmPushDuct<ImplSpec>;
+  using OutletImpl = uit::t::ShmPopDuct<ImplSpec>;
+
+  static_assert(std::is_same<
+    typename InletImpl::BackEndImpl,
+    typename OutletImpl::BackEndImpl
+  >::value);
+
+  using BackEndImpl = typename InletImpl::BackEndImpl;
+
+};
+
+} // namespace t
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_PROC_PUT_DROPPING_GET_STEPPING_TYPE_TRIVIAL_INLET_SHMPUSH_OUTLET_SHMPOP_T__ISPOSPDUCT_HPP_INCLUDE
@@ -25,7 +25,8 @@ class AtomicPendingDuct
 : public uit::internal::PendingDuct<
   uitsl::AlignedInherit<std::atomic<size_t>>,
   uitsl::AlignedImplicit<typename ImplSpec::T>,
-  ImplSpec
+  ImplSpec,
+  typename ImplSpec::WaitStrategy
 >
 {
 
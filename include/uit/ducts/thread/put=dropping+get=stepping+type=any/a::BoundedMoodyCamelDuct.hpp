@@ -2,12 +2,14 @@
 #ifndef UIT_DUCTS_THREAD_PUT_DROPPING_GET_STEPPING_TYPE_ANY_A__BOUNDEDMOODYCAMELDUCT_HPP_INCLUDE
 #define UIT_DUCTS_THREAD_PUT_DROPPING_GET_STEPPING_TYPE_ANY_A__BOUNDEDMOODYCAMELDUCT_HPP_INCLUDE
 
+#include <algorithm>
 #include <mutex>
 #include <stddef.h>
 #include <string>
 
 #include "../../../../../third-party/Empirical/include/emp/base/assert.hpp"
 #include "../../../../../third-party/Empirical/include/emp/base/errors.hpp"
+#include "../../../../../third-party/Empirical/include/emp/polyfill/span.hpp"
 #include "../../../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
 #include "../../../../../third-party/readerwriterqueue/atomicops.h"
 #include "../../../../../third-party/readerwriterqueue/readerwriterqueue.h"
@@ -74,6 +76,24 @@ public:
     else return false;
   }
 
+  /**
+   * Put as many leading values from vals as there is room for.
+   *
+   * Available capacity is checked once for the whole batch.
+   *
+   * @param vals TODO.
+   * @return number of values accepted.
+   */
+  size_t TryPutMany(const std::span<const T> vals) {
+    uitsl_occupancy_audit(1);
+    const size_t capacity = IsReadyForPut()
+      ? N - CountUnconsumedGets()
+      : 0;
+    const size_t num_put = std::min( vals.size(), capacity );
+    for (size_t i = 0; i < num_put; ++i) queue.enqueue( vals[i] );
+    return num_put;
+  }
+
   /**
    * TODO.
    *
@@ -92,6 +112,24 @@ public:
     return num_consumed;
   }
 
+  /**
+   * Step through up to out.size() values, copying each into out.
+   *
+   * Available values are counted once for the whole batch.
+   *
+   * @param out TODO.
+   * @return number of values copied.
+   */
+  size_t TryGetMany(const std::span<T> out) {
+    uitsl_occupancy_audit(1);
+    const size_t num_got = std::min( out.size(), CountUnconsumedGets() );
+    for (size_t i = 0; i < num_got; ++i) {
+      queue.pop();
+      out[i] = Get();
+    }
+    return num_got;
+  }
+
   /**
    * TODO.
    *
@@ -2,12 +2,14 @@
 #ifndef UIT_DUCTS_THREAD_PUT_DROPPING_GET_STEPPING_TYPE_ANY_A__RIGTORPDUCT_HPP_INCLUDE
 #define UIT_DUCTS_THREAD_PUT_DROPPING_GET_STEPPING_TYPE_ANY_A__RIGTORPDUCT_HPP_INCLUDE
 
+#include <algorithm>
 #include <mutex>
 #include <stddef.h>
 #include <string>
 
 #include "../../../../../third-party/Empirical/include/emp/base/assert.hpp"
 #include "../../../../../third-party/Empirical/include/emp/base/errors.hpp"
+#include "../../../../../third-party/Empirical/include/emp/polyfill/span.hpp"
 #include "../../../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
 #include "../../../../../third-party/SPSCQueue/include/rigtorp/SPSCQueue.h"
 
@@ -32,6 +34,8 @@ class RigtorpDuct {
   static_assert( uitsl::a::static_test<T>(), uitsl_a_message );
   constexpr inline static size_t N{ImplSpec::N};
 
+  using wait_strategy_t = typename ImplSpec::WaitStrategy;
+
   rigtorp::SPSCQueue<T> queue{N};
 
   using pending_t = uitsl::RelaxedAtomic<size_t>;
@@ -67,8 +71,11 @@ public:
    * @param val TODO.
    */
   bool TryPut(const T& val) {
-    if (IsReadyForPut()) { queue.push( val ); return true; }
-    else return false;
+    if (IsReadyForPut()) {
+      queue.push( val );
+      wait_strategy_t::Notify(this);
+      return true;
+    } else return false;
   }
 
   /**
@@ -78,8 +85,30 @@ public:
    */
   template<typename P>
   bool TryPut(P&& val) {
-    if (IsReadyForPut()) { queue.push( std::forward<P>(val) ); return true; }
-    else return false;
+    if (IsReadyForPut()) {
+      queue.push( std::forward<P>(val) );
+      wait_strategy_t::Notify(this);
+      return true;
+    } else return false;
+  }
+
+  /**
+   * Put as many leading values from vals as there is room for.
+   *
+   * Available capacity is checked once for the whole batch.
+   *
+   * @param vals TODO.
+   * @return number of values accepted.
+   */
+  size_t TryPutMany(const std::span<const T> vals) {
+    uitsl_occupancy_audit(1);
+    const size_t capacity = IsReadyForPut()
+      ? N - 1 - CountUnconsumedGets()
+      : 0;
+    const size_t num_put = std::min( vals.size(), capacity );
+    for (size_t i = 0; i < num_put; ++i) queue.push( vals[i] );
+    if ( num_put ) wait_strategy_t::Notify(this);
+    return num_put;
   }
 
   /**
@@ -97,10 +126,30 @@ public:
     uitsl_occupancy_audit(1);
     const size_t num_consumed = std::min( requested, CountUnconsumedGets() );
     for (size_t i = 0; i < num_consumed; ++i) queue.pop();
+    if ( num_consumed ) wait_strategy_t::Notify(this);
     return num_consumed;
 
   }
 
+  /**
+   * Step through up to out.size() values, copying each into out.
+   *
+   * Available values are counted once for the whole batch.
+   *
+   * @param out TODO.
+   * @return number of values copied.
+   */
+  size_t TryGetMany(const std::span<T> out) {
+    uitsl_occupancy_audit(1);
+    const size_t num_got = std::min( out.size(), CountUnconsumedGets() );
+    for (size_t i = 0; i < num_got; ++i) {
+      queue.pop();
+      out[i] = Get();
+    }
+    if ( num_got ) wait_strategy_t::Notify(this);
+    return num_got;
+  }
+
   /**
    * TODO.
    *
@@ -124,6 +173,8 @@ public:
 
   static constexpr bool CanStep() { return true; }
 
+  static constexpr bool CanNotify() { return true; }
+
   /**
    * TODO.
    *
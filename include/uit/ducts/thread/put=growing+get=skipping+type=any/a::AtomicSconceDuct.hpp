@@ -39,7 +39,8 @@ public:
 
   AtomicSconceDuct() {
     static const uitsl::WarnOnce warning{
-      "AtomicSconceDuct is experimental and may not be reliable"
+      "AtomicSconceDuct is experimental and may not be reliable, "
+      "consider TripleBufferDuct instead"
     };
   }
 
@@ -0,0 +1,161 @@
+#pragma once
+#ifndef UIT_DUCTS_THREAD_PUT_GROWING_GET_SKIPPING_TYPE_ANY_A__TRIPLEBUFFERDUCT_HPP_INCLUDE
+#define UIT_DUCTS_THREAD_PUT_GROWING_GET_SKIPPING_TYPE_ANY_A__TRIPLEBUFFERDUCT_HPP_INCLUDE
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <stddef.h>
+#include <string>
+#include <utility>
+
+#include "../../../../../third-party/Empirical/include/emp/base/array.hpp"
+#include "../../../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+#include "../../../../uitsl/meta/a::static_test.hpp"
+#include "../../../../uitsl/parallel/cache_line.hpp"
+#include "../../../../uitsl/parallel/RelaxedAtomic.hpp"
+#include "../../../../uitsl/utility/print_utils.hpp"
+
+namespace uit {
+namespace a {
+
+/**
+ * Wait-free latest-value handoff between one putting and one getting
+ * thread.
+ *
+ * Three buffers rotate between the putter, the getter, and a shared middle
+ * slot. A put writes into the putter's buffer then swaps it into the middle
+ * with a single atomic exchange. A get that finds a fresh middle buffer
+ * swaps it for the getter's buffer the same way. Only buffer indices change
+ * hands, so `Get` refers into the getter's buffer without copying, and
+ * neither side ever reads or writes a buffer the other side holds.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ * implementation details for the conduit framework.
+ */
+template<typename ImplSpec>
+class TripleBufferDuct {
+
+  using T = typename ImplSpec::T;
+  static_assert( uitsl::a::static_test<T>(), uitsl_a_message );
+
+  // low bits hold a buffer index, fresh bit marks an unread put
+  using state_t = unsigned char;
+  constexpr inline static state_t index_mask{ 0b011 };
+  constexpr inline static state_t fresh_bit{ 0b100 };
+
+  emp::array<T, 3> buffers{};
+
+  // owned by putting thread
+  alignas(uitsl::CACHE_LINE_SIZE) state_t put_index{ 0 };
+
+  alignas(uitsl::CACHE_LINE_SIZE) std::atomic<state_t> middle{ 1 };
+  uitsl::RelaxedAtomic<size_t> updates_since_last_get;
+
+  // owned by getting thread
+  alignas(uitsl::CACHE_LINE_SIZE) state_t get_index{ 2 };
+
+  void Publish() {
+    put_index = middle.exchange(
+      put_index | fresh_bit, std::memory_order_acq_rel
+    ) & index_mask;
+    ++updates_since_last_get;
+    ImplSpec::WaitStrategy::Notify(this);
+  }
+
+public:
+
+  /**
+   * TODO.
+   *
+   * @param val TODO.
+   */
+  bool TryPut(const T& val) {
+    buffers[put_index] = val;
+    Publish();
+    return true;
+  }
+
+  /**
+   * TODO.
+   *
+   * @param val TODO.
+   */
+  template<typename P>
+  bool TryPut(P&& val) {
+    buffers[put_index] = std::forward<P>(val);
+    Publish();
+    return true;
+  }
+
+  /**
+   * TODO.
+   *
+   */
+  bool TryFlush() const { return true; }
+
+  /**
+   * Adopt the latest put value, if there is one that hasn't been gotten.
+   *
+   * @param requested must be std::numeric_limits<size_t>::max().
+   * @return number of puts skipped over, at least one if a fresh value was
+   * adopted.
+   */
+  size_t TryConsumeGets(const size_t requested) {
+    emp_assert( requested == std::numeric_limits<size_t>::max() );
+
+    if ( !(middle.load( std::memory_order_relaxed ) & fresh_bit) ) return 0;
+
+    get_index = middle.exchange(
+      get_index, std::memory_order_acq_rel
+    ) & index_mask;
+
+    // counter may trail the exchange, so charge stragglers to the next get
+    return std::max<size_t>( updates_since_last_get.exchange(0), 1 );
+  }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  const T& Get() const { return buffers[get_index]; }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  T& Get() { return buffers[get_index]; }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  static std::string GetType() { return "TripleBufferDuct"; }
+
+  static constexpr bool CanStep() { return false; }
+
+  static constexpr bool CanNotify() { return true; }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << GetType() << '\n';
+    ss << uitsl::format_member("this", static_cast<const void *>(this)) << '\n';
+    return ss.str();
+  }
+
+};
+
+} // namespace a
+} // namespace uit
+
+#endif // #ifndef UIT_DUCTS_THREAD_PUT_GROWING_GET_SKIPPING_TYPE_ANY_A__TRIPLEBUFFERDUCT_HPP_INCLUDE
@@ -79,6 +79,21 @@ public:
   , outlet(duct)
   { ; }
 
+  /**
+   * Allocator-extended forwarding constructor.
+   *
+   * Allocate the `Duct` with alloc, e.g., so that many `Duct`s share a
+   * `uitsl::Slab`. Remaining arguments are forwarded as above.
+   */
+  template <typename Alloc, typename... Args>
+  Conduit(std::allocator_arg_t, Alloc&& alloc, Args&&... args) : duct(
+    std::allocate_shared<internal::Duct<ImplSpec>>(
+      alloc, std::forward<Args>(args)...
+    )
+  ), inlet(duct)
+  , outlet(duct)
+  { ; }
+
   /**
    * Adaptor for structured bindings as interface to access `Conduit`'s `Inlet`
    * or `Outlet`.
@@ -0,0 +1,123 @@
+#pragma once
+#ifndef UIT_SETUP_COUNTERPOLICY_HPP_INCLUDE
+#define UIT_SETUP_COUNTERPOLICY_HPP_INCLUDE
+
+#include <algorithm>
+#include <stddef.h>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+namespace uit {
+
+/**
+ * Counter policy that records every `Inlet` and `Outlet` operation in their
+ * instrumentation counters.
+ *
+ * A counter policy decides which operations update an `Inlet`'s or
+ * `Outlet`'s instrumentation counters. Each counter holds its own instance,
+ * through `PolicyCounter`. `Sample` is called once per increment, and if it
+ * returns true the increment is recorded as though it had happened `weight`
+ * times.
+ */
+struct FullCounters {
+
+  static constexpr bool enabled{ true };
+
+  static constexpr size_t weight{ 1 };
+
+  static constexpr bool Sample() { return true; }
+
+};
+
+/**
+ * Counter policy that records nothing, leaving instrumentation counters at
+ * their initial values.
+ *
+ * Bookkeeping compiles away entirely, so `Inlet` and `Outlet` operations
+ * reduce to the underlying `Duct` calls.
+ */
+struct NoCounters {
+
+  static constexpr bool enabled{ false };
+
+  static constexpr size_t weight{ 0 };
+
+  static constexpr bool Sample() { return false; }
+
+};
+
+/**
+ * Counter policy that records only every Kth increment, scaled up by K.
+ *
+ * Counters estimate what `FullCounters` would report, at roughly a Kth of
+ * the bookkeeping cost.
+ *
+ * @tparam K sampling period.
+ */
+template<size_t K>
+class SampledCounters {
+
+  static_assert( K > 0 );
+
+  size_t countdown{ K };
+
+public:
+
+  static constexpr bool enabled{ true };
+
+  static constexpr size_t weight{ K };
+
+  bool Sample() {
+    if ( --countdown ) return false;
+    countdown = K;
+    return true;
+  }
+
+};
+
+/**
+ * Instrumentation counter whose increments are recorded as CounterPolicy
+ * samples them.
+ *
+ * Each counter samples its own increments, so how often one counter is
+ * bumped never decides which increments another records. Under
+ * `SampledCounters<K>`, a counter bumped by one at a time stays within K of
+ * what `FullCounters` would report.
+ *
+ * @tparam CounterPolicy `FullCounters`, `NoCounters`, or `SampledCounters`.
+ */
+template<typename CounterPolicy>
+class PolicyCounter : private CounterPolicy {
+
+  size_t value;
+
+public:
+
+  explicit PolicyCounter(const size_t initial=0) : value( initial ) { ; }
+
+  void Add(const size_t amount=1) {
+    if constexpr ( CounterPolicy::enabled ) {
+      if ( amount && CounterPolicy::Sample() ) {
+        value += CounterPolicy::weight * amount;
+      }
+    }
+  }
+
+  size_t Get() const { return value; }
+
+  /**
+   * Count of this counter's increments not also counted by subset.
+   *
+   * Sampled counters estimate independently, so subset's estimate may
+   * overtake this one's, in which case the difference is zero.
+   */
+  size_t Minus(const PolicyCounter& subset) const {
+    emp_assert( CounterPolicy::weight != 1 || value >= subset.value );
+    return value - std::min( value, subset.value );
+  }
+
+};
+
+} // namespace uit
+
+#endif // #ifndef UIT_SETUP_COUNTERPOLICY_HPP_INCLUDE
@@ -0,0 +1,101 @@
+#pragma once
+#ifndef UIT_SETUP_FLUSHPOLICY_HPP_INCLUDE
+#define UIT_SETUP_FLUSHPOLICY_HPP_INCLUDE
+
+#include <limits>
+#include <stddef.h>
+
+#include "../../../third-party/Empirical/include/emp/base/optional.hpp"
+
+#include "../../uitsl/chrono/CoarseClock.hpp"
+
+namespace uit {
+
+/**
+ * Flush policy that sends a pooled or aggregated batch only once every
+ * member has contributed to it.
+ *
+ * A flush policy decides when an `InletMemoryPool` or
+ * `InletMemoryAggregator` may send its batch before every member has
+ * contributed. Each pool or aggregator holds its own instance.
+ * `ShouldFlush` is called after each contribution to an incomplete batch
+ * with the number of bytes the batch would send, i.e., raw entries for a
+ * pool or encoded records, headers included, for an aggregate. If it
+ * returns true, the batch is sent at once. Missing members' pool entries go
+ * out marked stale, and their outlets count no new get. Missing members are
+ * left out of an aggregate. `Reset` is called whenever a batch is sent.
+ */
+struct FullFlush {
+
+  static constexpr bool enabled{ false };
+
+  static constexpr bool ShouldFlush(const size_t) { return false; }
+
+  static constexpr void Reset() { }
+
+};
+
+/**
+ * Flush policy that also sends a batch once it reaches MaxBytes, or once
+ * MaxSeconds have passed since its first contribution, so that fast members
+ * wait a bounded time on lagging ones.
+ *
+ * Deadlines are timed with `uitsl::CoarseClock`, which ticks once a second.
+ * They are only checked when a member puts to a pool or flushes to an
+ * aggregator, so a batch whose members have all gone quiet is not sent
+ * until one of them next does.
+ *
+ * @tparam MaxBytes size threshold, in bytes.
+ * @tparam MaxSeconds deadline, in seconds. By default, there is none.
+ */
+template<
+  size_t MaxBytes,
+  size_t MaxSeconds=std::numeric_limits<size_t>::max()
+>
+class BoundedFlush {
+
+  constexpr inline static bool has_deadline{
+    MaxSeconds != std::numeric_limits<size_t>::max()
+  };
+
+  // when the pending batch received its first contribution
+  emp::optional<uitsl::CoarseClock::time_point> opened;
+
+  bool IsOverdue() {
+    const auto now = uitsl::CoarseClock::now();
+    if ( !opened.has_value() ) opened = now;
+
+    // coarse clock isn't steady, so elapsed time may be negative
+    const auto elapsed = ( now - *opened ).count();
+    return elapsed >= 0 && static_cast<size_t>( elapsed ) >= MaxSeconds;
+  }
+
+public:
+
+  static constexpr bool enabled{ true };
+
+  bool ShouldFlush(const size_t num_bytes) {
+    if ( num_bytes >= MaxBytes ) return true;
+    if constexpr ( has_deadline ) return IsOverdue();
+    else return false;
+  }
+
+  void Reset() { opened.reset(); }
+
+};
+
+/**
+ * Flush policy that also sends a batch once MaxSeconds have passed since
+ * its first contribution.
+ *
+ * @tparam MaxSeconds deadline, in seconds.
+ */
+template<size_t MaxSeconds>
+using DeadlineFlush = BoundedFlush<
+  std::numeric_limits<size_t>::max(),
+  MaxSeconds
+>;
+
+} // namespace uit
+
+#endif // #ifndef UIT_SETUP_FLUSHPOLICY_HPP_INCLUDE
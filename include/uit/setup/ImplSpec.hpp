@@ -13,12 +13,17 @@ template<
   typename T_,
   typename ImplSelect,
   size_t N_,
-  size_t B_
+  size_t B_,
+  typename WaitStrategy_,
+  typename CounterPolicy_,
+  typename FlushPolicy_
 >
 class ImplSpecKernel {
 
   /// TODO.
-  using THIS_T = ImplSpecKernel<T_, ImplSelect, N_, B_>;
+  using THIS_T = ImplSpecKernel<
+    T_, ImplSelect, N_, B_, WaitStrategy_, CounterPolicy_, FlushPolicy_
+  >;
 
 public:
 
@@ -31,6 +36,15 @@ public:
   /// TODO.
   constexpr inline static size_t B{ B_ };
 
+  /// How blocking operations wait and how thread ducts wake waiters.
+  using WaitStrategy = WaitStrategy_;
+
+  /// Which operations inlets and outlets record in instrumentation counters.
+  using CounterPolicy = CounterPolicy_;
+
+  /// When pooled and aggregated ducts send without waiting on every member.
+  using FlushPolicy = FlushPolicy_;
+
   /// TODO.
   using IntraDuct = typename ImplSelect::template IntraDuct<THIS_T>;
 
@@ -65,6 +79,14 @@ public:
  * @tparam N Buffer size.
  * @tparam B For buffered or aggregated ducts,
  * maximum number of items to buffer.
+ * @tparam WaitStrategy How blocking `Put`, `Flush`, and `Step` calls wait
+ * between attempts, e.g., `uitsl::SpinWait` or `uitsl::ParkingWait`.
+ * @tparam CounterPolicy Which `Inlet` and `Outlet` operations update
+ * instrumentation counters, e.g., `uit::FullCounters`, `uit::NoCounters`, or
+ * `uit::SampledCounters<K>`.
+ * @tparam FlushPolicy When pooled or aggregated ducts may send a batch
+ * before every member has contributed, e.g., `uit::FullFlush` or
+ * `uit::BoundedFlush<MaxBytes, MaxSeconds>`.
  *
  */
 template<
@@ -73,12 +95,15 @@ template<
   template<typename> typename SpoutWrapper=uit::DefaultSpoutWrapper,
   size_t N=uit::DEFAULT_BUFFER,
   size_t B=std::numeric_limits<size_t>::max(),
-  size_t SpoutCacheSize_=2
+  size_t SpoutCacheSize_=2,
+  typename WaitStrategy=uit::DefaultWaitStrategy,
+  typename CounterPolicy=uit::DefaultCounterPolicy,
+  typename FlushPolicy=uit::DefaultFlushPolicy
 >
 class ImplSpec
 : public internal::ImplSpecKernel<
   typename SpoutWrapper<T>::T,
-  ImplSelect, N, B
+  ImplSelect, N, B, WaitStrategy, CounterPolicy, FlushPolicy
 > {
 
   using wrapper_t = SpoutWrapper<T>;
@@ -8,6 +8,11 @@
 #include "../ducts/thread/put=dropping+get=stepping+type=any/a::AtomicPendingDuct.hpp"
 #include "../spouts/wrappers/TrivialSpoutWrapper.hpp"
 
+#include "../../uitsl/parallel/SpinWait.hpp"
+
+#include "CounterPolicy.hpp"
+#include "FlushPolicy.hpp"
+
 namespace uit {
 
 constexpr static size_t DEFAULT_BUFFER = 64;
@@ -27,6 +32,12 @@ using DefaultProcDuct = uit::t::IriOriDuct<Spec>;
 template<typename Spec>
 using DefaultMockDuct = uit::NopDuct<Spec>;
 
+using DefaultWaitStrategy = uitsl::SpinWait;
+
+using DefaultCounterPolicy = uit::FullCounters;
+
+using DefaultFlushPolicy = uit::FullFlush;
+
 } // namespace uit
 
 #endif // #ifndef UIT_SETUP_DEFAULTS_HPP_INCLUDE
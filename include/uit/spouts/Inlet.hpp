@@ -7,13 +7,19 @@
 #include <iostream>
 #include <memory>
 #include <stddef.h>
+#include <type_traits>
 #include <utility>
 
+#include "../../../third-party/Empirical/include/emp/polyfill/span.hpp"
+
 #include "../../uitsl/debug/occupancy_audit.hpp"
 #include "../../uitsl/nonce/CircularIndex.hpp"
 #include "../../uitsl/utility/print_utils.hpp"
 
 #include "../ducts/Duct.hpp"
+#include "../setup/CounterPolicy.hpp"
+
+#include "PinnedInlet.hpp"
 
 namespace uit {
 
@@ -58,6 +64,8 @@ namespace uit {
 template<typename ImplSpec_>
 class Inlet {
 
+  template<typename, typename> friend class PinnedInlet;
+
 public:
   using ImplSpec = ImplSpec_;
 
@@ -65,30 +73,47 @@ private:
   using T = typename ImplSpec::T;
   constexpr inline static size_t N{ ImplSpec::N };
 
+  using wait_strategy_t = typename ImplSpec::WaitStrategy;
+
   using index_t = uitsl::CircularIndex<N>;
 
   /// TODO.
   using duct_t = internal::Duct<ImplSpec>;
   std::shared_ptr<duct_t> duct;
 
+  /// Decides which operations update instrumentation counters.
+  using counter_policy_t = typename ImplSpec::CounterPolicy;
+  using counter_t = PolicyCounter<counter_policy_t>;
+
   /// How many blocking put operations have been performed?
   /// Instrumentation for communication profiling.
-  size_t blocking_put_count{};
+  counter_t blocking_put_count{};
 
   /// How many nonblocking try put operations have been attempted?
   /// Instrumentation for communication profiling.
-  size_t attempted_try_put_count{};
+  counter_t attempted_try_put_count{};
 
   /// How many times has Put blocked?
   /// Instrumentation for communication profiling.
-  size_t puts_that_blocked_count{};
+  counter_t puts_that_blocked_count{};
 
   // How many TryPut calls have dropped?
   /// Instrumentation for communication profiling.
-  size_t dropped_put_count{};
+  counter_t dropped_put_count{};
 
   uitsl_occupancy_auditor;
 
+  void LogPut(const bool was_blocked) {
+    blocking_put_count.Add();
+    puts_that_blocked_count.Add( was_blocked );
+  }
+
+  bool LogTryPut(const bool succeeded) {
+    attempted_try_put_count.Add();
+    dropped_put_count.Add( !succeeded );
+    return succeeded;
+  }
+
   /**
    * TODO.
    *
@@ -124,11 +149,16 @@ public:
   void Put(const T& val) {
     uitsl_occupancy_audit(1);
 
-    ++blocking_put_count;
     bool was_blocked{ false };
-    while (!DoTryPut(val)) was_blocked = true;
+    wait_strategy_t::Until(
+      [this, &val, &was_blocked](){
+        if ( DoTryPut(val) ) return true;
+        else { was_blocked = true; return false; }
+      },
+      duct->GetWaitKey()
+    );
 
-    puts_that_blocked_count += was_blocked;
+    LogPut( was_blocked );
 
   }
 
@@ -141,9 +171,7 @@ public:
   bool TryPut(const T& val) {
     uitsl_occupancy_audit(1);
 
-    ++attempted_try_put_count;
-    if ( DoTryPut(val) ) return true;
-    else { ++dropped_put_count; return false; }
+    return LogTryPut( DoTryPut(val) );
 
   }
 
@@ -157,9 +185,50 @@ public:
   bool TryPut(P&& val) {
     uitsl_occupancy_audit(1);
 
-    ++attempted_try_put_count;
-    if ( DoTryPut(std::forward<P>(val)) ) return true;
-    else { ++dropped_put_count; return false; }
+    return LogTryPut( DoTryPut(std::forward<P>(val)) );
+
+  }
+
+  // non-blocking
+  /**
+   * Make one attempt at a blocking put that a scheduler retries, e.g.,
+   * `netuit::NodeScheduler::AwaitPut`, instead of blocking on it.
+   *
+   * Refused attempts aren't counted. Once an attempt succeeds, the put counts
+   * as one blocking put, which blocked if it was a retry.
+   *
+   * @param val value to put.
+   * @param is_retry whether an earlier attempt at this put was refused.
+   * @return whether val was accepted.
+   */
+  bool TryResumePut(const T& val, const bool is_retry) {
+    uitsl_occupancy_audit(1);
+
+    const bool succeeded = DoTryPut(val);
+    if ( succeeded ) LogPut( is_retry );
+    return succeeded;
+
+  }
+
+  // non-blocking
+  /**
+   * Attempt to put a contiguous batch of values, in order.
+   *
+   * Dispatches to the underlying `Duct` once for the whole batch. Each value
+   * counts as one attempted try put. Values that follow the first refused
+   * value are not attempted and count as dropped.
+   *
+   * @param vals values to put.
+   * @return number of leading values from `vals` that were accepted.
+   */
+  size_t TryPutMany(const std::span<const T> vals) {
+    uitsl_occupancy_audit(1);
+
+    const size_t num_put = duct->TryPutMany(vals);
+    emp_assert( num_put <= vals.size() );
+    attempted_try_put_count.Add( vals.size() );
+    dropped_put_count.Add( vals.size() - num_put );
+    return num_put;
 
   }
 
@@ -173,7 +242,11 @@ public:
    * TODO.
    *
    */
-  void Flush() { while( !TryFlush() ); }
+  void Flush() {
+    wait_strategy_t::Until(
+      [this](){ return TryFlush(); }, duct->GetWaitKey()
+    );
+  }
 
   /**
    * TODO.
@@ -181,7 +254,7 @@ public:
    * @return TODO.
    */
   size_t GetNumPutsAttempted() const {
-    return attempted_try_put_count + blocking_put_count;
+    return attempted_try_put_count.Get() + blocking_put_count.Get();
   }
 
   /**
@@ -190,7 +263,7 @@ public:
    * @return TODO.
    */
   size_t GetNumTryPutsAttempted() const {
-    return attempted_try_put_count;
+    return attempted_try_put_count.Get();
   }
 
   /**
@@ -199,7 +272,7 @@ public:
    * @return TODO.
    */
   size_t GetNumBlockingPuts() const {
-    return blocking_put_count;
+    return blocking_put_count.Get();
   }
 
   /**
@@ -208,8 +281,7 @@ public:
    * @return TODO.
    */
   size_t GetNumTryPutsThatSucceeded() const {
-    emp_assert( attempted_try_put_count >= dropped_put_count );
-    return attempted_try_put_count - dropped_put_count;
+    return attempted_try_put_count.Minus( dropped_put_count );
   }
 
   /**
@@ -218,7 +290,7 @@ public:
    * @return TODO.
    */
   size_t GetNumPutsThatSucceededEventually() const {
-    return blocking_put_count + GetNumTryPutsThatSucceeded();
+    return blocking_put_count.Get() + GetNumTryPutsThatSucceeded();
   }
 
   /**
@@ -227,8 +299,7 @@ public:
    * @return TODO.
    */
   size_t GetNumBlockingPutsThatSucceededImmediately() const {
-    emp_assert( blocking_put_count >= puts_that_blocked_count );
-    return blocking_put_count - puts_that_blocked_count;
+    return blocking_put_count.Minus( puts_that_blocked_count );
   }
 
   /**
@@ -248,14 +319,16 @@ public:
    *
    * @return TODO.
    */
-  size_t GetNumPutsThatBlocked() const { return puts_that_blocked_count; }
+  size_t GetNumPutsThatBlocked() const {
+    return puts_that_blocked_count.Get();
+  }
 
   /**
    * TODO.
    *
    * @return TODO.
    */
-  size_t GetNumDroppedPuts() const { return dropped_put_count; }
+  size_t GetNumDroppedPuts() const { return dropped_put_count.Get(); }
 
   /**
    * TODO.
@@ -263,7 +336,8 @@ public:
    * @return TODO.
    */
   double GetFractionTryPutsDropped() const {
-    return dropped_put_count / static_cast<double>( attempted_try_put_count );
+    return dropped_put_count.Get()
+      / static_cast<double>( attempted_try_put_count.Get() );
   }
 
   /**
@@ -281,7 +355,8 @@ public:
    * @return TODO.
    */
   double GetFractionBlockingPutsThatBlocked() const {
-    return puts_that_blocked_count / static_cast<double>( blocking_put_count );
+    return puts_that_blocked_count.Get()
+      / static_cast<double>( blocking_put_count.Get() );
   }
 
   /**
@@ -339,6 +414,7 @@ public:
    */
   template <typename WhichDuct, typename... Args>
   void SplitDuct(Args&&... args) {
+    emp_assert( !IsFrozen(), "cannot split frozen Inlet" );
     duct = std::make_shared<duct_t>(
       std::in_place_type_t<WhichDuct>{},
       std::forward<Args>(args)...
@@ -352,6 +428,57 @@ public:
    */
   typename duct_t::uid_t GetDuctUID() const { return duct->GetUID(); }
 
+  /**
+   * Lock the underlying `Duct`'s active implementation in place.
+   *
+   * Required before calling `Pin` or `VisitPinned`. After freezing,
+   * `EmplaceDuct` and `SplitDuct` may no longer be called.
+   */
+  void Freeze() { duct->Freeze(); }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  bool IsFrozen() const { return duct->IsFrozen(); }
+
+  /**
+   * Get a handle that calls directly into the underlying `Duct`'s active
+   * implementation, bypassing variant dispatch.
+   *
+   * @tparam WhichDuct active implementation type, which must be known.
+   * @return handle sharing this `Inlet`'s instrumentation.
+   */
+  template <typename WhichDuct>
+  PinnedInlet<ImplSpec, WhichDuct> Pin() {
+    emp_assert( IsFrozen() );
+    return { *this, duct->template GetImpl<WhichDuct>() };
+  }
+
+  /**
+   * Call visitor with a `PinnedInlet` typed on the underlying `Duct`'s
+   * active implementation.
+   *
+   * Variant dispatch is performed once, here, so a hot loop placed inside
+   * visitor pays none.
+   *
+   * @param visitor callable accepting any `PinnedInlet` by value.
+   * @return result of calling visitor.
+   */
+  template <typename Visitor>
+  decltype(auto) VisitPinned(Visitor&& visitor) {
+    emp_assert( IsFrozen() );
+    return duct->VisitImpl(
+      [this, &visitor](auto& impl) -> decltype(auto) {
+        using impl_t = typename std::decay<decltype(impl)>::type;
+        return std::forward<Visitor>(visitor)(
+          PinnedInlet<ImplSpec, impl_t>{ *this, impl }
+        );
+      }
+    );
+  }
+
   emp::optional<bool> HoldsIntraImpl() const { return duct->HoldsIntraImpl(); }
 
   emp::optional<bool> HoldsThreadImpl() const {
@@ -362,6 +489,12 @@ public:
 
   std::string WhichImplHeld() const { return duct->WhichImplHeld(); }
 
+  /// Exact count of values transferred through the duct's proc
+  /// implementation, see `Duct::GetNumProcTransfers`.
+  size_t GetNumProcTransfers() const { return duct->GetNumProcTransfers(); }
+
+  const void* GetReadyKey() const { return duct->GetReadyKey(); }
+
   void RegisterInletProc(const uitsl::proc_id_t proc) const {
     duct->RegisterInletProc(proc);
   }
@@ -434,19 +567,19 @@ public:
     ss << uitsl::format_member("duct_t duct", *duct) << '\n';
     ss << uitsl::format_member(
       "size_t attempted_try_put_count",
-      attempted_try_put_count
+      attempted_try_put_count.Get()
     ) << '\n';
     ss << uitsl::format_member(
       "size_t blocking_put_count",
-      blocking_put_count
+      blocking_put_count.Get()
     ) << '\n';
     ss << uitsl::format_member(
       "size_t dropped_put_count",
-      dropped_put_count
+      dropped_put_count.Get()
     ) << '\n';
     ss << uitsl::format_member(
       "size_t puts_that_blocked_count",
-      puts_that_blocked_count
+      puts_that_blocked_count.Get()
     );
     return ss.str();
   }
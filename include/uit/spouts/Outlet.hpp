@@ -7,15 +7,20 @@
 #include <limits>
 #include <memory>
 #include <stddef.h>
+#include <type_traits>
 #include <utility>
 
 #include "../../../third-party/Empirical/include/emp/base/optional.hpp"
+#include "../../../third-party/Empirical/include/emp/polyfill/span.hpp"
 
 #include "../../uitsl/debug/occupancy_audit.hpp"
 #include "../../uitsl/nonce/CircularIndex.hpp"
 #include "../../uitsl/parallel/thread_utils.hpp"
 
 #include "../ducts/Duct.hpp"
+#include "../setup/CounterPolicy.hpp"
+
+#include "PinnedOutlet.hpp"
 
 namespace uit {
 
@@ -61,6 +66,8 @@ namespace uit {
 template<typename ImplSpec_>
 class Outlet {
 
+  template<typename, typename> friend class PinnedOutlet;
+
 public:
   using ImplSpec = ImplSpec_;
 
@@ -68,6 +75,8 @@ private:
   using T = typename ImplSpec::T;
   constexpr inline static size_t N{ImplSpec::N};
 
+  using wait_strategy_t = typename ImplSpec::WaitStrategy;
+
   using index_t = uitsl::CircularIndex<N>;
 
   using duct_t = internal::Duct<ImplSpec>;
@@ -76,9 +85,13 @@ private:
   // TODO move this to ImplSpec?
   static_assert(N > 0);
 
+  /// Decides which operations update instrumentation counters.
+  using counter_policy_t = typename ImplSpec::CounterPolicy;
+  using counter_t = PolicyCounter<counter_policy_t>;
+
   /// How many times has outlet been read from?
   /// Instrumentation for communication profiling.
-  mutable size_t read_count{0};
+  mutable counter_t read_count{};
 
   /// Has the current revision been viewed?
   /// Instrumentation for communication profiling.
@@ -86,32 +99,32 @@ private:
 
   /// How many unique revisions have been read?
   /// Instrumentation for communication profiling.
-  mutable size_t fresh_read_count{0};
+  mutable counter_t fresh_read_count{};
 
   /// How many times has current value changed (i.e., a pull succeeded)?
   /// Instrumentation for communication profiling.
   /// Start at 1 to account for default-constructed initial value.
-  size_t revision_count{1};
+  counter_t revision_count{1};
 
   /// Total distance traversed through underlying buffer.
   /// Instrumentation for communication profiling.
-  size_t net_flux{0};
+  counter_t net_flux{};
 
   /// Number of times try_step or jump was called.
   /// Instrumentation for communication profiling.
-  size_t nonblocking_pull_attempt_count{0};
+  counter_t nonblocking_pull_attempt_count{};
 
   /// Number of times nonblocking pull retrieved a fresh value.
   /// Instrumentation for communication profiling.
-  size_t laden_nonblocking_pull_count{0};
+  counter_t laden_nonblocking_pull_count{};
 
   /// Number of times step was called.
   /// Instrumentation for communication profiling.
-  size_t blocking_pull_count{0};
+  counter_t blocking_pull_count{};
 
   /// Number of times step blocked.
   /// Instrumentation for communication profiling.
-  size_t pulls_that_blocked_count{0};
+  counter_t pulls_that_blocked_count{};
 
   uitsl_occupancy_auditor;
 
@@ -131,16 +144,46 @@ private:
    * @param n TODO.
    */
   size_t LogStep(const size_t n) {
-    revision_count += (n > 0);
-    if (n > 0) cur_revision_unread = true;
-    net_flux += n;
+    revision_count.Add( n > 0 );
+    net_flux.Add( n );
+    if constexpr ( counter_policy_t::enabled ) {
+      if (n > 0) cur_revision_unread = true;
+    }
     return n;
   }
 
   void LogRead() const {
-    ++read_count;
-    fresh_read_count += cur_revision_unread;
-    cur_revision_unread = false;
+    read_count.Add();
+    fresh_read_count.Add( cur_revision_unread );
+    if constexpr ( counter_policy_t::enabled ) cur_revision_unread = false;
+  }
+
+  size_t LogTryStep(const size_t n) {
+    nonblocking_pull_attempt_count.Add();
+    laden_nonblocking_pull_count.Add( n > 0 );
+    return n;
+  }
+
+  /**
+   * Log a batch get that stepped onto and read n values.
+   *
+   * Bookkeeping matches the equivalent sequence of `GetNextOrNullopt` calls,
+   * including the final unladen attempt if the batch was cut short.
+   *
+   * @param n number of values stepped onto and read.
+   * @param requested number of values requested.
+   */
+  size_t LogBatchGet(const size_t n, const size_t requested) {
+    nonblocking_pull_attempt_count.Add( n + (n < requested) );
+    laden_nonblocking_pull_count.Add( n );
+    revision_count.Add( n );
+    net_flux.Add( n );
+    read_count.Add( n );
+    fresh_read_count.Add( n );
+    if constexpr ( counter_policy_t::enabled ) {
+      if (n > 0) cur_revision_unread = false;
+    }
+    return n;
   }
 
 public:
@@ -153,16 +196,29 @@ public:
   ) : duct(duct_) { ; }
 
   size_t TryStep(const size_t num_steps=1) {
-    ++nonblocking_pull_attempt_count;
-    const size_t res = TryConsumeGets(num_steps);
-    if ( res ) ++laden_nonblocking_pull_count;
-    return res;
+    return LogTryStep( TryConsumeGets(num_steps) );
   }
 
   size_t Jump() {
     return TryStep( std::numeric_limits<size_t>::max() );
   }
 
+  /**
+   * Step through up to `out.size()` received values, copying each into `out`.
+   *
+   * Non-blocking. Dispatches to the underlying `Duct` once for the whole
+   * batch. Afterwards, `Get` refers to the last value copied into `out`.
+   *
+   * @param out destination for received values.
+   * @return number of values written to the front of `out`.
+   */
+  size_t TryGetMany(const std::span<T> out) {
+    uitsl_occupancy_audit(1);
+    const size_t res = duct->TryGetMany(out);
+    emp_assert( res <= out.size() );
+    return LogBatchGet(res, out.size());
+  }
+
   /**
    * TODO.
    *
@@ -197,18 +253,22 @@ public:
    */
   void Step(size_t num_steps=1) {
     uitsl_occupancy_audit(1);
-    blocking_pull_count += num_steps;
+    blocking_pull_count.Add( num_steps );
 
     while (num_steps) {
       size_t uncounted_steps{};
       bool was_blocked{ false };
-      do {
-        uncounted_steps = TryConsumeGets(num_steps);
-        was_blocked |= (uncounted_steps == 0);
-      } while ( uncounted_steps == 0 );
+      wait_strategy_t::Until(
+        [&](){
+          uncounted_steps = TryConsumeGets(num_steps);
+          was_blocked |= (uncounted_steps == 0);
+          return uncounted_steps != 0;
+        },
+        duct->GetWaitKey()
+      );
 
       num_steps -= uncounted_steps;
-      pulls_that_blocked_count += was_blocked;
+      pulls_that_blocked_count.Add( was_blocked );
     }
 
   }
@@ -246,14 +306,16 @@ public:
    *
    * @return TODO.
    */
-  size_t GetNumReadsPerformed() const { return read_count; }
+  size_t GetNumReadsPerformed() const { return read_count.Get(); }
 
   /**
    * TODO.
    *
    * @return TODO.
    */
-  size_t GetNumReadsThatWereFresh() const { return fresh_read_count; }
+  size_t GetNumReadsThatWereFresh() const {
+    return fresh_read_count.Get();
+  }
 
   /**
    * TODO.
@@ -261,8 +323,7 @@ public:
    * @return TODO.
    */
   size_t GetNumReadsThatWereStale() const {
-    emp_assert( read_count >= fresh_read_count );
-    return read_count - fresh_read_count;
+    return read_count.Minus( fresh_read_count );
   }
 
   /**
@@ -270,7 +331,7 @@ public:
    *
    * @return TODO.
    */
-  size_t GetNumRevisionsPulled() const { return revision_count; }
+  size_t GetNumRevisionsPulled() const { return revision_count.Get(); }
 
   /**
    * TODO.
@@ -278,7 +339,7 @@ public:
    * @return TODO.
    */
   size_t GetNumTryPullsAttempted() const {
-    return nonblocking_pull_attempt_count;
+    return nonblocking_pull_attempt_count.Get();
   }
 
   /**
@@ -287,7 +348,7 @@ public:
    * @return TODO.
    */
   size_t GetNumBlockingPulls() const {
-    return blocking_pull_count;
+    return blocking_pull_count.Get();
   }
 
   /**
@@ -296,7 +357,7 @@ public:
    * @return TODO.
    */
   size_t GetNumBlockingPullsThatBlocked() const {
-    return pulls_that_blocked_count;
+    return pulls_that_blocked_count.Get();
   }
 
   /**
@@ -306,7 +367,7 @@ public:
    * @return TODO.
    */
   size_t GetNumRevisionsFromTryPulls() const {
-    return laden_nonblocking_pull_count;
+    return laden_nonblocking_pull_count.Get();
   }
 
   /**
@@ -315,8 +376,7 @@ public:
    * @return TODO.
    */
   size_t GetNumRevisionsFromBlockingPulls() const {
-    emp_assert(revision_count >= GetNumRevisionsFromTryPulls());
-    return revision_count - GetNumRevisionsFromTryPulls();
+    return revision_count.Minus( laden_nonblocking_pull_count );
   }
 
   /**
@@ -325,7 +385,7 @@ public:
    * @return TODO.
    */
   size_t GetNumPullsAttempted() const {
-    return nonblocking_pull_attempt_count + blocking_pull_count;
+    return nonblocking_pull_attempt_count.Get() + blocking_pull_count.Get();
   }
 
   /**
@@ -343,8 +403,7 @@ public:
    * @return TODO.
    */
   size_t GetNumBlockingPullsThatWereLadenImmediately() const {
-    emp_assert( GetNumBlockingPulls() >= GetNumBlockingPullsThatBlocked() );
-    return GetNumBlockingPulls() - GetNumBlockingPullsThatBlocked();
+    return blocking_pull_count.Minus( pulls_that_blocked_count );
   }
 
   /**
@@ -374,7 +433,7 @@ public:
    */
 
   size_t GetNumTryPullsThatWereLaden() const {
-    return laden_nonblocking_pull_count;
+    return laden_nonblocking_pull_count.Get();
   }
 
   /**
@@ -383,8 +442,9 @@ public:
    * @return TODO.
    */
   size_t GetNumTryPullsThatWereUnladen() const {
-    emp_assert(nonblocking_pull_attempt_count >= laden_nonblocking_pull_count);
-    return nonblocking_pull_attempt_count - laden_nonblocking_pull_count;
+    return nonblocking_pull_attempt_count.Minus(
+      laden_nonblocking_pull_count
+    );
   }
 
   /**
@@ -466,7 +526,7 @@ public:
    *
    * @return TODO.
    */
-  size_t GetNetFluxThroughDuct() const { return net_flux; }
+  size_t GetNetFluxThroughDuct() const { return net_flux.Get(); }
 
   /**
    * TODO.
@@ -474,7 +534,7 @@ public:
    * @return TODO.
    */
   double GetFractionReadsThatWereFresh() const {
-    return fresh_read_count / static_cast<double>(read_count);
+    return fresh_read_count.Get() / static_cast<double>(read_count.Get());
   }
 
   /**
@@ -492,7 +552,8 @@ public:
    * @return TODO.
    */
   double GetFractionRevisionsThatWereRead() const {
-    return fresh_read_count / static_cast<double>(revision_count);
+    return fresh_read_count.Get()
+      / static_cast<double>(revision_count.Get());
   }
 
   /**
@@ -510,7 +571,7 @@ public:
    * @return TODO.
    */
   double GetFractionDuctFluxThatWasSteppedThrough() const {
-    return revision_count / static_cast<double>(net_flux);
+    return revision_count.Get() / static_cast<double>(net_flux.Get());
   }
 
   /**
@@ -528,7 +589,7 @@ public:
    * @return TODO.
    */
   double GetFractionDuctFluxThatWasRead() const {
-    return fresh_read_count / static_cast<double>(net_flux);
+    return fresh_read_count.Get() / static_cast<double>(net_flux.Get());
   }
 
   /**
@@ -552,6 +613,7 @@ public:
    */
   template <typename WhichDuct, typename... Args>
   void SplitDuct(Args&&... args) {
+    emp_assert( !IsFrozen(), "cannot split frozen Outlet" );
     duct = std::make_shared<duct_t>(
       std::in_place_type_t<WhichDuct>{},
       std::forward<Args>(args)...
@@ -565,6 +627,57 @@ public:
    */
   typename duct_t::uid_t GetDuctUID() const { return duct->GetUID(); }
 
+  /**
+   * Lock the underlying `Duct`'s active implementation in place.
+   *
+   * Required before calling `Pin` or `VisitPinned`. After freezing,
+   * `EmplaceDuct` and `SplitDuct` may no longer be called.
+   */
+  void Freeze() { duct->Freeze(); }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  bool IsFrozen() const { return duct->IsFrozen(); }
+
+  /**
+   * Get a handle that calls directly into the underlying `Duct`'s active
+   * implementation, bypassing variant dispatch.
+   *
+   * @tparam WhichDuct active implementation type, which must be known.
+   * @return handle sharing this `Outlet`'s instrumentation.
+   */
+  template <typename WhichDuct>
+  PinnedOutlet<ImplSpec, WhichDuct> Pin() {
+    emp_assert( IsFrozen() );
+    return { *this, duct->template GetImpl<WhichDuct>() };
+  }
+
+  /**
+   * Call visitor with a `PinnedOutlet` typed on the underlying `Duct`'s
+   * active implementation.
+   *
+   * Variant dispatch is performed once, here, so a hot loop placed inside
+   * visitor pays none.
+   *
+   * @param visitor callable accepting any `PinnedOutlet` by value.
+   * @return result of calling visitor.
+   */
+  template <typename Visitor>
+  decltype(auto) VisitPinned(Visitor&& visitor) {
+    emp_assert( IsFrozen() );
+    return duct->VisitImpl(
+      [this, &visitor](auto& impl) -> decltype(auto) {
+        using impl_t = typename std::decay<decltype(impl)>::type;
+        return std::forward<Visitor>(visitor)(
+          PinnedOutlet<ImplSpec, impl_t>{ *this, impl }
+        );
+      }
+    );
+  }
+
   emp::optional<bool> HoldsIntraImpl() const { return duct->HoldsIntraImpl(); }
 
   emp::optional<bool> HoldsThreadImpl() const {
@@ -575,8 +688,14 @@ public:
 
   std::string WhichImplHeld() const { return duct->WhichImplHeld(); }
 
+  /// Exact count of values transferred through the duct's proc
+  /// implementation, see `Duct::GetNumProcTransfers`.
+  size_t GetNumProcTransfers() const { return duct->GetNumProcTransfers(); }
+
   bool CanStep() const { return duct->CanStep(); }
 
+  const void* GetReadyKey() const { return duct->GetReadyKey(); }
+
   // exclusively for instrumentation purposes
   void RegisterInletProc(const uitsl::proc_id_t proc) const {
     duct->RegisterInletProc(proc);
@@ -651,9 +770,13 @@ public:
   std::string ToString() const {
     std::stringstream ss;
     ss << uitsl::format_member("std::shared_ptr<duct_t> duct", *duct) << '\n';
-    ss << uitsl::format_member("size_t read_count", read_count) << '\n';
-    ss << uitsl::format_member("size_t revision_count", revision_count) << '\n';
-    ss << uitsl::format_member("size_t net_flux", net_flux);
+    ss << uitsl::format_member(
+      "size_t read_count", read_count.Get()
+    ) << '\n';
+    ss << uitsl::format_member(
+      "size_t revision_count", revision_count.Get()
+    ) << '\n';
+    ss << uitsl::format_member("size_t net_flux", net_flux.Get());
     return ss.str();
   }
 
@@ -0,0 +1,153 @@
+#pragma once
+#ifndef UIT_SPOUTS_PINNEDINLET_HPP_INCLUDE
+#define UIT_SPOUTS_PINNEDINLET_HPP_INCLUDE
+
+#include <stddef.h>
+#include <utility>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+#include "../../uitsl/debug/occupancy_audit.hpp"
+
+namespace uit {
+
+template<typename ImplSpec_> class Inlet;
+
+/**
+ * Handle to an `Inlet` that calls directly into a known, frozen `Duct`
+ * implementation.
+ *
+ * An `Inlet` forwards every operation through its `Duct`'s `std::variant`.
+ * Once a `Duct` has been frozen, its active implementation can no longer
+ * change, so a `PinnedInlet` caches a typed pointer to that implementation
+ * and calls into it without variant dispatch. Instrumentation counters are
+ * still recorded on the originating `Inlet`.
+ *
+ * Obtain a `PinnedInlet` through `Inlet::Pin` or `Inlet::VisitPinned`.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ *   implementation details for the conduit framework. See
+ *   `include/config/ImplSpec.hpp`.
+ * @tparam Impl active implementation type of the `Inlet`'s `Duct`.
+ *
+ * @note A `PinnedInlet` must not outlive the `Inlet` it was obtained from.
+ */
+template<typename ImplSpec_, typename Impl_>
+class PinnedInlet {
+
+public:
+  using ImplSpec = ImplSpec_;
+  using Impl = Impl_;
+
+private:
+  using T = typename ImplSpec::T;
+
+  using wait_strategy_t = typename ImplSpec::WaitStrategy;
+
+  using inlet_t = Inlet<ImplSpec>;
+  inlet_t* inlet;
+
+  Impl* impl;
+
+  uitsl_occupancy_auditor;
+
+public:
+
+  /**
+   * TODO.
+   *
+   * @param inlet_ TODO.
+   * @param impl_ active implementation of inlet_'s frozen duct.
+   */
+  PinnedInlet(inlet_t& inlet_, Impl& impl_)
+  : inlet(&inlet_)
+  , impl(&impl_)
+  { emp_assert( inlet->IsFrozen() ); }
+
+  // potentially blocking
+  /**
+   * TODO.
+   *
+   * @param val TODO.
+   */
+  void Put(const T& val) {
+    uitsl_occupancy_audit(1);
+
+    bool was_blocked{ false };
+    wait_strategy_t::Until(
+      [this, &val, &was_blocked](){
+        if ( impl->TryPut(val) ) return true;
+        else { was_blocked = true; return false; }
+      },
+      impl
+    );
+
+    inlet->duct->template CountTransfers<Impl>( 1 );
+    inlet->LogPut( was_blocked );
+
+  }
+
+  // non-blocking
+  /**
+   * TODO.
+   *
+   * @param val TODO.
+   */
+  bool TryPut(const T& val) {
+    uitsl_occupancy_audit(1);
+
+    const bool res = impl->TryPut(val);
+    inlet->duct->template CountTransfers<Impl>( res );
+    return inlet->LogTryPut( res );
+
+  }
+
+  // non-blocking
+  /**
+   * TODO.
+   *
+   * @param val TODO.
+   */
+  template<typename P>
+  bool TryPut(P&& val) {
+    uitsl_occupancy_audit(1);
+
+    const bool res = impl->TryPut(std::forward<P>(val));
+    inlet->duct->template CountTransfers<Impl>( res );
+    return inlet->LogTryPut( res );
+
+  }
+
+  /**
+   * TODO.
+   *
+   */
+  bool TryFlush() { return impl->TryFlush(); }
+
+  /**
+   * TODO.
+   *
+   */
+  void Flush() {
+    wait_strategy_t::Until( [this](){ return TryFlush(); }, impl );
+  }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  inlet_t& GetInlet() { return *inlet; }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  const inlet_t& GetInlet() const { return *inlet; }
+
+};
+
+} // namespace uit
+
+#endif // #ifndef UIT_SPOUTS_PINNEDINLET_HPP_INCLUDE
@@ -0,0 +1,128 @@
+#pragma once
+#ifndef UIT_SPOUTS_PINNEDOUTLET_HPP_INCLUDE
+#define UIT_SPOUTS_PINNEDOUTLET_HPP_INCLUDE
+
+#include <limits>
+#include <stddef.h>
+#include <utility>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+#include "../../uitsl/debug/occupancy_audit.hpp"
+
+namespace uit {
+
+template<typename ImplSpec_> class Outlet;
+
+/**
+ * Handle to an `Outlet` that calls directly into a known, frozen `Duct`
+ * implementation.
+ *
+ * Counterpart to `PinnedInlet`. Caches a typed pointer to the active
+ * implementation of the `Outlet`'s frozen `Duct` and calls into it without
+ * variant dispatch. Instrumentation counters are still recorded on the
+ * originating `Outlet`.
+ *
+ * Obtain a `PinnedOutlet` through `Outlet::Pin` or `Outlet::VisitPinned`.
+ *
+ * @tparam ImplSpec class with static and typedef members specifying
+ *   implementation details for the conduit framework. See
+ *   `include/config/ImplSpec.hpp`.
+ * @tparam Impl active implementation type of the `Outlet`'s `Duct`.
+ *
+ * @note A `PinnedOutlet` must not outlive the `Outlet` it was obtained from.
+ */
+template<typename ImplSpec_, typename Impl_>
+class PinnedOutlet {
+
+public:
+  using ImplSpec = ImplSpec_;
+  using Impl = Impl_;
+
+private:
+  using T = typename ImplSpec::T;
+
+  using outlet_t = Outlet<ImplSpec>;
+  outlet_t* outlet;
+
+  Impl* impl;
+
+  uitsl_occupancy_auditor;
+
+  /**
+   * TODO.
+   *
+   * @param n TODO.
+   */
+  size_t TryConsumeGets(const size_t n) {
+    uitsl_occupancy_audit(1);
+    const size_t num_consumed = impl->TryConsumeGets(n);
+    outlet->duct->template CountTransfers<Impl>( num_consumed );
+    return outlet->LogStep( num_consumed );
+  }
+
+public:
+
+  /**
+   * TODO.
+   *
+   * @param outlet_ TODO.
+   * @param impl_ active implementation of outlet_'s frozen duct.
+   */
+  PinnedOutlet(outlet_t& outlet_, Impl& impl_)
+  : outlet(&outlet_)
+  , impl(&impl_)
+  { emp_assert( outlet->IsFrozen() ); }
+
+  size_t TryStep(const size_t num_steps=1) {
+    return outlet->LogTryStep( TryConsumeGets(num_steps) );
+  }
+
+  size_t Jump() {
+    return TryStep( std::numeric_limits<size_t>::max() );
+  }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  const T& Get() const { outlet->LogRead(); return std::as_const(*impl).Get(); }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  T& Get() { outlet->LogRead(); return impl->Get(); }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  const T& JumpGet() {
+    uitsl_occupancy_audit(1);
+    Jump();
+    return Get();
+  }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  outlet_t& GetOutlet() { return *outlet; }
+
+  /**
+   * TODO.
+   *
+   * @return TODO.
+   */
+  const outlet_t& GetOutlet() const { return *outlet; }
+
+};
+
+} // namespace uit
+
+#endif // #ifndef UIT_SPOUTS_PINNEDOUTLET_HPP_INCLUDE
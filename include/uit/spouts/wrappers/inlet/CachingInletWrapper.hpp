@@ -126,6 +126,29 @@ public:
 
   }
 
+  bool TryResumePut(const value_type& val, const bool is_retry) {
+    if ( !HoldsProcImpl().value_or(true) ) return inlet.TryResumePut(
+      uitsl::CachePacket<value_type>{ 0, val }, is_retry
+    );
+
+    bool hit{ true };
+
+    const size_t uid = cache.Get(
+      val,
+      [this, &hit](const auto& key){ hit = false; return uid_stepper++; }
+    );
+
+    if ( hit ) return inlet.TryResumePut(
+      uitsl::CachePacket<value_type>{ uid }, is_retry
+    ); else {
+      const bool res{ inlet.TryResumePut(
+        uitsl::CachePacket<value_type>{ uid, val }, is_retry
+      ) };
+      if ( !res ) cache.Delete( val );
+      return res;
+    }
+  }
+
   decltype(auto) TryFlush() { return inlet.TryFlush(); }
 
   void Flush() { inlet.Flush(); }
@@ -206,6 +229,12 @@ public:
 
   decltype(auto) WhichImplHeld() const { return inlet.WhichImplHeld(); }
 
+  decltype(auto) GetNumProcTransfers() const {
+    return inlet.GetNumProcTransfers();
+  }
+
+  decltype(auto) GetReadyKey() const { return inlet.GetReadyKey(); }
+
   void RegisterInletProc(const uitsl::proc_id_t proc) const {
     inlet.RegisterInletProc(proc);
   }
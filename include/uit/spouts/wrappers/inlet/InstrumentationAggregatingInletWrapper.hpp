@@ -3,10 +3,10 @@
 #define UIT_SPOUTS_WRAPPERS_INLET_INSTRUMENTATIONAGGREGATINGINLETWRAPPER_HPP_INCLUDE
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <cstddef>
 #include <memory>
-#include <shared_mutex>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -17,11 +17,10 @@
 #include "../../../../../third-party/Empirical/include/emp/data/DataFile.hpp"
 #include "../../../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
 
-#include "../../../../uitsl/algorithm/accumulate_if.hpp"
-#include "../../../../uitsl/containers/safe/unordered_set.hpp"
 #include "../../../../uitsl/countdown/coarse_runtime.hpp"
 #include "../../../../uitsl/debug/benchmark_utils.hpp"
 #include "../../../../uitsl/mpi/comm_utils.hpp"
+#include "../../../../uitsl/parallel/ShardedRegistry.hpp"
 #include "../../../../uitsl/parallel/thread_utils.hpp"
 
 #include "../impl/RoundTripCounterAddr.hpp"
@@ -42,271 +41,282 @@ class InstrumentationAggregatingInletWrapper {
 
   using value_type = typename ImplSpec::value_type;
 
-  inline static uitsl::safe::unordered_set<const this_t*> registry;
+  inline static uitsl::ShardedRegistry<const this_t*> registry;
+
+  // aggregate counters, all gathered in a single pass over the registry
+  struct AggregateSnapshot {
+
+    size_t num_inlets{};
+    size_t num_puts_attempted{};
+    size_t num_try_puts_attempted{};
+    size_t num_blocking_puts{};
+    size_t num_try_puts_that_succeeded{};
+    size_t num_puts_that_succeeded_eventually{};
+    size_t num_blocking_puts_that_succeeded_immediately{};
+    size_t num_puts_that_succeeded_immediately{};
+    size_t num_puts_that_blocked{};
+    size_t num_dropped_puts{};
+    size_t num_round_trip_touches{};
+
+    // per-inlet fractions, summed
+    double sum_fraction_try_puts_dropped{};
+    double sum_fraction_blocking_puts_that_blocked{};
+    double sum_fraction_puts_that_succeeded_eventually{};
+    double sum_fraction_puts_that_succeeded_immediately{};
+    double sum_round_trip_touches_per_attempted_put{};
+
+    void Add(const this_t* inlet) {
+      const size_t puts_attempted = inlet->GetNumPutsAttempted();
+      const size_t blocking_puts = inlet->GetNumBlockingPuts();
+      const size_t puts_that_succeeded_eventually
+        = inlet->GetNumPutsThatSucceededEventually();
+      const size_t puts_that_succeeded_immediately
+        = inlet->GetNumPutsThatSucceededImmediately();
+      const size_t puts_that_blocked = inlet->GetNumPutsThatBlocked();
+      const size_t dropped_puts = inlet->GetNumDroppedPuts();
+      const size_t round_trip_touches = inlet->GetCurRoundTripTouchCount();
+
+      ++num_inlets;
+      num_puts_attempted += puts_attempted;
+      num_try_puts_attempted += inlet->GetNumTryPutsAttempted();
+      num_blocking_puts += blocking_puts;
+      num_try_puts_that_succeeded += inlet->GetNumTryPutsThatSucceeded();
+      num_puts_that_succeeded_eventually += puts_that_succeeded_eventually;
+      num_blocking_puts_that_succeeded_immediately
+        += inlet->GetNumBlockingPutsThatSucceededImmediately();
+      num_puts_that_succeeded_immediately += puts_that_succeeded_immediately;
+      num_puts_that_blocked += puts_that_blocked;
+      num_dropped_puts += dropped_puts;
+      num_round_trip_touches += round_trip_touches;
+
+      sum_fraction_try_puts_dropped
+        += dropped_puts / static_cast<double>( puts_attempted );
+      sum_fraction_blocking_puts_that_blocked
+        += puts_that_blocked / static_cast<double>( blocking_puts );
+      sum_fraction_puts_that_succeeded_eventually
+        += puts_that_succeeded_eventually
+        / static_cast<double>( puts_attempted );
+      sum_fraction_puts_that_succeeded_immediately
+        += puts_that_succeeded_immediately
+        / static_cast<double>( puts_attempted );
+      sum_round_trip_touches_per_attempted_put
+        += round_trip_touches / static_cast<double>( puts_attempted );
+    }
+
+    double GetFractionTryPutsDropped() const {
+      return num_dropped_puts / static_cast<double>( num_try_puts_attempted );
+    }
+
+    double GetFractionTryPutsThatSucceeded() const {
+      return num_try_puts_that_succeeded / static_cast<double>(
+        num_try_puts_attempted
+      );
+    }
+
+    double GetFractionBlockingPutsThatBlocked() const {
+      return num_puts_that_blocked / static_cast<double>( num_blocking_puts );
+    }
+
+    double GetFractionPutsThatSucceededEventually() const {
+      return num_puts_that_succeeded_eventually / static_cast<double>(
+        num_puts_attempted
+      );
+    }
+
+    double GetFractionPutsThatSucceededImmediately() const {
+      return num_puts_that_succeeded_immediately / static_cast<double>(
+        num_puts_attempted
+      );
+    }
+
+    double GetRoundTripTouchesPerAttemptedPut() const {
+      return num_round_trip_touches / static_cast<double>(
+        num_puts_attempted
+      );
+    }
+
+    double GetMeanFractionTryPutsDropped() const {
+      return sum_fraction_try_puts_dropped / num_inlets;
+    }
+
+    double GetMeanFractionTryPutsThatSucceeded() const {
+      return 1.0 - GetMeanFractionTryPutsDropped();
+    }
+
+    double GetMeanFractionBlockingPutsThatBlocked() const {
+      return sum_fraction_blocking_puts_that_blocked / num_inlets;
+    }
+
+    double GetMeanFractionPutsThatSucceededEventually() const {
+      return sum_fraction_puts_that_succeeded_eventually / num_inlets;
+    }
+
+    double GetMeanFractionPutsThatSucceededImmediately() const {
+      return sum_fraction_puts_that_succeeded_immediately / num_inlets;
+    }
+
+    double GetMeanRoundTripTouchesPerAttemptedPut() const {
+      return sum_round_trip_touches_per_attempted_put / num_inlets;
+    }
+
+  };
 
   template<typename Filter>
   struct RegistryAggregator {
 
-    static size_t GetNumPutsAttempted() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), size_t{},
-        [](size_t accum, const this_t* inlet) {
-          return accum + inlet->GetNumPutsAttempted();
-        },
-        Filter{}
+    using snapshot_t = AggregateSnapshot;
+
+    /**
+     * Gather every aggregate counter in one pass over registered inlets.
+     *
+     * @return aggregate counters over inlets that pass Filter.
+     */
+    static snapshot_t TakeSnapshot() {
+      snapshot_t res;
+      registry.Visit( [&res](const this_t* inlet){
+        if ( Filter{}( inlet ) ) res.Add( inlet );
+      } );
+      return res;
+    }
+
+    // sum each getter over registered inlets that pass Filter, in one pass
+    template<typename... Getters>
+    static std::array<size_t, sizeof...(Getters)> SumEach(
+      const Getters... getters
+    ) {
+      std::array<size_t, sizeof...(Getters)> res{};
+      registry.Visit( [&res, getters...](const this_t* inlet){
+        if ( !Filter{}( inlet ) ) return;
+        size_t i{};
+        ( ( res[i++] += (inlet->*getters)() ), ... );
+      } );
+      return res;
+    }
+
+    template<typename Getter>
+    static size_t Sum(const Getter getter) {
+      return SumEach( getter ).front();
+    }
+
+    // ratio between sums over registered inlets that pass Filter
+    template<typename Numerator, typename Denominator>
+    static double SumRatio(
+      const Numerator numerator, const Denominator denominator
+    ) {
+      const auto [num, denom] = SumEach( numerator, denominator );
+      return num / static_cast<double>( denom );
+    }
+
+    // mean of per-inlet ratio over registered inlets that pass Filter
+    template<typename Numerator, typename Denominator>
+    static double MeanRatio(
+      const Numerator numerator, const Denominator denominator
+    ) {
+      double sum{};
+      size_t count{};
+      registry.Visit(
+        [&sum, &count, numerator, denominator](const this_t* inlet){
+          if ( !Filter{}( inlet ) ) return;
+          sum += (inlet->*numerator)() / static_cast<double>(
+            (inlet->*denominator)()
+          );
+          ++count;
+        }
       );
+      return sum / count;
+    }
+
+    static size_t GetNumPutsAttempted() {
+      return Sum( &this_t::GetNumPutsAttempted );
     }
 
     static size_t GetNumTryPutsAttempted() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), size_t{},
-        [](size_t accum, const this_t* inlet) {
-          return accum + inlet->GetNumTryPutsAttempted();
-        },
-        Filter{}
-      );
+      return Sum( &this_t::GetNumTryPutsAttempted );
     }
 
     static size_t GetNumBlockingPuts() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), size_t{},
-        [](size_t accum, const this_t* inlet) {
-          return accum + inlet->GetNumBlockingPuts();
-        },
-        Filter{}
-      );
+      return Sum( &this_t::GetNumBlockingPuts );
     }
 
     static size_t GetNumTryPutsThatSucceeded() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), size_t{},
-        [](size_t accum, const this_t* inlet) {
-          return accum + inlet->GetNumTryPutsThatSucceeded();
-        },
-        Filter{}
-      );
+      return Sum( &this_t::GetNumTryPutsThatSucceeded );
     }
 
     static size_t GetNumPutsThatSucceededEventually() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), size_t{},
-        [](size_t accum, const this_t* inlet) {
-          return accum + inlet->GetNumTryPutsAttempted();
-        },
-        Filter{}
-      );
+      return Sum( &this_t::GetNumPutsThatSucceededEventually );
     }
 
-  static size_t GetNumBlockingPutsThatSucceededImmediately() {
-    std::shared_lock lock{ registry.GetMutex() };
-    return uitsl::accumulate_if(
-      std::begin(registry), std::end(registry), size_t{},
-      [](size_t accum, const this_t* inlet) {
-        return accum + inlet->GetNumBlockingPutsThatSucceededImmediately();
-      },
-      Filter{}
-    );
-  }
+    static size_t GetNumBlockingPutsThatSucceededImmediately() {
+      return Sum( &this_t::GetNumBlockingPutsThatSucceededImmediately );
+    }
 
     static size_t GetNumPutsThatSucceededImmediately() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), size_t{},
-        [](size_t accum, const this_t* inlet) {
-          return accum + inlet->GetNumPutsThatSucceededImmediately();
-        },
-        Filter{}
-      );
+      return Sum( &this_t::GetNumPutsThatSucceededImmediately );
     }
 
     static size_t GetNumPutsThatBlocked() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), size_t{},
-        [](size_t accum, const this_t* inlet) {
-          return accum + inlet->GetNumPutsThatBlocked();
-        },
-        Filter{}
-      );
+      return Sum( &this_t::GetNumPutsThatBlocked );
     }
 
     static size_t GetNumDroppedPuts() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), size_t{},
-        [](size_t accum, const this_t* inlet) {
-          return accum + inlet->GetNumDroppedPuts();
-        },
-        Filter{}
-      );
+      return Sum( &this_t::GetNumDroppedPuts );
     }
 
     static double GetFractionTryPutsDropped() {
-      struct Adder {
-        size_t num_dropped_puts{};
-        size_t num_try_puts_attempted{};
-        double GetRatio() const {
-          return num_dropped_puts / static_cast<double>(
-            num_try_puts_attempted
-          );
-        }
-      };
-
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), Adder{},
-        [](Adder accum, const this_t* inlet) {
-          accum.num_dropped_puts += inlet->GetNumDroppedPuts();
-          accum.num_try_puts_attempted += inlet->GetNumTryPutsAttempted();
-          return accum;
-        },
-        Filter{}
-      ).GetRatio();
+      return SumRatio(
+        &this_t::GetNumDroppedPuts,
+        &this_t::GetNumTryPutsAttempted
+      );
     }
 
     static double GetFractionTryPutsThatSucceeded() {
-      struct Adder {
-        size_t num_try_puts_that_succeeded{};
-        size_t num_try_puts_attempted{};
-        double GetRatio() const {
-          return num_try_puts_that_succeeded / static_cast<double>(
-            num_try_puts_attempted
-          );
-        }
-      };
-
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), Adder{},
-        [](Adder accum, const this_t* inlet) {
-          accum.num_try_puts_that_succeeded
-            += inlet->GetNumTryPutsThatSucceeded();
-          accum.num_try_puts_attempted += inlet->GetNumTryPutsAttempted();
-          return accum;
-        },
-        Filter{}
-      ).GetRatio();
+      return SumRatio(
+        &this_t::GetNumTryPutsThatSucceeded,
+        &this_t::GetNumTryPutsAttempted
+      );
     }
 
     static double GetFractionBlockingPutsThatBlocked() {
-      struct Adder {
-        size_t num_puts_that_blocked{};
-        size_t num_blocking_puts{};
-        double GetRatio() const {
-          return num_puts_that_blocked / static_cast<double>(
-            num_blocking_puts
-          );
-        }
-      };
-
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), Adder{},
-        [](Adder accum, const this_t* inlet) {
-          accum.num_puts_that_blocked += inlet->GetNumPutsThatBlocked();
-          accum.num_blocking_puts += inlet->GetNumBlockingPuts();
-          return accum;
-        },
-        Filter{}
-      ).GetRatio();
+      return SumRatio(
+        &this_t::GetNumPutsThatBlocked,
+        &this_t::GetNumBlockingPuts
+      );
     }
 
     static double GetFractionPutsThatSucceededEventually() {
-      struct Adder {
-        size_t num_puts_that_succeeded_eventually{};
-        size_t num_puts_attempted{};
-        double GetRatio() const {
-          return num_puts_that_succeeded_eventually / static_cast<double>(
-            num_puts_attempted
-          );
-        }
-      };
-
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), Adder{},
-        [](Adder accum, const this_t* inlet) {
-          accum.num_puts_that_succeeded_eventually
-            += inlet->GetNumPutsThatSucceededEventually();
-          accum.num_puts_attempted += inlet->GetNumPutsAttempted();
-          return accum;
-        },
-        Filter{}
-      ).GetRatio();
+      return SumRatio(
+        &this_t::GetNumPutsThatSucceededEventually,
+        &this_t::GetNumPutsAttempted
+      );
     }
 
     static double GetFractionPutsThatSucceededImmediately() {
-      struct Adder {
-        size_t num_puts_that_succeeded_immediately{};
-        size_t num_puts_attempted{};
-        double GetRatio() const {
-          return num_puts_that_succeeded_immediately / static_cast<double>(
-            num_puts_attempted
-          );
-        }
-      };
-
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), Adder{},
-        [](Adder accum, const this_t* inlet) {
-          accum.num_puts_that_succeeded_immediately
-            += inlet->GetNumPutsThatSucceededImmediately();
-          accum.num_puts_attempted += inlet->GetNumPutsAttempted();
-          return accum;
-        },
-        Filter{}
-      ).GetRatio();
+      return SumRatio(
+        &this_t::GetNumPutsThatSucceededImmediately,
+        &this_t::GetNumPutsAttempted
+      );
     }
 
     static double GetRoundTripTouchesPerAttemptedPut() {
-      struct Adder {
-        size_t num_round_trip_touches{};
-        size_t num_puts_attempted{};
-        double GetRatio() const {
-          return num_round_trip_touches / static_cast<double>(
-            num_puts_attempted
-          );
-        }
-      };
-
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), Adder{},
-        [](Adder accum, const this_t* inlet) {
-          accum.num_round_trip_touches += inlet->GetCurRoundTripTouchCount();
-          accum.num_puts_attempted += inlet->GetNumPutsAttempted();
-          return accum;
-        },
-        Filter{}
-      ).GetRatio();
+      return SumRatio(
+        &this_t::GetCurRoundTripTouchCount,
+        &this_t::GetNumPutsAttempted
+      );
     }
 
     static size_t GetNumInlets() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return std::count_if(
-        std::begin(registry), std::end(registry),
-        Filter{}
-      );
+      size_t res{};
+      registry.Visit( [&res](const this_t* inlet){
+        if ( Filter{}( inlet ) ) ++res;
+      } );
+      return res;
     }
 
     static double GetMeanFractionTryPutsDropped() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), double{},
-        [](size_t accum, const this_t* inlet) {
-          return accum + (
-            inlet->GetNumDroppedPuts()
-            / static_cast<double>( inlet->GetNumPutsAttempted() )
-          );
-        },
-        Filter{}
-      ) / GetNumInlets();
+      return MeanRatio(
+        &this_t::GetNumDroppedPuts,
+        &this_t::GetNumPutsAttempted
+      );
     }
 
     static double GetMeanFractionTryPutsThatSucceeded() {
@@ -314,201 +324,175 @@ class InstrumentationAggregatingInletWrapper {
     }
 
     static double GetMeanFractionBlockingPutsThatBlocked() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), double{},
-        [](size_t accum, const this_t* inlet) {
-          return accum + (
-            inlet->GetNumPutsThatBlocked()
-            / static_cast<double>( inlet->GetNumBlockingPuts() )
-          );
-        },
-        Filter{}
-      ) / GetNumInlets();
+      return MeanRatio(
+        &this_t::GetNumPutsThatBlocked,
+        &this_t::GetNumBlockingPuts
+      );
     }
 
     static double GetMeanFractionPutsThatSucceededEventually() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), double{},
-        [](size_t accum, const this_t* inlet) {
-          return accum + (
-            inlet->GetNumPutsThatSucceededEventually()
-            / static_cast<double>( inlet->GetNumPutsAttempted() )
-          );
-        },
-        Filter{}
-      ) / GetNumInlets();
+      return MeanRatio(
+        &this_t::GetNumPutsThatSucceededEventually,
+        &this_t::GetNumPutsAttempted
+      );
     }
 
     static double GetMeanFractionPutsThatSucceededImmediately() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), double{},
-        [](size_t accum, const this_t* inlet) {
-          return accum + (
-            inlet->GetNumPutsThatSucceededImmediately()
-            / static_cast<double>( inlet->GetNumPutsAttempted() )
-          );
-        },
-        Filter{}
-      ) / GetNumInlets();
+      return MeanRatio(
+        &this_t::GetNumPutsThatSucceededImmediately,
+        &this_t::GetNumPutsAttempted
+      );
     }
 
     static double GetMeanRoundTripTouchesPerAttemptedPut() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), double{},
-        [](size_t accum, const this_t* inlet) {
-          return accum + (
-            inlet->GetCurRoundTripTouchCount()
-            / static_cast<double>( inlet->GetNumPutsAttempted() )
-          );
-        },
-        Filter{}
-      ) / GetNumInlets();
+      return MeanRatio(
+        &this_t::GetCurRoundTripTouchCount,
+        &this_t::GetNumPutsAttempted
+      );
     }
 
     static size_t GetNumRoundTripTouches() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), size_t{},
-        [](size_t accum, const this_t* inlet) {
-          return accum + inlet->GetCurRoundTripTouchCount();
-        },
-        Filter{}
-      );
+      return Sum( &this_t::GetCurRoundTripTouchCount );
     }
 
-    // capture these from each inlet as close together as possible
     static std::string JointGet_NumTryPutsAttempted_NumDroppedPuts() {
-      struct JointAdder {
-        size_t num_try_puts_attempted{};
-        size_t num_dropped_puts{};
-
-        std::string pack() const {
-          return emp::to_string(
-            num_try_puts_attempted, ',', num_dropped_puts
-          );
-        }
-
-      };
-
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), JointAdder{},
-        [](auto accum, const this_t* inlet) {
-          accum.num_dropped_puts += inlet->GetNumDroppedPuts();
-          accum.num_try_puts_attempted += inlet->GetNumTryPutsAttempted();
-          return accum;
-        },
-        Filter{}
-      ).pack();
+      const auto [num_try_puts_attempted, num_dropped_puts] = SumEach(
+        &this_t::GetNumTryPutsAttempted,
+        &this_t::GetNumDroppedPuts
+      );
+      return emp::to_string( num_try_puts_attempted, ',', num_dropped_puts );
     }
 
-    // capture these from each inlet as close together as possible
     static std::string JointGet_NumPutsAttempted_NumRoundTripTouches() {
-      struct JointAdder {
-        size_t num_puts_attempted{};
-        size_t num_round_trip_touches{};
-
-        std::string pack() const {
-          return emp::to_string(
-            num_puts_attempted, ',', num_round_trip_touches
-          );
-        }
-
-      };
-
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), JointAdder{},
-        [](auto accum, const this_t* inlet) {
-          accum.num_puts_attempted += inlet->GetNumPutsAttempted();
-          accum.num_round_trip_touches += inlet->GetCurRoundTripTouchCount();
-          return accum;
-        },
-        Filter{}
-      ).pack();
+      const auto [num_puts_attempted, num_round_trip_touches] = SumEach(
+        &this_t::GetNumPutsAttempted,
+        &this_t::GetCurRoundTripTouchCount
+      );
+      return emp::to_string( num_puts_attempted, ',', num_round_trip_touches );
     }
 
+    // each row reads every column from one snapshot taken at row start
     static emp::DataFile MakeSummaryDataFile(const std::string& filename) {
+      const auto snapshot = std::make_shared<snapshot_t>();
+
       emp::DataFile res( filename );
       res.AddFun(
-        [](){
-          return std::chrono::time_point_cast<std::chrono::nanoseconds>(
-            std::chrono::steady_clock::now()
-          ).time_since_epoch().count();
+        [snapshot](){
+          const auto timepoint = std::chrono::time_point_cast<
+            std::chrono::nanoseconds
+          >( std::chrono::steady_clock::now() ).time_since_epoch().count();
+          *snapshot = TakeSnapshot();
+          return timepoint;
         },
         "Row Initial Timepoint (ns)"
       );
       res.AddVal(uitsl::get_proc_id(), "proc");
       res.AddVal(Filter::name(), "Impl Filter");
-      res.AddFun(GetNumInlets, "Num Inlets");
       res.AddFun(
-        JointGet_NumPutsAttempted_NumRoundTripTouches,
+        [snapshot](){ return snapshot->num_inlets; }, "Num Inlets"
+      );
+      res.AddFun(
+        [snapshot](){
+          return emp::to_string(
+            snapshot->num_puts_attempted, ',', snapshot->num_round_trip_touches
+          );
+        },
         "Num Puts Attempted,Num Round Trip Touches"
       );
       res.AddFun(
-        JointGet_NumTryPutsAttempted_NumDroppedPuts,
+        [snapshot](){
+          return emp::to_string(
+            snapshot->num_try_puts_attempted, ',', snapshot->num_dropped_puts
+          );
+        },
         "Num Try Puts Attempted,Num Dropped Puts"
       );
-      res.AddFun(GetNumBlockingPuts, "Num Blocking Puts");
-      res.AddFun(GetNumTryPutsThatSucceeded, "Num Try Puts That Succeeded");
       res.AddFun(
-        GetNumPutsThatSucceededEventually, "Num Puts That Succeeded Eventually"
+        [snapshot](){ return snapshot->num_blocking_puts; },
+        "Num Blocking Puts"
+      );
+      res.AddFun(
+        [snapshot](){ return snapshot->num_try_puts_that_succeeded; },
+        "Num Try Puts That Succeeded"
+      );
+      res.AddFun(
+        [snapshot](){ return snapshot->num_puts_that_succeeded_eventually; },
+        "Num Puts That Succeeded Eventually"
       );
       res.AddFun(
-        GetNumBlockingPutsThatSucceededImmediately,
+        [snapshot](){
+          return snapshot->num_blocking_puts_that_succeeded_immediately;
+        },
         "Num Blocking Puts That Succeeded Immediately"
       );
       res.AddFun(
-        GetNumPutsThatSucceededImmediately,
+        [snapshot](){ return snapshot->num_puts_that_succeeded_immediately; },
         "Num Puts That Succeeded Immediately"
       );
-      res.AddFun( GetNumPutsThatBlocked, "Num Puts That Blocked" );
-      res.AddFun( GetFractionTryPutsDropped, "Fraction Try Puts Dropped" );
       res.AddFun(
-        GetFractionTryPutsThatSucceeded, "Fraction Try Puts That Succeeded"
+        [snapshot](){ return snapshot->num_puts_that_blocked; },
+        "Num Puts That Blocked"
+      );
+      res.AddFun(
+        [snapshot](){ return snapshot->GetFractionTryPutsDropped(); },
+        "Fraction Try Puts Dropped"
+      );
+      res.AddFun(
+        [snapshot](){ return snapshot->GetFractionTryPutsThatSucceeded(); },
+        "Fraction Try Puts That Succeeded"
       );
       res.AddFun(
-        GetFractionBlockingPutsThatBlocked,
+        [snapshot](){ return snapshot->GetFractionBlockingPutsThatBlocked(); },
         "Fraction Blocking Puts That Blocked"
       );
       res.AddFun(
-        GetFractionPutsThatSucceededEventually,
+        [snapshot](){
+          return snapshot->GetFractionPutsThatSucceededEventually();
+        },
         "Fraction Puts That Succeeded Eventually"
       );
       res.AddFun(
-        GetFractionPutsThatSucceededImmediately,
+        [snapshot](){
+          return snapshot->GetFractionPutsThatSucceededImmediately();
+        },
         "Fraction Puts That Succeeded Immediately"
       );
       res.AddFun(
-        GetRoundTripTouchesPerAttemptedPut,
+        [snapshot](){ return snapshot->GetRoundTripTouchesPerAttemptedPut(); },
         "Round Trip Touches Per Attempted Put"
       );
       res.AddFun(
-        GetMeanFractionTryPutsDropped,
+        [snapshot](){ return snapshot->GetMeanFractionTryPutsDropped(); },
         "Mean Fraction Try Puts Dropped"
       );
       res.AddFun(
-        GetMeanFractionTryPutsThatSucceeded,
+        [snapshot](){
+          return snapshot->GetMeanFractionTryPutsThatSucceeded();
+        },
         "Mean Fraction Try Puts That Succeeded"
       );
       res.AddFun(
-        GetMeanFractionBlockingPutsThatBlocked,
+        [snapshot](){
+          return snapshot->GetMeanFractionBlockingPutsThatBlocked();
+        },
         "Mean Fraction Blocking Puts That Blocked"
       );
       res.AddFun(
-        GetMeanFractionPutsThatSucceededEventually,
+        [snapshot](){
+          return snapshot->GetMeanFractionPutsThatSucceededEventually();
+        },
         "Mean Fraction Puts That Succeeded Eventually"
       );
       res.AddFun(
-        GetMeanFractionPutsThatSucceededImmediately,
+        [snapshot](){
+          return snapshot->GetMeanFractionPutsThatSucceededImmediately();
+        },
         "Mean Fraction Puts That Succeeded Immediately"
       );
       res.AddFun(
-        GetMeanRoundTripTouchesPerAttemptedPut,
+        [snapshot](){
+          return snapshot->GetMeanRoundTripTouchesPerAttemptedPut();
+        },
         "Mean Round Trip Touches Per Attempted Put"
       );
       res.AddFun(
@@ -534,11 +518,7 @@ class InstrumentationAggregatingInletWrapper {
       );
       res.SetFilterContainerFun( Filter{} );
       res.SetLockContainerFun( [](const auto& container_ptr){
-        using mutex_t = std::decay_t<decltype(container_ptr->GetMutex())>;
-        using lock_t = std::shared_lock<mutex_t>;
-        return std::make_shared<lock_t>(
-          container_ptr->GetMutex()
-        );
+        return container_ptr->MakeSharedLock();
       } );
       res.AddFun(
         [](){
@@ -712,6 +692,10 @@ class InstrumentationAggregatingInletWrapper {
   >;
   mutable touch_count_address_cache_t touch_count_address_cache{ std::nullopt };
 
+  // declared after all other data members, so registered only once they're
+  // constructed and deregistered before they're destroyed
+  typename decltype(registry)::Registration registration{ registry, this };
+
   void DoRefreshTouchCountAddressCache() const {
     touch_count_address_cache = uit::impl::round_trip_touch_addr_t{
       *LookupMeshID(), *LookupInletNodeID(), *LookupOutletNodeID()
@@ -748,30 +732,24 @@ public:
    */
   InstrumentationAggregatingInletWrapper(
     InstrumentationAggregatingInletWrapper& other
-  ) : inlet( other.inlet ) {
-    emp_assert( !registry.contains(this) );
-    registry.insert(this);
-  }
+  ) : inlet( other.inlet )
+  { }
 
   /**
    * Copy constructor.
    */
   InstrumentationAggregatingInletWrapper(
     const InstrumentationAggregatingInletWrapper& other
-  ) : inlet( other.inlet ) {
-    emp_assert( !registry.contains(this) );
-    registry.insert(this);
-  };
+  ) : inlet( other.inlet )
+  { }
 
   /**
    * Move constructor.
    */
   InstrumentationAggregatingInletWrapper(
     InstrumentationAggregatingInletWrapper&& other
-  ) : inlet( std::move(other.inlet) ) {
-    emp_assert( !registry.contains(this) );
-    registry.insert(this);
-  };
+  ) : inlet( std::move(other.inlet) )
+  { }
 
   /**
    * Forwarding constructor.
@@ -779,15 +757,7 @@ public:
   template <typename... Args>
   explicit InstrumentationAggregatingInletWrapper(Args&&... args)
   : inlet(std::forward<Args>(args)...)
-  {
-    emp_assert( !registry.contains(this) );
-    registry.insert(this);
-  }
-
-  ~InstrumentationAggregatingInletWrapper() {
-    [[maybe_unused]] const size_t res = registry.erase( this );
-    emp_assert( res == 1, res );
-  }
+  { }
 
   void Put(const value_type& val) {
     return inlet.Put( uit::impl::RoundTripCountPacket<value_type>{
@@ -808,6 +778,15 @@ public:
     } );
   }
 
+  decltype(auto) TryResumePut(const value_type& val, const bool is_retry) {
+    return inlet.TryResumePut(
+      uit::impl::RoundTripCountPacket<value_type>{
+        GetCurRoundTripTouchCount() + 1, val
+      },
+      is_retry
+    );
+  }
+
   decltype(auto) TryFlush() { return inlet.TryFlush(); }
 
   void Flush() { inlet.Flush(); }
@@ -892,6 +871,12 @@ public:
 
   decltype(auto) WhichImplHeld() const { return inlet.WhichImplHeld(); }
 
+  decltype(auto) GetNumProcTransfers() const {
+    return inlet.GetNumProcTransfers();
+  }
+
+  decltype(auto) GetReadyKey() const { return inlet.GetReadyKey(); }
+
   void RegisterInletProc(const uitsl::proc_id_t proc) const {
     inlet.RegisterInletProc(proc);
   }
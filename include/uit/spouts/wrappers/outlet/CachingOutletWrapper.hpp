@@ -24,6 +24,7 @@ class CachingOutletWrapper {
 
   using this_t = CachingOutletWrapper<Outlet>;
   using value_type = typename ImplSpec::value_type;
+  using wait_strategy_t = typename ImplSpec::WaitStrategy;
 
   emp::QueueCache<
     size_t,
@@ -130,10 +131,14 @@ public:
   const value_type& JumpGet() { Jump(); return Get(); }
 
   void Step(size_t num_steps=1) {
-    while ( num_steps ) num_steps -= TryStep(num_steps);
+    while ( num_steps ) wait_strategy_t::Until( [this, &num_steps](){
+      const size_t num_stepped = TryStep(num_steps);
+      num_steps -= num_stepped;
+      return num_stepped != 0;
+    } );
   }
 
-  const value_type& GetNext() { while (TryStep() == 0); return Get(); }
+  const value_type& GetNext() { Step(); return Get(); }
 
   using optional_ref_t = emp::optional<std::reference_wrapper<
     const value_type
@@ -285,8 +290,14 @@ public:
 
   decltype(auto) WhichImplHeld() const { return outlet.WhichImplHeld(); }
 
+  decltype(auto) GetNumProcTransfers() const {
+    return outlet.GetNumProcTransfers();
+  }
+
   decltype(auto) CanStep() const { return outlet.CanStep(); }
 
+  decltype(auto) GetReadyKey() const { return outlet.GetReadyKey(); }
+
   void RegisterInletProc(const uitsl::proc_id_t proc) const {
     outlet.RegisterInletProc(proc);
   }
@@ -3,15 +3,16 @@
 #define UIT_SPOUTS_WRAPPERS_OUTLET_INSTRUMENTATIONAGGREGATINGOUTLETWRAPPER_HPP_INCLUDE
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <cstddef>
 #include <functional>
 #include <memory>
-#include <shared_mutex>
 #include <string>
 #include <string_view>
 #include <typeinfo>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 
 #include "../../../../../third-party/Empirical/include/emp/base/assert.hpp"
@@ -19,10 +20,9 @@
 #include "../../../../../third-party/Empirical/include/emp/data/DataFile.hpp"
 #include "../../../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
 
-#include "../../../../uitsl/algorithm/accumulate_if.hpp"
-#include "../../../../uitsl/containers/safe/unordered_set.hpp"
 #include "../../../../uitsl/countdown/coarse_runtime.hpp"
 #include "../../../../uitsl/debug/WarnOnce.hpp"
+#include "../../../../uitsl/parallel/ShardedRegistry.hpp"
 #include "../../../../uitsl/parallel/thread_utils.hpp"
 
 #include "../impl/round_trip_touch_counter.hpp"
@@ -41,438 +41,519 @@ class InstrumentationAggregatingOutletWrapper {
 
   using value_type = typename ImplSpec::value_type;
 
-  inline static uitsl::safe::unordered_set<const this_t*> registry;
+  inline static uitsl::ShardedRegistry<const this_t*> registry;
+
+  // aggregate counters, all gathered in a single pass over the registry
+  struct AggregateSnapshot {
+
+    size_t num_outlets{};
+    size_t num_reads_performed{};
+    size_t num_reads_that_were_fresh{};
+    size_t num_reads_that_were_stale{};
+    size_t num_revisions_pulled{};
+    size_t num_try_pulls_attempted{};
+    size_t num_blocking_pulls{};
+    size_t num_blocking_pulls_that_blocked{};
+    size_t num_revisions_from_try_pulls{};
+    size_t num_revisions_from_blocking_pulls{};
+    size_t num_pulls_attempted{};
+    size_t num_pulls_that_were_laden_eventually{};
+    size_t num_blocking_pulls_that_were_laden_immediately{};
+    size_t num_blocking_pulls_that_were_laden_eventually{};
+    size_t num_pulls_that_were_laden_immediately{};
+    size_t num_try_pulls_that_were_laden{};
+    size_t num_try_pulls_that_were_unladen{};
+    size_t num_round_trip_touches{};
+    size_t net_flux_through_duct{};
+
+    // per-outlet fractions, summed
+    double sum_fraction_try_pulls_that_were_laden{};
+    double sum_fraction_try_pulls_that_were_unladen{};
+    double sum_fraction_blocking_pulls_that_blocked{};
+    double sum_fraction_blocking_pulls_that_were_laden_immediately{};
+    double sum_fraction_blocking_pulls_that_were_laden_eventually{};
+    double sum_fraction_pulls_that_were_laden_immediately{};
+    double sum_fraction_pulls_that_were_laden_eventually{};
+    double sum_fraction_reads_that_were_fresh{};
+    double sum_fraction_reads_that_were_stale{};
+    double sum_fraction_revisions_that_were_read{};
+    double sum_fraction_duct_flux_that_was_stepped_through{};
+    double sum_fraction_duct_flux_that_was_read{};
+    double sum_round_trip_touches_per_attempted_pull{};
+
+    void Add(const this_t* outlet) {
+      const size_t reads_performed = outlet->GetNumReadsPerformed();
+      const size_t reads_that_were_fresh = outlet->GetNumReadsThatWereFresh();
+      const size_t reads_that_were_stale = outlet->GetNumReadsThatWereStale();
+      const size_t revisions_pulled = outlet->GetNumRevisionsPulled();
+      const size_t try_pulls_attempted = outlet->GetNumTryPullsAttempted();
+      const size_t blocking_pulls = outlet->GetNumBlockingPulls();
+      const size_t blocking_pulls_that_blocked
+        = outlet->GetNumBlockingPullsThatBlocked();
+      const size_t pulls_attempted = outlet->GetNumPullsAttempted();
+      const size_t pulls_that_were_laden_eventually
+        = outlet->GetNumPullsThatWereLadenEventually();
+      const size_t blocking_pulls_that_were_laden_immediately
+        = outlet->GetNumBlockingPullsThatWereLadenImmediately();
+      const size_t blocking_pulls_that_were_laden_eventually
+        = outlet->GetNumBlockingPullsThatWereLadenEventually();
+      const size_t pulls_that_were_laden_immediately
+        = outlet->GetNumPullsThatWereLadenImmediately();
+      const size_t try_pulls_that_were_laden
+        = outlet->GetNumTryPullsThatWereLaden();
+      const size_t try_pulls_that_were_unladen
+        = outlet->GetNumTryPullsThatWereUnladen();
+      const size_t round_trip_touches = outlet->GetCurRoundTripTouchCount();
+      const size_t flux_through_duct = outlet->GetNetFluxThroughDuct();
+
+      ++num_outlets;
+      num_reads_performed += reads_performed;
+      num_reads_that_were_fresh += reads_that_were_fresh;
+      num_reads_that_were_stale += reads_that_were_stale;
+      num_revisions_pulled += revisions_pulled;
+      num_try_pulls_attempted += try_pulls_attempted;
+      num_blocking_pulls += blocking_pulls;
+      num_blocking_pulls_that_blocked += blocking_pulls_that_blocked;
+      num_revisions_from_try_pulls += outlet->GetNumRevisionsFromTryPulls();
+      num_revisions_from_blocking_pulls
+        += outlet->GetNumRevisionsFromBlockingPulls();
+      num_pulls_attempted += pulls_attempted;
+      num_pulls_that_were_laden_eventually += pulls_that_were_laden_eventually;
+      num_blocking_pulls_that_were_laden_immediately
+        += blocking_pulls_that_were_laden_immediately;
+      num_blocking_pulls_that_were_laden_eventually
+        += blocking_pulls_that_were_laden_eventually;
+      num_pulls_that_were_laden_immediately
+        += pulls_that_were_laden_immediately;
+      num_try_pulls_that_were_laden += try_pulls_that_were_laden;
+      num_try_pulls_that_were_unladen += try_pulls_that_were_unladen;
+      num_round_trip_touches += round_trip_touches;
+      net_flux_through_duct += flux_through_duct;
+
+      sum_fraction_try_pulls_that_were_laden
+        += try_pulls_that_were_laden / static_cast<double>(
+          try_pulls_attempted
+        );
+      sum_fraction_try_pulls_that_were_unladen
+        += try_pulls_that_were_unladen / static_cast<double>(
+          try_pulls_attempted
+        );
+      sum_fraction_blocking_pulls_that_blocked
+        += blocking_pulls_that_blocked / static_cast<double>( blocking_pulls );
+      sum_fraction_blocking_pulls_that_were_laden_immediately
+        += blocking_pulls_that_were_laden_immediately
+        / static_cast<double>( blocking_pulls );
+      sum_fraction_blocking_pulls_that_were_laden_eventually
+        += blocking_pulls_that_were_laden_eventually
+        / static_cast<double>( blocking_pulls );
+      sum_fraction_pulls_that_were_laden_immediately
+        += pulls_that_were_laden_immediately
+        / static_cast<double>( pulls_attempted );
+      sum_fraction_pulls_that_were_laden_eventually
+        += pulls_that_were_laden_eventually
+        / static_cast<double>( pulls_attempted );
+      sum_fraction_reads_that_were_fresh
+        += reads_that_were_fresh / static_cast<double>( reads_performed );
+      sum_fraction_reads_that_were_stale
+        += reads_that_were_stale / static_cast<double>( reads_performed );
+      sum_fraction_revisions_that_were_read
+        += reads_that_were_fresh / static_cast<double>( revisions_pulled );
+      sum_fraction_duct_flux_that_was_stepped_through
+        += revisions_pulled / static_cast<double>( flux_through_duct );
+      sum_fraction_duct_flux_that_was_read
+        += reads_that_were_fresh / static_cast<double>( flux_through_duct );
+      sum_round_trip_touches_per_attempted_pull
+        += round_trip_touches / static_cast<double>( pulls_attempted );
+    }
+
+    double GetFractionTryPullsThatWereLaden() const {
+      return num_try_pulls_that_were_laden / static_cast<double>(
+        num_try_pulls_attempted
+      );
+    }
+
+    double GetFractionTryPullsThatWereUnladen() const {
+      return num_try_pulls_that_were_unladen / static_cast<double>(
+        num_try_pulls_attempted
+      );
+    }
+
+    double GetFractionBlockingPullsThatBlocked() const {
+      return num_blocking_pulls_that_blocked / static_cast<double>(
+        num_blocking_pulls
+      );
+    }
+
+    double GetFractionBlockingPullsThatWereLadenImmediately() const {
+      return num_blocking_pulls_that_were_laden_immediately
+        / static_cast<double>( num_blocking_pulls );
+    }
+
+    double GetFractionBlockingPullsThatWereLadenEventually() const {
+      return num_blocking_pulls_that_were_laden_eventually
+        / static_cast<double>( num_blocking_pulls );
+    }
+
+    double GetFractionPullsThatWereLadenImmediately() const {
+      return num_pulls_that_were_laden_immediately
+        / static_cast<double>( num_pulls_attempted );
+    }
+
+    double GetFractionPullsThatWereLadenEventually() const {
+      return num_pulls_that_were_laden_eventually
+        / static_cast<double>( num_pulls_attempted );
+    }
+
+    double GetFractionReadsThatWereFresh() const {
+      return num_reads_that_were_fresh
+        / static_cast<double>( num_reads_performed );
+    }
+
+    double GetFractionReadsThatWereStale() const {
+      return num_reads_that_were_stale
+        / static_cast<double>( num_reads_performed );
+    }
+
+    double GetFractionRevisionsThatWereRead() const {
+      return num_reads_that_were_fresh
+        / static_cast<double>( num_revisions_pulled );
+    }
+
+    double GetFractionRevisionsThatWereNotRead() const {
+      return 1.0 - GetFractionRevisionsThatWereRead();
+    }
+
+    double GetFractionDuctFluxThatWasSteppedThrough() const {
+      return num_revisions_pulled
+        / static_cast<double>( net_flux_through_duct );
+    }
+
+    double GetFractionDuctFluxThatWasJumpedOver() const {
+      return 1.0 - GetFractionDuctFluxThatWasSteppedThrough();
+    }
+
+    double GetFractionDuctFluxThatWasRead() const {
+      return num_reads_that_were_fresh
+        / static_cast<double>( net_flux_through_duct );
+    }
+
+    double GetRoundTripTouchesPerAttemptedPull() const {
+      return num_round_trip_touches
+        / static_cast<double>( num_pulls_attempted );
+    }
+
+    double GetMeanFractionTryPullsThatWereLaden() const {
+      return sum_fraction_try_pulls_that_were_laden / num_outlets;
+    }
+
+    double GetMeanFractionTryPullsThatWereUnladen() const {
+      return sum_fraction_try_pulls_that_were_unladen / num_outlets;
+    }
+
+    double GetMeanFractionBlockingPullsThatBlocked() const {
+      return sum_fraction_blocking_pulls_that_blocked / num_outlets;
+    }
+
+    double GetMeanFractionBlockingPullsThatWereLadenImmediately() const {
+      return sum_fraction_blocking_pulls_that_were_laden_immediately
+        / num_outlets;
+    }
+
+    double GetMeanFractionBlockingPullsThatWereLadenEventually() const {
+      return sum_fraction_blocking_pulls_that_were_laden_eventually
+        / num_outlets;
+    }
+
+    double GetMeanFractionPullsThatWereLadenImmediately() const {
+      return sum_fraction_pulls_that_were_laden_immediately / num_outlets;
+    }
+
+    double GetMeanFractionPullsThatWereLadenEventually() const {
+      return sum_fraction_pulls_that_were_laden_eventually / num_outlets;
+    }
+
+    double GetMeanFractionReadsThatWereFresh() const {
+      return sum_fraction_reads_that_were_fresh / num_outlets;
+    }
+
+    double GetMeanFractionReadsThatWereStale() const {
+      return sum_fraction_reads_that_were_stale / num_outlets;
+    }
+
+    double GetMeanFractionRevisionsThatWereRead() const {
+      return sum_fraction_revisions_that_were_read / num_outlets;
+    }
+
+    double GetMeanFractionRevisionsThatWereNotRead() const {
+      return 1.0 - GetMeanFractionRevisionsThatWereRead();
+    }
+
+    double GetMeanFractionDuctFluxThatWasSteppedThrough() const {
+      return sum_fraction_duct_flux_that_was_stepped_through / num_outlets;
+    }
+
+    double GetMeanFractionDuctFluxThatWasJumpedOver() const {
+      return 1.0 - GetMeanFractionDuctFluxThatWasSteppedThrough();
+    }
+
+    double GetMeanFractionDuctFluxThatWasRead() const {
+      return sum_fraction_duct_flux_that_was_read / num_outlets;
+    }
+
+    double GetMeanRoundTripTouchesPerAttemptedPull() const {
+      return sum_round_trip_touches_per_attempted_pull / num_outlets;
+    }
+
+  };
 
   template<typename Filter>
   struct RegistryAggregator {
 
-    static size_t GetNumReadsPerformed() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), size_t{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + outlet->GetNumReadsPerformed();
-        },
-        Filter{}
+    using snapshot_t = AggregateSnapshot;
+
+    /**
+     * Gather every aggregate counter in one pass over registered outlets.
+     *
+     * @return aggregate counters over outlets that pass Filter.
+     */
+    static snapshot_t TakeSnapshot() {
+      snapshot_t res;
+      registry.Visit( [&res](const this_t* outlet){
+        if ( Filter{}( outlet ) ) res.Add( outlet );
+      } );
+      return res;
+    }
+
+    // sum each getter over registered outlets that pass Filter, in one pass
+    template<typename... Getters>
+    static std::array<size_t, sizeof...(Getters)> SumEach(
+      const Getters... getters
+    ) {
+      std::array<size_t, sizeof...(Getters)> res{};
+      registry.Visit( [&res, getters...](const this_t* outlet){
+        if ( !Filter{}( outlet ) ) return;
+        size_t i{};
+        ( ( res[i++] += (outlet->*getters)() ), ... );
+      } );
+      return res;
+    }
+
+    template<typename Getter>
+    static size_t Sum(const Getter getter) {
+      return SumEach( getter ).front();
+    }
+
+    // ratio between sums over registered outlets that pass Filter
+    template<typename Numerator, typename Denominator>
+    static double SumRatio(
+      const Numerator numerator, const Denominator denominator
+    ) {
+      const auto [num, denom] = SumEach( numerator, denominator );
+      return num / static_cast<double>( denom );
+    }
+
+    // mean of per-outlet ratio over registered outlets that pass Filter
+    template<typename Numerator, typename Denominator>
+    static double MeanRatio(
+      const Numerator numerator, const Denominator denominator
+    ) {
+      double sum{};
+      size_t count{};
+      registry.Visit(
+        [&sum, &count, numerator, denominator](const this_t* outlet){
+          if ( !Filter{}( outlet ) ) return;
+          sum += (outlet->*numerator)() / static_cast<double>(
+            (outlet->*denominator)()
+          );
+          ++count;
+        }
       );
+      return sum / count;
+    }
+
+    static size_t GetNumReadsPerformed() {
+      return Sum( &this_t::GetNumReadsPerformed );
     }
 
     static size_t GetNumReadsThatWereFresh() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), size_t{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + outlet->GetNumReadsThatWereFresh();
-        },
-        Filter{}
-      );
+      return Sum( &this_t::GetNumReadsThatWereFresh );
     }
 
     static size_t GetNumReadsThatWereStale() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), size_t{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + outlet->GetNumReadsThatWereStale();
-        },
-        Filter{}
-      );
+      return Sum( &this_t::GetNumReadsThatWereStale );
     }
 
     static size_t GetNumRevisionsPulled() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), size_t{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + outlet->GetNumRevisionsPulled();
-        },
-        Filter{}
-      );
+      return Sum( &this_t::GetNumRevisionsPulled );
     }
 
     static size_t GetNumTryPullsAttempted() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), size_t{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + outlet->GetNumTryPullsAttempted();
-        },
-        Filter{}
-      );
+      return Sum( &this_t::GetNumTryPullsAttempted );
     }
 
     static size_t GetNumBlockingPulls() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), size_t{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + outlet->GetNumBlockingPulls();
-        },
-        Filter{}
-      );
+      return Sum( &this_t::GetNumBlockingPulls );
     }
 
     static size_t GetNumBlockingPullsThatBlocked() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), size_t{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + outlet->GetNumBlockingPullsThatBlocked();
-        },
-        Filter{}
-      );
+      return Sum( &this_t::GetNumBlockingPullsThatBlocked );
     }
 
     static size_t GetNumRevisionsFromTryPulls() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), size_t{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + outlet->GetNumRevisionsFromTryPulls();
-        },
-        Filter{}
-      );
+      return Sum( &this_t::GetNumRevisionsFromTryPulls );
     }
 
     static size_t GetNumRevisionsFromBlockingPulls() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), size_t{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + outlet->GetNumRevisionsFromBlockingPulls();
-        },
-        Filter{}
-      );
+      return Sum( &this_t::GetNumRevisionsFromBlockingPulls );
     }
 
     static size_t GetNumPullsAttempted() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), size_t{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + outlet->GetNumPullsAttempted();
-        },
-        Filter{}
-      );
+      return Sum( &this_t::GetNumPullsAttempted );
     }
 
     static size_t GetNumPullsThatWereLadenEventually() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), size_t{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + outlet->GetNumPullsThatWereLadenEventually();
-        },
-        Filter{}
-      );
+      return Sum( &this_t::GetNumPullsThatWereLadenEventually );
     }
 
     static size_t GetNumBlockingPullsThatWereLadenImmediately() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), size_t{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + outlet->GetNumBlockingPullsThatWereLadenImmediately();
-        },
-        Filter{}
-      );
+      return Sum( &this_t::GetNumBlockingPullsThatWereLadenImmediately );
     }
 
     static size_t GetNumBlockingPullsThatWereLadenEventually() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), size_t{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + outlet->GetNumBlockingPullsThatWereLadenEventually();
-        },
-        Filter{}
-      );
+      return Sum( &this_t::GetNumBlockingPullsThatWereLadenEventually );
     }
 
     static size_t GetNumPullsThatWereLadenImmediately() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), size_t{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + outlet->GetNumPullsThatWereLadenImmediately();
-        },
-        Filter{}
-      );
+      return Sum( &this_t::GetNumPullsThatWereLadenImmediately );
     }
 
     static size_t GetNumTryPullsThatWereLaden() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), size_t{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + outlet->GetNumTryPullsThatWereLaden();
-        },
-        Filter{}
-      );
+      return Sum( &this_t::GetNumTryPullsThatWereLaden );
     }
 
     static size_t GetNumTryPullsThatWereUnladen() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), size_t{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + outlet->GetNumTryPullsThatWereUnladen();
-        },
-        Filter{}
-      );
+      return Sum( &this_t::GetNumTryPullsThatWereUnladen );
     }
 
     static size_t GetNumRoundTripTouches() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), size_t{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + outlet->GetCurRoundTripTouchCount();
-        },
-        Filter{}
-      );
+      return Sum( &this_t::GetCurRoundTripTouchCount );
     }
 
-    static double GetFractionTryPullsThatWereLaden() {
-      struct Adder {
-        size_t num_try_pulls_that_were_laden{};
-        size_t num_try_pulls_attempted{};
-        double GetRatio() const {
-          return num_try_pulls_that_were_laden / static_cast<double>(
-            num_try_pulls_attempted
-          );
+    static size_t GetNetFluxThroughDuct() {
+      return Sum( &this_t::GetNetFluxThroughDuct );
+    }
+
+    static size_t GetNumOutlets() {
+      size_t res{};
+      registry.Visit( [&res](const this_t* outlet){
+        if ( Filter{}( outlet ) ) ++res;
+      } );
+      return res;
+    }
+
+    /**
+     * Sum net flux through duct over registered outlets that pass Filter,
+     * per edge. Outlets not registered with an edge are skipped.
+     *
+     * @return map of edge ID to net flux through that edge's duct.
+     */
+    static std::unordered_map<size_t, size_t> GetNetFluxThroughDuctByEdge() {
+      std::unordered_map<size_t, size_t> res;
+      registry.Visit( [&res](const this_t* outlet){
+        if ( !Filter{}( outlet ) ) return;
+        if ( const auto edge_id = outlet->LookupEdgeID() ) {
+          res[ *edge_id ] += outlet->GetNetFluxThroughDuct();
         }
-      };
-
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), Adder{},
-        [](Adder accum, const this_t* inlet) {
-          accum.num_try_pulls_that_were_laden
-            += inlet->GetNumTryPullsThatWereLaden();
-          accum.num_try_pulls_attempted += inlet->GetNumTryPullsAttempted();
-          return accum;
-        },
-        Filter{}
-      ).GetRatio();
+      } );
+      return res;
+    }
+
+    /**
+     * Sum reads performed over registered outlets that pass Filter, per
+     * node reading from them. Outlets not registered with a node are
+     * skipped.
+     *
+     * @return map of outlet node ID to reads performed by that node.
+     */
+    static std::unordered_map<size_t, size_t> GetNumReadsPerformedByNode() {
+      std::unordered_map<size_t, size_t> res;
+      registry.Visit( [&res](const this_t* outlet){
+        if ( !Filter{}( outlet ) ) return;
+        if ( const auto node_id = outlet->LookupOutletNodeID() ) {
+          res[ *node_id ] += outlet->GetNumReadsPerformed();
+        }
+      } );
+      return res;
     }
 
+    static double GetFractionTryPullsThatWereLaden() {
+      return SumRatio(
+        &this_t::GetNumTryPullsThatWereLaden,
+        &this_t::GetNumTryPullsAttempted
+      );
+    }
 
     static double GetFractionTryPullsThatWereUnladen() {
-      struct Adder {
-        size_t num_try_pulls_that_were_unladen{};
-        size_t num_try_pulls_attempted{};
-        double GetRatio() const {
-          return num_try_pulls_that_were_unladen / static_cast<double>(
-            num_try_pulls_attempted
-          );
-        }
-      };
-
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), Adder{},
-        [](Adder accum, const this_t* inlet) {
-          accum.num_try_pulls_that_were_unladen
-            += inlet->GetNumTryPullsThatWereUnladen();
-          accum.num_try_pulls_attempted += inlet->GetNumTryPullsAttempted();
-          return accum;
-        },
-        Filter{}
-      ).GetRatio();
+      return SumRatio(
+        &this_t::GetNumTryPullsThatWereUnladen,
+        &this_t::GetNumTryPullsAttempted
+      );
     }
 
     static double GetFractionBlockingPullsThatBlocked() {
-      struct Adder {
-        size_t num_blocking_pulls_that_blocked{};
-        size_t num_blocking_pulls{};
-        double GetRatio() const {
-          return num_blocking_pulls_that_blocked / static_cast<double>(
-            num_blocking_pulls
-          );
-        }
-      };
-
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), Adder{},
-        [](Adder accum, const this_t* inlet) {
-          accum.num_blocking_pulls_that_blocked
-            += inlet->GetNumBlockingPullsThatBlocked();
-          accum.num_blocking_pulls += inlet->GetNumBlockingPulls();
-          return accum;
-        },
-        Filter{}
-      ).GetRatio();
+      return SumRatio(
+        &this_t::GetNumBlockingPullsThatBlocked,
+        &this_t::GetNumBlockingPulls
+      );
     }
 
     static double GetFractionBlockingPullsThatWereLadenImmediately() {
-      struct Adder {
-        size_t num_blocking_pulls_that_were_laden_immediately{};
-        size_t num_blocking_pulls{};
-        double GetRatio() const {
-          return num_blocking_pulls_that_were_laden_immediately
-            / static_cast<double>( num_blocking_pulls );
-        }
-      };
-
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), Adder{},
-        [](Adder accum, const this_t* inlet) {
-          accum.num_blocking_pulls_that_were_laden_immediately
-            += inlet->GetNumBlockingPullsThatWereLadenImmediately();
-          accum.num_blocking_pulls += inlet->GetNumBlockingPulls();
-          return accum;
-        },
-        Filter{}
-      ).GetRatio();
+      return SumRatio(
+        &this_t::GetNumBlockingPullsThatWereLadenImmediately,
+        &this_t::GetNumBlockingPulls
+      );
     }
 
     static double GetFractionBlockingPullsThatWereLadenEventually() {
-      struct Adder {
-        size_t num_blocking_pulls_that_were_laden_eventually{};
-        size_t num_blocking_pulls{};
-        double GetRatio() const {
-          return num_blocking_pulls_that_were_laden_eventually
-            / static_cast<double>( num_blocking_pulls );
-        }
-      };
-
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), Adder{},
-        [](Adder accum, const this_t* inlet) {
-          accum.num_blocking_pulls_that_were_laden_eventually
-            += inlet->GetNumBlockingPullsThatWereLadenEventually();
-          accum.num_blocking_pulls += inlet->GetNumBlockingPulls();
-          return accum;
-        },
-        Filter{}
-      ).GetRatio();
+      return SumRatio(
+        &this_t::GetNumBlockingPullsThatWereLadenEventually,
+        &this_t::GetNumBlockingPulls
+      );
     }
 
     static double GetFractionPullsThatWereLadenImmediately() {
-      struct Adder {
-        size_t num_blocking_pulls_that_were_laden_immediately{};
-        size_t num_pulls_attempted{};
-        double GetRatio() const {
-          return num_blocking_pulls_that_were_laden_immediately
-            / static_cast<double>( num_pulls_attempted );
-        }
-      };
-
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), Adder{},
-        [](Adder accum, const this_t* inlet) {
-          accum.num_blocking_pulls_that_were_laden_immediately
-            += inlet->GetNumPullsThatWereLadenImmediately();
-          accum.num_pulls_attempted += inlet->GetNumPullsAttempted();
-          return accum;
-        },
-        Filter{}
-      ).GetRatio();
+      return SumRatio(
+        &this_t::GetNumPullsThatWereLadenImmediately,
+        &this_t::GetNumPullsAttempted
+      );
     }
 
     static double GetFractionPullsThatWereLadenEventually() {
-      struct Adder {
-        size_t num_blocking_pulls_that_were_laden_eventually{};
-        size_t num_pulls_attempted{};
-        double GetRatio() const {
-          return num_blocking_pulls_that_were_laden_eventually
-            / static_cast<double>( num_pulls_attempted );
-        }
-      };
-
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), Adder{},
-        [](Adder accum, const this_t* inlet) {
-          accum.num_blocking_pulls_that_were_laden_eventually
-            += inlet->GetNumPullsThatWereLadenEventually();
-          accum.num_pulls_attempted += inlet->GetNumPullsAttempted();
-          return accum;
-        },
-        Filter{}
-      ).GetRatio();
-    }
-
-    static size_t GetNetFluxThroughDuct() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), size_t{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + outlet->GetNetFluxThroughDuct();
-        },
-        Filter{}
+      return SumRatio(
+        &this_t::GetNumPullsThatWereLadenEventually,
+        &this_t::GetNumPullsAttempted
       );
     }
 
     static double GetFractionReadsThatWereFresh() {
-      struct Adder {
-        size_t num_reads_that_were_fresh{};
-        size_t num_reads_performed{};
-        double GetRatio() const {
-          return num_reads_that_were_fresh
-            / static_cast<double>( num_reads_performed );
-        }
-      };
-
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), Adder{},
-        [](Adder accum, const this_t* inlet) {
-          accum.num_reads_that_were_fresh += inlet->GetNumReadsThatWereFresh();
-          accum.num_reads_performed += inlet->GetNumReadsPerformed();
-          return accum;
-        },
-        Filter{}
-      ).GetRatio();
+      return SumRatio(
+        &this_t::GetNumReadsThatWereFresh,
+        &this_t::GetNumReadsPerformed
+      );
     }
 
     static double GetFractionReadsThatWereStale() {
-      struct Adder {
-        size_t num_reads_that_were_stale{};
-        size_t num_reads_performed{};
-        double GetRatio() const {
-          return num_reads_that_were_stale
-            / static_cast<double>( num_reads_performed );
-        }
-      };
-
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), Adder{},
-        [](Adder accum, const this_t* inlet) {
-          accum.num_reads_that_were_stale += inlet->GetNumReadsThatWereStale();
-          accum.num_reads_performed += inlet->GetNumReadsPerformed();
-          return accum;
-        },
-        Filter{}
-      ).GetRatio();
+      return SumRatio(
+        &this_t::GetNumReadsThatWereStale,
+        &this_t::GetNumReadsPerformed
+      );
     }
 
     static double GetFractionRevisionsThatWereRead() {
-      struct Adder {
-        size_t num_reads_that_were_fresh{};
-        size_t num_revisions_pulled{};
-        double GetRatio() const {
-          return num_reads_that_were_fresh
-            / static_cast<double>( num_revisions_pulled );
-        }
-      };
-
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), Adder{},
-        [](Adder accum, const this_t* inlet) {
-          accum.num_reads_that_were_fresh += inlet->GetNumReadsThatWereFresh();
-          accum.num_revisions_pulled += inlet->GetNumRevisionsPulled();
-          return accum;
-        },
-        Filter{}
-      ).GetRatio();
+      return SumRatio(
+        &this_t::GetNumReadsThatWereFresh,
+        &this_t::GetNumRevisionsPulled
+      );
     }
 
     static double GetFractionRevisionsThatWereNotRead() {
@@ -480,25 +561,10 @@ class InstrumentationAggregatingOutletWrapper {
     }
 
     static double GetFractionDuctFluxThatWasSteppedThrough() {
-      struct Adder {
-        size_t num_revisions_pulled{};
-        size_t net_flux_through_duct{};
-        double GetRatio() const {
-          return num_revisions_pulled
-            / static_cast<double>( net_flux_through_duct );
-        }
-      };
-
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), Adder{},
-        [](Adder accum, const this_t* inlet) {
-          accum.num_revisions_pulled += inlet->GetNumRevisionsPulled();
-          accum.net_flux_through_duct += inlet->GetNetFluxThroughDuct();
-          return accum;
-        },
-        Filter{}
-      ).GetRatio();
+      return SumRatio(
+        &this_t::GetNumRevisionsPulled,
+        &this_t::GetNetFluxThroughDuct
+      );
     }
 
     static double GetFractionDuctFluxThatWasJumpedOver() {
@@ -506,196 +572,87 @@ class InstrumentationAggregatingOutletWrapper {
     }
 
     static double GetFractionDuctFluxThatWasRead() {
-      struct Adder {
-        size_t num_reads_that_were_fresh{};
-        size_t net_flux_through_duct{};
-        double GetRatio() const {
-          return num_reads_that_were_fresh
-            / static_cast<double>( net_flux_through_duct );
-        }
-      };
-
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), Adder{},
-        [](Adder accum, const this_t* inlet) {
-          accum.num_reads_that_were_fresh += inlet->GetNumReadsThatWereFresh();
-          accum.net_flux_through_duct += inlet->GetNetFluxThroughDuct();
-          return accum;
-        },
-        Filter{}
-      ).GetRatio();
+      return SumRatio(
+        &this_t::GetNumReadsThatWereFresh,
+        &this_t::GetNetFluxThroughDuct
+      );
     }
 
     static double GetRoundTripTouchesPerAttemptedPull() {
-      struct Adder {
-        size_t num_round_trip_touches{};
-        size_t num_attempted_pulls{};
-        double GetRatio() const {
-          return num_round_trip_touches
-            / static_cast<double>( num_attempted_pulls );
-        }
-      };
-
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), Adder{},
-        [](Adder accum, const this_t* inlet) {
-          accum.num_round_trip_touches += inlet->GetCurRoundTripTouchCount();
-          accum.num_attempted_pulls += inlet->GetNumPullsAttempted();
-          return accum;
-        },
-        Filter{}
-      ).GetRatio();
-    }
-
-    static size_t GetNumOutlets() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return std::count_if(
-        std::begin(registry), std::end(registry),
-        Filter{}
+      return SumRatio(
+        &this_t::GetCurRoundTripTouchCount,
+        &this_t::GetNumPullsAttempted
       );
     }
 
     static double GetMeanFractionTryPullsThatWereLaden() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), double{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + (
-            outlet->GetNumTryPullsThatWereLaden()
-            / static_cast<double>( outlet->GetNumTryPullsAttempted() )
-          );
-        },
-        Filter{}
-      ) / GetNumOutlets();
+      return MeanRatio(
+        &this_t::GetNumTryPullsThatWereLaden,
+        &this_t::GetNumTryPullsAttempted
+      );
     }
 
-
     static double GetMeanFractionTryPullsThatWereUnladen() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), double{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + (
-            outlet->GetNumTryPullsThatWereUnladen()
-            / static_cast<double>( outlet->GetNumTryPullsAttempted() )
-          );
-        },
-        Filter{}
-      ) / GetNumOutlets();
+      return MeanRatio(
+        &this_t::GetNumTryPullsThatWereUnladen,
+        &this_t::GetNumTryPullsAttempted
+      );
     }
 
     static double GetMeanFractionBlockingPullsThatBlocked() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), double{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + (
-            outlet->GetNumBlockingPullsThatBlocked()
-            / static_cast<double>( outlet->GetNumBlockingPulls() )
-          );
-        },
-        Filter{}
-      ) / GetNumOutlets();
+      return MeanRatio(
+        &this_t::GetNumBlockingPullsThatBlocked,
+        &this_t::GetNumBlockingPulls
+      );
     }
 
     static double GetMeanFractionBlockingPullsThatWereLadenImmediately() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), double{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + (
-            outlet->GetNumBlockingPullsThatWereLadenImmediately()
-            / static_cast<double>( outlet->GetNumBlockingPulls() )
-          );
-        },
-        Filter{}
-      ) / GetNumOutlets();
+      return MeanRatio(
+        &this_t::GetNumBlockingPullsThatWereLadenImmediately,
+        &this_t::GetNumBlockingPulls
+      );
     }
 
     static double GetMeanFractionBlockingPullsThatWereLadenEventually() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), double{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + (
-            outlet->GetNumBlockingPullsThatWereLadenEventually()
-            / static_cast<double>( outlet->GetNumBlockingPulls() )
-          );
-        },
-        Filter{}
-      ) / GetNumOutlets();
+      return MeanRatio(
+        &this_t::GetNumBlockingPullsThatWereLadenEventually,
+        &this_t::GetNumBlockingPulls
+      );
     }
 
     static double GetMeanFractionPullsThatWereLadenImmediately() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), double{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + (
-            outlet->GetNumPullsThatWereLadenImmediately()
-            / static_cast<double>( outlet->GetNumPullsAttempted() )
-          );
-        },
-        Filter{}
-      ) / GetNumOutlets();
+      return MeanRatio(
+        &this_t::GetNumPullsThatWereLadenImmediately,
+        &this_t::GetNumPullsAttempted
+      );
     }
 
     static double GetMeanFractionPullsThatWereLadenEventually() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), double{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + (
-            outlet->GetNumPullsThatWereLadenEventually()
-            / static_cast<double>( outlet->GetNumPullsAttempted() )
-          );
-        },
-        Filter{}
-      ) / GetNumOutlets();
+      return MeanRatio(
+        &this_t::GetNumPullsThatWereLadenEventually,
+        &this_t::GetNumPullsAttempted
+      );
     }
 
     static double GetMeanFractionReadsThatWereFresh() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), double{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + (
-            outlet->GetNumReadsThatWereFresh()
-            / static_cast<double>( outlet->GetNumReadsPerformed() )
-          );
-        },
-        Filter{}
-      ) / GetNumOutlets();
+      return MeanRatio(
+        &this_t::GetNumReadsThatWereFresh,
+        &this_t::GetNumReadsPerformed
+      );
     }
 
     static double GetMeanFractionReadsThatWereStale() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), double{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + (
-            outlet->GetNumReadsThatWereStale()
-            / static_cast<double>( outlet->GetNumReadsPerformed() )
-          );
-        },
-        Filter{}
-      ) / GetNumOutlets();
+      return MeanRatio(
+        &this_t::GetNumReadsThatWereStale,
+        &this_t::GetNumReadsPerformed
+      );
     }
 
     static double GetMeanFractionRevisionsThatWereRead() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), double{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + (
-            outlet->GetNumReadsThatWereFresh()
-            / static_cast<double>( outlet->GetNumRevisionsPulled() )
-          );
-        },
-        Filter{}
-      ) / GetNumOutlets();
+      return MeanRatio(
+        &this_t::GetNumReadsThatWereFresh,
+        &this_t::GetNumRevisionsPulled
+      );
     }
 
     static double GetMeanFractionRevisionsThatWereNotRead() {
@@ -703,17 +660,10 @@ class InstrumentationAggregatingOutletWrapper {
     }
 
     static double GetMeanFractionDuctFluxThatWasSteppedThrough() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), double{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + (
-            outlet->GetNumRevisionsPulled()
-            / static_cast<double>( outlet->GetNetFluxThroughDuct() )
-          );
-        },
-        Filter{}
-      ) / GetNumOutlets();
+      return MeanRatio(
+        &this_t::GetNumRevisionsPulled,
+        &this_t::GetNetFluxThroughDuct
+      );
     }
 
     static double GetMeanFractionDuctFluxThatWasJumpedOver() {
@@ -721,259 +671,294 @@ class InstrumentationAggregatingOutletWrapper {
     }
 
     static double GetMeanFractionDuctFluxThatWasRead() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), double{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + (
-            outlet->GetNumReadsThatWereFresh()
-            / static_cast<double>( outlet->GetNetFluxThroughDuct() )
-          );
-        },
-        Filter{}
-      ) / GetNumOutlets();
+      return MeanRatio(
+        &this_t::GetNumReadsThatWereFresh,
+        &this_t::GetNetFluxThroughDuct
+      );
     }
 
     static double GetMeanRoundTripTouchesPerAttemptedPull() {
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), double{},
-        [](size_t accum, const this_t* outlet) {
-          return accum + (
-            outlet->GetCurRoundTripTouchCount()
-            / static_cast<double>( outlet->GetNumPullsAttempted() )
-          );
-        },
-        Filter{}
-      ) / GetNumOutlets();
+      return MeanRatio(
+        &this_t::GetCurRoundTripTouchCount,
+        &this_t::GetNumPullsAttempted
+      );
     }
 
-    // capture these from each outlet as close together as possible
     static std::string JointGet_NumPullsAttempted_NumRoundTripTouches() {
-      struct JointAdder {
-        size_t num_pulls_attempted{};
-        size_t num_round_trip_touches{};
-
-        std::string pack() const {
-          return emp::to_string(
-            num_pulls_attempted, ',', num_round_trip_touches
-          );
-        }
-
-      };
-
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), JointAdder{},
-        [](auto accum, const this_t* outlet) {
-          accum.num_pulls_attempted += outlet->GetNumPullsAttempted();
-          accum.num_round_trip_touches += outlet->GetCurRoundTripTouchCount();
-          return accum;
-        },
-        Filter{}
-      ).pack();
+      const auto [num_pulls_attempted, num_round_trip_touches] = SumEach(
+        &this_t::GetNumPullsAttempted,
+        &this_t::GetCurRoundTripTouchCount
+      );
+      return emp::to_string( num_pulls_attempted, ',', num_round_trip_touches );
     }
 
-    // capture these from each outlet as close together as possible
     static std::string JointGet_NetFluxThroughDuct_NumTryPullsAttempted_NumTryPullsThatWereLaden() {
-      struct JointAdder {
-        size_t net_flux_through_duct{};
-        size_t num_try_pulls_attempted{};
-        size_t num_try_pulls_that_were_laden{};
-
-        std::string pack() const {
-          return emp::to_string(
-            net_flux_through_duct,
-            ',', num_try_pulls_attempted,
-            ',', num_try_pulls_that_were_laden
-          );
-        }
-
-      };
-
-      std::shared_lock lock{ registry.GetMutex() };
-      return uitsl::accumulate_if(
-        std::begin(registry), std::end(registry), JointAdder{},
-        [](auto accum, const this_t* outlet) {
-          accum.net_flux_through_duct += outlet->GetNetFluxThroughDuct();
-          accum.num_try_pulls_attempted += outlet->GetNumTryPullsAttempted();
-          accum.num_try_pulls_that_were_laden
-            += outlet->GetNumTryPullsThatWereLaden();
-          return accum;
-        },
-        Filter{}
-      ).pack();
+      const auto [
+        net_flux_through_duct,
+        num_try_pulls_attempted,
+        num_try_pulls_that_were_laden
+      ] = SumEach(
+        &this_t::GetNetFluxThroughDuct,
+        &this_t::GetNumTryPullsAttempted,
+        &this_t::GetNumTryPullsThatWereLaden
+      );
+      return emp::to_string(
+        net_flux_through_duct,
+        ',', num_try_pulls_attempted,
+        ',', num_try_pulls_that_were_laden
+      );
     }
 
+    // each row reads every column from one snapshot taken at row start
     static emp::DataFile MakeSummaryDataFile(const std::string& filename) {
+      const auto snapshot = std::make_shared<snapshot_t>();
+
       emp::DataFile res( filename );
       res.AddFun(
-        [](){
-          return std::chrono::time_point_cast<std::chrono::nanoseconds>(
-            std::chrono::steady_clock::now()
-          ).time_since_epoch().count();
+        [snapshot](){
+          const auto timepoint = std::chrono::time_point_cast<
+            std::chrono::nanoseconds
+          >( std::chrono::steady_clock::now() ).time_since_epoch().count();
+          *snapshot = TakeSnapshot();
+          return timepoint;
         },
         "Row Initial Timepoint (ns)"
       );
       res.AddVal(uitsl::get_proc_id(), "proc");
       res.AddVal(Filter::name(), "Impl Filter");
-      res.AddFun(GetNumOutlets, "Num Outlets");
-      res.AddFun(GetNumReadsPerformed, "Num Reads Performed");
-      res.AddFun(GetNumReadsThatWereFresh, "Num Reads That Were Fresh");
-      res.AddFun(GetNumReadsThatWereStale, "Num Reads That Were Stale");
-      res.AddFun(GetNumRevisionsPulled, "Num Revisions Pulled");
       res.AddFun(
-        JointGet_NetFluxThroughDuct_NumTryPullsAttempted_NumTryPullsThatWereLaden,
+        [snapshot](){ return snapshot->num_outlets; },
+        "Num Outlets"
+      );
+      res.AddFun(
+        [snapshot](){ return snapshot->num_reads_performed; },
+        "Num Reads Performed"
+      );
+      res.AddFun(
+        [snapshot](){ return snapshot->num_reads_that_were_fresh; },
+        "Num Reads That Were Fresh"
+      );
+      res.AddFun(
+        [snapshot](){ return snapshot->num_reads_that_were_stale; },
+        "Num Reads That Were Stale"
+      );
+      res.AddFun(
+        [snapshot](){ return snapshot->num_revisions_pulled; },
+        "Num Revisions Pulled"
+      );
+      res.AddFun(
+        [snapshot](){
+          return emp::to_string(
+            snapshot->net_flux_through_duct,
+            ',', snapshot->num_try_pulls_attempted,
+            ',', snapshot->num_try_pulls_that_were_laden
+          );
+        },
         "Net Flux Through Duct,Num Try Pulls Attempted,Num Try Pulls That Were Laden"
       );
-      res.AddFun(GetNumBlockingPulls, "Num Blocking Pulls");
       res.AddFun(
-        GetNumBlockingPullsThatBlocked, "Num Blocking Pulls That Blocked"
+        [snapshot](){ return snapshot->num_blocking_pulls; },
+        "Num Blocking Pulls"
+      );
+      res.AddFun(
+        [snapshot](){ return snapshot->num_blocking_pulls_that_blocked; },
+        "Num Blocking Pulls That Blocked"
       );
       res.AddFun(
-        GetNumRevisionsFromTryPulls, "Num Revisions From Try Pulls"
+        [snapshot](){ return snapshot->num_revisions_from_try_pulls; },
+        "Num Revisions From Try Pulls"
       );
       res.AddFun(
-        GetNumRevisionsFromBlockingPulls, "Num Revisions From Blocking Pulls"
+        [snapshot](){ return snapshot->num_revisions_from_blocking_pulls; },
+        "Num Revisions From Blocking Pulls"
       );
       res.AddFun(
-        JointGet_NumPullsAttempted_NumRoundTripTouches,
+        [snapshot](){
+          return emp::to_string(
+            snapshot->num_pulls_attempted,
+            ',', snapshot->num_round_trip_touches
+          );
+        },
         "Num Pulls Attempted,Num Round Trip Touches"
       );
       res.AddFun(
-        GetNumPullsThatWereLadenEventually,
+        [snapshot](){ return snapshot->num_pulls_that_were_laden_eventually; },
         "Num Pulls That Were Laden Eventually"
       );
       res.AddFun(
-        GetNumBlockingPullsThatWereLadenImmediately,
+        [snapshot](){
+          return snapshot->num_blocking_pulls_that_were_laden_immediately;
+        },
         "Num Blocking Pulls That Were Laden Immediately"
       );
       res.AddFun(
-        GetNumBlockingPullsThatWereLadenEventually,
+        [snapshot](){
+          return snapshot->num_blocking_pulls_that_were_laden_eventually;
+        },
         "Num Blocking Pulls That Were Laden Eventually"
       );
       res.AddFun(
-        GetNumPullsThatWereLadenImmediately,
+        [snapshot](){ return snapshot->num_pulls_that_were_laden_immediately; },
         "Num Pulls That Were Laden Immediately"
       );
       res.AddFun(
-        GetNumTryPullsThatWereUnladen, "Num Try Pulls That Were Unladen"
+        [snapshot](){ return snapshot->num_try_pulls_that_were_unladen; },
+        "Num Try Pulls That Were Unladen"
       );
       res.AddFun(
-        GetFractionTryPullsThatWereLaden, "Fraction Try Pulls That Were Laden"
+        [snapshot](){ return snapshot->GetFractionTryPullsThatWereLaden(); },
+        "Fraction Try Pulls That Were Laden"
       );
       res.AddFun(
-        GetFractionTryPullsThatWereUnladen,
+        [snapshot](){ return snapshot->GetFractionTryPullsThatWereUnladen(); },
         "Fraction Try Pulls That Were Unladen"
       );
       res.AddFun(
-        GetFractionBlockingPullsThatBlocked,
+        [snapshot](){ return snapshot->GetFractionBlockingPullsThatBlocked(); },
         "Fraction Blocking Pulls That Blocked"
       );
       res.AddFun(
-        GetFractionBlockingPullsThatWereLadenImmediately,
+        [snapshot](){
+          return snapshot->GetFractionBlockingPullsThatWereLadenImmediately();
+        },
         "Fraction Blocking Pulls That Were Laden Immediately"
       );
       res.AddFun(
-        GetFractionBlockingPullsThatWereLadenEventually,
+        [snapshot](){
+          return snapshot->GetFractionBlockingPullsThatWereLadenEventually();
+        },
         "Fraction Blocking Pulls That Were Laden Eventually"
       );
       res.AddFun(
-        GetFractionPullsThatWereLadenImmediately,
+        [snapshot](){
+          return snapshot->GetFractionPullsThatWereLadenImmediately();
+        },
         "Fraction Pulls That Were Laden Immediately"
       );
       res.AddFun(
-        GetFractionPullsThatWereLadenEventually,
+        [snapshot](){
+          return snapshot->GetFractionPullsThatWereLadenEventually();
+        },
         "Fraction Pulls That Were Laden Eventually"
       );
       res.AddFun(
-        GetFractionReadsThatWereFresh, "Fraction Reads That Were Fresh"
+        [snapshot](){ return snapshot->GetFractionReadsThatWereFresh(); },
+        "Fraction Reads That Were Fresh"
       );
       res.AddFun(
-        GetFractionReadsThatWereStale,
+        [snapshot](){ return snapshot->GetFractionReadsThatWereStale(); },
         "Fraction Reads That Were Stale"
       );
       res.AddFun(
-        GetFractionRevisionsThatWereRead,
+        [snapshot](){ return snapshot->GetFractionRevisionsThatWereRead(); },
         "Fraction Revisions That Were Read"
       );
       res.AddFun(
-        GetFractionRevisionsThatWereNotRead,
+        [snapshot](){ return snapshot->GetFractionRevisionsThatWereNotRead(); },
         "Fraction Revisions That Were Not Read"
       );
       res.AddFun(
-        GetFractionDuctFluxThatWasSteppedThrough,
+        [snapshot](){
+          return snapshot->GetFractionDuctFluxThatWasSteppedThrough();
+        },
         "Fraction Duct Flux That Was Stepped Through"
       );
       res.AddFun(
-        GetFractionDuctFluxThatWasJumpedOver,
+        [snapshot](){
+          return snapshot->GetFractionDuctFluxThatWasJumpedOver();
+        },
         "Fraction Duct Flux That Was Jumped Over"
       );
       res.AddFun(
-        GetFractionDuctFluxThatWasRead,
+        [snapshot](){ return snapshot->GetFractionDuctFluxThatWasRead(); },
         "Fraction Duct Flux That Was Read"
       );
       res.AddFun(
-        GetRoundTripTouchesPerAttemptedPull,
+        [snapshot](){ return snapshot->GetRoundTripTouchesPerAttemptedPull(); },
         "Round Trip Touches Per Attempted Pull"
       );
       res.AddFun(
-        GetMeanFractionTryPullsThatWereLaden,
+        [snapshot](){
+          return snapshot->GetMeanFractionTryPullsThatWereLaden();
+        },
         "Mean Fraction Try Pulls That Were Laden"
       );
       res.AddFun(
-        GetMeanFractionTryPullsThatWereUnladen,
+        [snapshot](){
+          return snapshot->GetMeanFractionTryPullsThatWereUnladen();
+        },
         "Mean Fraction Try Pulls That Were Unladen"
       );
       res.AddFun(
-        GetMeanFractionBlockingPullsThatBlocked,
+        [snapshot](){
+          return snapshot->GetMeanFractionBlockingPullsThatBlocked();
+        },
         "Mean Fraction Blocking Pulls That Blocked"
       );
       res.AddFun(
-        GetMeanFractionBlockingPullsThatWereLadenImmediately,
+        [snapshot](){
+          return snapshot->GetMeanFractionBlockingPullsThatWereLadenImmediately();
+        },
         "Mean Fraction Blocking Pulls That Were Laden Immediately"
       );
       res.AddFun(
-        GetMeanFractionBlockingPullsThatWereLadenEventually,
+        [snapshot](){
+          return snapshot->GetMeanFractionBlockingPullsThatWereLadenEventually();
+        },
         "Mean Fraction Blocking Pulls That Were Laden Eventually"
       );
       res.AddFun(
-        GetMeanFractionPullsThatWereLadenImmediately,
+        [snapshot](){
+          return snapshot->GetMeanFractionPullsThatWereLadenImmediately();
+        },
         "Mean Fraction Pulls That Were Laden Immediately"
       );
       res.AddFun(
-        GetMeanFractionPullsThatWereLadenEventually,
+        [snapshot](){
+          return snapshot->GetMeanFractionPullsThatWereLadenEventually();
+        },
         "Mean Fraction Pulls That Were Laden Eventually"
       );
       res.AddFun(
-        GetMeanFractionReadsThatWereFresh, "Mean Fraction Reads That Were Fresh"
+        [snapshot](){ return snapshot->GetMeanFractionReadsThatWereFresh(); },
+        "Mean Fraction Reads That Were Fresh"
       );
       res.AddFun(
-        GetMeanFractionReadsThatWereStale,
+        [snapshot](){ return snapshot->GetMeanFractionReadsThatWereStale(); },
         "Mean Fraction Reads That Were Stale"
       );
       res.AddFun(
-        GetMeanFractionRevisionsThatWereRead,
+        [snapshot](){
+          return snapshot->GetMeanFractionRevisionsThatWereRead();
+        },
         "Mean Fraction Revisions That Were Read"
       );
       res.AddFun(
-        GetMeanFractionRevisionsThatWereNotRead,
+        [snapshot](){
+          return snapshot->GetMeanFractionRevisionsThatWereNotRead();
+        },
         "Mean Fraction Revisions That Were Not Read"
       );
       res.AddFun(
-        GetMeanFractionDuctFluxThatWasSteppedThrough,
+        [snapshot](){
+          return snapshot->GetMeanFractionDuctFluxThatWasSteppedThrough();
+        },
         "Mean Fraction Duct Flux That Was Stepped Through"
       );
       res.AddFun(
-        GetMeanFractionDuctFluxThatWasJumpedOver,
+        [snapshot](){
+          return snapshot->GetMeanFractionDuctFluxThatWasJumpedOver();
+        },
         "Mean Fraction Duct Flux That Was Jumped Over"
       );
       res.AddFun(
-        GetMeanFractionDuctFluxThatWasRead,
+        [snapshot](){ return snapshot->GetMeanFractionDuctFluxThatWasRead(); },
         "Mean Fraction Duct Flux That Was Read"
       );
       res.AddFun(
-        GetMeanRoundTripTouchesPerAttemptedPull,
+        [snapshot](){
+          return snapshot->GetMeanRoundTripTouchesPerAttemptedPull();
+        },
         "Mean Round Trip Touches Per Attempted Pull"
       );
       res.AddFun(
@@ -999,11 +984,7 @@ class InstrumentationAggregatingOutletWrapper {
       );
       res.SetFilterContainerFun( Filter{} );
       res.SetLockContainerFun( [](const auto& container_ptr){
-        using mutex_t = std::decay_t<decltype(container_ptr->GetMutex())>;
-        using lock_t = std::shared_lock<mutex_t>;
-        return std::make_shared<lock_t>(
-          container_ptr->GetMutex()
-        );
+        return container_ptr->MakeSharedLock();
       } );
       res.AddFun(
         [](){
@@ -1281,6 +1262,10 @@ class InstrumentationAggregatingOutletWrapper {
   >;
   mutable touch_count_address_cache_t touch_count_address_cache{ std::nullopt };
 
+  // declared after all other data members, so registered only once they're
+  // constructed and deregistered before they're destroyed
+  typename decltype(registry)::Registration registration{ registry, this };
+
   void DoRefreshTouchCountAddressCache() const {
     touch_count_address_cache = uit::impl::round_trip_touch_addr_t{
       *LookupMeshID(), *LookupOutletNodeID(), *LookupInletNodeID()
@@ -1327,45 +1312,32 @@ public:
    */
   InstrumentationAggregatingOutletWrapper(
     InstrumentationAggregatingOutletWrapper& other
-  ) : outlet( other.outlet ) {
-    emp_assert( !registry.contains(this) );
-    registry.insert(this);
-  }
+  ) : outlet( other.outlet )
+  { }
 
   /**
    * Copy constructor.
    */
   InstrumentationAggregatingOutletWrapper(
     const InstrumentationAggregatingOutletWrapper& other
-  ) : outlet( other.outlet ) {
-    emp_assert( !registry.contains(this) );
-    registry.insert(this);
-  };
+  ) : outlet( other.outlet )
+  { }
 
   /**
    * Move constructor.
    */
   InstrumentationAggregatingOutletWrapper(
     InstrumentationAggregatingOutletWrapper&& other
-  ) : outlet( std::move(other.outlet) ) {
-    emp_assert( !registry.contains(this) );
-    registry.insert(this);
-  };
+  ) : outlet( std::move(other.outlet) )
+  { }
 
   /**
    * Forwarding constructor.
    */
   template <typename... Args>
   explicit InstrumentationAggregatingOutletWrapper(Args&&... args)
-  : outlet(std::forward<Args>(args)...) {
-    emp_assert( !registry.contains(this) );
-    registry.insert(this);
-  }
-
-  ~InstrumentationAggregatingOutletWrapper() {
-    [[maybe_unused]] const size_t res = registry.erase( this );
-    emp_assert( res == 1, res );
-  }
+  : outlet(std::forward<Args>(args)...)
+  { }
 
   size_t TryStep(const size_t num_steps) {
     const size_t res = outlet.TryStep( num_steps );
@@ -1550,8 +1522,14 @@ public:
 
   decltype(auto) WhichImplHeld() const { return outlet.WhichImplHeld(); }
 
+  decltype(auto) GetNumProcTransfers() const {
+    return outlet.GetNumProcTransfers();
+  }
+
   decltype(auto) CanStep() const { return outlet.CanStep(); }
 
+  decltype(auto) GetReadyKey() const { return outlet.GetReadyKey(); }
+
   void RegisterInletProc(const uitsl::proc_id_t proc) const {
     outlet.RegisterInletProc(proc);
   }
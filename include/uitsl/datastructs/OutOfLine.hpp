@@ -0,0 +1,72 @@
+#pragma once
+#ifndef UITSL_DATASTRUCTS_OUTOFLINE_HPP_INCLUDE
+#define UITSL_DATASTRUCTS_OUTOFLINE_HPP_INCLUDE
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+namespace uitsl {
+
+namespace internal {
+
+// is the argument pack a single (possibly cv/ref-qualified) Self?
+template<typename Self, typename... Args>
+struct is_single_self : std::false_type {};
+
+template<typename Self, typename Arg>
+struct is_single_self<Self, Arg>
+: std::is_same<std::decay_t<Arg>, Self> {};
+
+} // namespace internal
+
+/**
+ * Owns a single T on the heap, so that holders (e.g., a `std::variant`) pay
+ * only for a pointer rather than for the whole of T.
+ *
+ * Unlike `std::unique_ptr`, always holds a value. Moved-from instances may
+ * only be destroyed or assigned to.
+ */
+template<typename T>
+class OutOfLine {
+
+  std::unique_ptr<T> ptr;
+
+public:
+
+  using value_type = T;
+
+  /// Construct the held T in place from args. Never chosen over copy or move.
+  template<
+    typename... Args,
+    typename = std::enable_if_t<
+      !internal::is_single_self<OutOfLine, Args...>::value
+    >
+  >
+  explicit OutOfLine(Args&&... args)
+  : ptr( std::make_unique<T>(std::forward<Args>(args)...) )
+  { ; }
+
+  OutOfLine(OutOfLine&&) = default;
+
+  OutOfLine& operator=(OutOfLine&&) = default;
+
+  T& Get() { emp_assert( ptr ); return *ptr; }
+
+  const T& Get() const { emp_assert( ptr ); return *ptr; }
+
+  T& operator*() { return Get(); }
+
+  const T& operator*() const { return Get(); }
+
+  T* operator->() { return &Get(); }
+
+  const T* operator->() const { return &Get(); }
+
+};
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_DATASTRUCTS_OUTOFLINE_HPP_INCLUDE
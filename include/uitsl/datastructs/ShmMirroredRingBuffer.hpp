@@ -0,0 +1,300 @@
+#pragma once
+#ifndef UITSL_DATASTRUCTS_SHMMIRROREDRINGBUFFER_HPP_INCLUDE
+#define UITSL_DATASTRUCTS_SHMMIRROREDRINGBUFFER_HPP_INCLUDE
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <new>
+#include <stddef.h>
+#include <string>
+#include <sys/mman.h>
+#include <type_traits>
+#include <unistd.h>
+
+#include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/polyfill/span.hpp"
+
+#include "../debug/err_audit.hpp"
+#include "../debug/safe_cast.hpp"
+#include "../math/divide_utils.hpp"
+#include "../parallel/cache_line.hpp"
+
+namespace uitsl {
+
+/**
+ * Single-producer, single-consumer ring buffer held in a named POSIX shared
+ * memory segment, so that producer and consumer may live in different
+ * processes on the same node.
+ *
+ * The data region is mapped twice, back to back, like `MirroredRingBuffer`,
+ * so any run of up to `N` items is contiguous in virtual memory and can be
+ * moved with a single `memcpy`. Head and tail counters live in a separate
+ * control page at the front of the segment.
+ *
+ * One process calls `Create` and the other calls `Attach` with the same
+ * name. Once both are mapped, the creator should call `Unlink` so the
+ * segment is reclaimed when both sides unmap.
+ *
+ * @tparam T trivially-copyable item type.
+ * @tparam N capacity, in items.
+ */
+template<typename T, size_t N>
+class ShmMirroredRingBuffer {
+
+  static_assert( std::is_trivially_copyable<T>::value );
+  static_assert( std::atomic<size_t>::is_always_lock_free );
+  static_assert( N > 0 );
+
+  struct alignas(uitsl::CACHE_LINE_SIZE) counter_t {
+    std::atomic<size_t> value;
+  };
+
+  // head and tail each get their own cache line to avoid false sharing
+  // between producer and consumer
+  struct control_t {
+    counter_t head;
+    counter_t tail;
+  };
+
+  const size_t page_size{ uitsl::safe_cast<size_t>( getpagesize() ) };
+  const size_t control_size{
+    uitsl::div_ceil(sizeof(control_t), page_size) * page_size
+  };
+  const size_t byte_size{
+    uitsl::div_ceil(N * sizeof(T), page_size) * page_size
+  };
+  const size_t allocation_size{ control_size + 2 * byte_size };
+
+  std::byte *allocation{ nullptr };
+  control_t *control{ nullptr };
+  std::byte *buffer{ nullptr };
+
+  std::string name;
+  bool owns_name{ false };
+
+  std::atomic<size_t>& Head() { return control->head.value; }
+  const std::atomic<size_t>& Head() const { return control->head.value; }
+
+  std::atomic<size_t>& Tail() { return control->tail.value; }
+  const std::atomic<size_t>& Tail() const { return control->tail.value; }
+
+  std::byte* GetSlotPtr(const size_t count) {
+    return buffer + (count * sizeof(T)) % byte_size;
+  }
+
+  const std::byte* GetSlotPtr(const size_t count) const {
+    return buffer + (count * sizeof(T)) % byte_size;
+  }
+
+  void Map(const int file_descriptor) {
+
+    // get virtual address space for control page plus 2 * byte_size
+    allocation = reinterpret_cast<std::byte*>( mmap(
+      nullptr, // void *addr
+      allocation_size, // size_t length
+      PROT_NONE, // int prot
+      MAP_PRIVATE | MAP_ANONYMOUS, // int flags
+      -1, // int fd
+      0 // off_t offset
+    ) );
+    emp_always_assert( allocation != MAP_FAILED, name );
+
+    // map control page and front half of buffer to segment
+    { const auto res = mmap(
+      allocation, // void *addr
+      control_size + byte_size, // size_t length
+      PROT_READ | PROT_WRITE, // int prot
+      MAP_SHARED | MAP_FIXED, // int flags
+      file_descriptor, // int fd
+      0 // off_t offset
+    ); emp_always_assert( res != MAP_FAILED, name ); }
+
+    // map back half of buffer to data region of segment
+    { const auto res = mmap(
+      allocation + control_size + byte_size, // void *addr
+      byte_size, // size_t length
+      PROT_READ | PROT_WRITE, // int prot
+      MAP_SHARED | MAP_FIXED, // int flags
+      file_descriptor, // int fd
+      control_size // off_t offset
+    ); emp_always_assert( res != MAP_FAILED, name ); }
+
+    // mappings persist after the descriptor is closed
+    uitsl_err_audit( close(file_descriptor) );
+
+    control = reinterpret_cast<control_t*>( allocation );
+    buffer = allocation + control_size;
+
+  }
+
+public:
+
+  ShmMirroredRingBuffer() = default;
+
+  ShmMirroredRingBuffer(const ShmMirroredRingBuffer&) = delete;
+
+  ShmMirroredRingBuffer& operator=(const ShmMirroredRingBuffer&) = delete;
+
+  ~ShmMirroredRingBuffer() {
+    if ( IsInitialized() ) {
+      uitsl_err_audit(munmap(
+        allocation, // void *addr
+        allocation_size // size_t length
+      ));
+    }
+    Unlink();
+  }
+
+  bool IsInitialized() const { return allocation != nullptr; }
+
+  /**
+   * Create and map a new shared memory segment.
+   *
+   * @param name_ segment name, beginning with '/', unique on this node.
+   */
+  void Create(const std::string& name_) {
+    emp_assert( !IsInitialized() );
+    name = name_;
+
+    const int file_descriptor = shm_open(
+      name.c_str(), // const char *name
+      O_CREAT | O_EXCL | O_RDWR, // int oflag
+      0600 // mode_t mode
+    );
+    emp_always_assert( file_descriptor != -1, name, std::strerror(errno) );
+    owns_name = true;
+
+    uitsl_err_audit(ftruncate(
+      file_descriptor, // int fd
+      control_size + byte_size // off_t length
+    ));
+
+    Map( file_descriptor );
+    new (control) control_t{};
+
+  }
+
+  /**
+   * Map an existing shared memory segment made by `Create`.
+   *
+   * @param name_ segment name passed to `Create`.
+   */
+  void Attach(const std::string& name_) {
+    emp_assert( !IsInitialized() );
+    name = name_;
+
+    const int file_descriptor = shm_open(
+      name.c_str(), // const char *name
+      O_RDWR, // int oflag
+      0 // mode_t mode
+    );
+    emp_always_assert(
+      file_descriptor != -1,
+      "shared memory segment not visible, are both procs on the same node?",
+      name,
+      std::strerror(errno)
+    );
+
+    Map( file_descriptor );
+
+  }
+
+  /**
+   * Remove the segment's name, if this buffer created it.
+   *
+   * Existing mappings stay valid.
+   */
+  void Unlink() {
+    if ( owns_name ) uitsl_err_audit( shm_unlink( name.c_str() ) );
+    owns_name = false;
+  }
+
+  size_t GetSize() const {
+    emp_assert( IsInitialized() );
+    return (
+      Head().load(std::memory_order_acquire)
+      - Tail().load(std::memory_order_acquire)
+    );
+  }
+
+  static constexpr size_t GetCapacity() { return N; }
+
+  /**
+   * Producer only.
+   */
+  bool PushHead(const T& t) {
+    const size_t head = Head().load(std::memory_order_relaxed);
+    if ( head - Tail().load(std::memory_order_acquire) == N ) return false;
+
+    std::memcpy( GetSlotPtr(head), &t, sizeof(T) );
+    Head().store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * Producer only.
+   *
+   * @return number of leading items from ts that were pushed.
+   */
+  size_t PushHeadMany(const std::span<const T> ts) {
+    const size_t head = Head().load(std::memory_order_relaxed);
+    const size_t num_pushed = std::min(
+      ts.size(), N - (head - Tail().load(std::memory_order_acquire))
+    );
+
+    if ( num_pushed ) std::memcpy(
+      GetSlotPtr(head), ts.data(), num_pushed * sizeof(T)
+    );
+    Head().store(head + num_pushed, std::memory_order_release);
+    return num_pushed;
+  }
+
+  /**
+   * Consumer only.
+   */
+  size_t PopTail(const size_t n=1) {
+    const size_t tail = Tail().load(std::memory_order_relaxed);
+    const size_t num_popped = std::min(
+      n, Head().load(std::memory_order_acquire) - tail
+    );
+    Tail().store(tail + num_popped, std::memory_order_release);
+    return num_popped;
+  }
+
+  /**
+   * Consumer only.
+   */
+  T Get(const size_t i) const {
+    emp_assert( i < GetSize() );
+    T res;
+    std::memcpy(
+      &res,
+      GetSlotPtr( Tail().load(std::memory_order_relaxed) + i ),
+      sizeof(T)
+    );
+    return res;
+  }
+
+  /**
+   * Consumer only. Copy the out.size() oldest items into out.
+   */
+  void CopyTail(const std::span<T> out) const {
+    emp_assert( out.size() <= GetSize() );
+    if ( out.size() ) std::memcpy(
+      out.data(),
+      GetSlotPtr( Tail().load(std::memory_order_relaxed) ),
+      out.size() * sizeof(T)
+    );
+  }
+
+  const std::string& GetName() const { return name; }
+
+};
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_DATASTRUCTS_SHMMIRROREDRINGBUFFER_HPP_INCLUDE
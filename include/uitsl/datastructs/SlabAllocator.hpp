@@ -0,0 +1,175 @@
+#pragma once
+#ifndef UITSL_DATASTRUCTS_SLABALLOCATOR_HPP_INCLUDE
+#define UITSL_DATASTRUCTS_SLABALLOCATOR_HPP_INCLUDE
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stddef.h>
+#include <unordered_map>
+
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../parallel/cache_line.hpp"
+
+namespace uitsl {
+
+/**
+ * Hands out small blocks carved contiguously from large chunks, so that many
+ * same-sized objects allocated together sit together in memory.
+ *
+ * Blocks are aligned to and padded out to whole cache lines, so objects on
+ * different blocks never share a cache line. Freed blocks are kept on a
+ * per-size free list for reuse. Chunks are only returned to the system when
+ * the `Slab` is destroyed. Requests that are large or over-aligned bypass the
+ * slab.
+ *
+ * Thread safe.
+ */
+class Slab {
+
+  static constexpr size_t alignment = std::max(
+    alignof(std::max_align_t), uitsl::CACHE_LINE_SIZE
+  );
+
+  const size_t chunk_bytes;
+
+  std::mutex mutex;
+
+  emp::vector<std::byte*> chunks;
+  std::byte* head{};
+  size_t remaining{};
+
+  // block size -> freed blocks
+  std::unordered_map<size_t, emp::vector<void*>> free_lists;
+
+  static size_t RoundUp(const size_t bytes) {
+    const size_t lines
+      = ( std::max(bytes, size_t{1}) + alignment - 1 ) / alignment;
+    return lines * alignment;
+  }
+
+  bool Bypasses(const size_t bytes, const size_t align) const {
+    return align > alignment || bytes > chunk_bytes / 8;
+  }
+
+public:
+
+  /**
+   * @param chunk_bytes_ size of each chunk requested from the system.
+   */
+  explicit Slab(const size_t chunk_bytes_=64 * 1024)
+  : chunk_bytes( RoundUp(chunk_bytes_) )
+  { ; }
+
+  Slab(const Slab&) = delete;
+
+  Slab& operator=(const Slab&) = delete;
+
+  ~Slab() {
+    for (std::byte* chunk : chunks) {
+      ::operator delete( chunk, std::align_val_t{ alignment } );
+    }
+  }
+
+  void* Allocate(const size_t bytes, const size_t align=alignment) {
+    if ( Bypasses(bytes, align) ) return ::operator new(
+      bytes, std::align_val_t{ align }
+    );
+
+    const size_t block = RoundUp( bytes );
+    const std::lock_guard guard{ mutex };
+
+    auto& free_list = free_lists[block];
+    if ( free_list.size() ) {
+      void* res = free_list.back();
+      free_list.pop_back();
+      return res;
+    }
+
+    if ( remaining < block ) {
+      chunks.push_back( static_cast<std::byte*>(
+        ::operator new( chunk_bytes, std::align_val_t{ alignment } )
+      ) );
+      head = chunks.back();
+      remaining = chunk_bytes;
+    }
+
+    void* res = head;
+    head += block;
+    remaining -= block;
+    return res;
+  }
+
+  void Deallocate(void* ptr, const size_t bytes, const size_t align=alignment) {
+    if ( Bypasses(bytes, align) ) {
+      ::operator delete( ptr, std::align_val_t{ align } );
+      return;
+    }
+
+    const std::lock_guard guard{ mutex };
+    free_lists[ RoundUp(bytes) ].push_back( ptr );
+  }
+
+  /// @return number of chunks requested from the system so far.
+  size_t GetNumChunks() {
+    const std::lock_guard guard{ mutex };
+    return chunks.size();
+  }
+
+};
+
+/**
+ * Standard allocator drawing from a shared `Slab`.
+ *
+ * Copies, including rebound copies, draw from the same `Slab`, which lives
+ * as long as any of them. So, objects made with `std::allocate_shared` keep
+ * their slab alive on their own.
+ */
+template<typename T>
+class SlabAllocator {
+
+  template<typename U> friend class SlabAllocator;
+
+  std::shared_ptr<Slab> slab;
+
+public:
+
+  using value_type = T;
+
+  SlabAllocator() : slab( std::make_shared<Slab>() ) { ; }
+
+  explicit SlabAllocator(std::shared_ptr<Slab> slab_)
+  : slab( std::move(slab_) )
+  { ; }
+
+  template<typename U>
+  SlabAllocator(const SlabAllocator<U>& other) : slab( other.slab ) { ; }
+
+  T* allocate(const size_t n) {
+    return static_cast<T*>( slab->Allocate(n * sizeof(T), alignof(T)) );
+  }
+
+  void deallocate(T* ptr, const size_t n) {
+    slab->Deallocate( ptr, n * sizeof(T), alignof(T) );
+  }
+
+  const std::shared_ptr<Slab>& GetSlab() const { return slab; }
+
+  template<typename U>
+  bool operator==(const SlabAllocator<U>& other) const {
+    return slab == other.slab;
+  }
+
+  template<typename U>
+  bool operator!=(const SlabAllocator<U>& other) const {
+    return !operator==(other);
+  }
+
+};
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_DATASTRUCTS_SLABALLOCATOR_HPP_INCLUDE
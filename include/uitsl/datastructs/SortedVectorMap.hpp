@@ -0,0 +1,143 @@
+#pragma once
+#ifndef UITSL_DATASTRUCTS_SORTEDVECTORMAP_HPP_INCLUDE
+#define UITSL_DATASTRUCTS_SORTEDVECTORMAP_HPP_INCLUDE
+
+#include <algorithm>
+#include <stddef.h>
+#include <tuple>
+#include <utility>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+namespace uitsl {
+
+/**
+ * Associative container backed by a single vector of key-value pairs kept
+ * sorted by key.
+ *
+ * Lookup is by binary search. Unlike `std::map`, there is no per-item
+ * allocation and iteration is over contiguous memory. Items can't be
+ * inserted out of order after construction, so this suits maps that are
+ * built once then only read.
+ *
+ * @tparam Key key type, ordered by `operator<`.
+ * @tparam T mapped type.
+ */
+template<typename Key, typename T>
+class SortedVectorMap {
+
+public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<Key, T>;
+private:
+  using container_t = emp::vector<value_type>;
+public:
+  using size_type = typename container_t::size_type;
+  using iterator = typename container_t::iterator;
+  using const_iterator = typename container_t::const_iterator;
+
+private:
+
+  container_t data;
+
+  static bool CompareKey(const value_type& item, const Key& key) {
+    return item.first < key;
+  }
+
+public:
+
+  SortedVectorMap() = default;
+
+  /**
+   * Build from items in any order.
+   *
+   * @param items key-value pairs, with unique keys.
+   */
+  explicit SortedVectorMap(container_t items) : data( std::move(items) ) {
+    std::sort(
+      std::begin( data ),
+      std::end( data ),
+      [](const auto& a, const auto& b){ return a.first < b.first; }
+    );
+    emp_assert( std::adjacent_find(
+      std::begin( data ),
+      std::end( data ),
+      [](const auto& a, const auto& b){ return a.first == b.first; }
+    ) == std::end( data ) );
+  }
+
+  void reserve(const size_t n) { data.reserve(n); }
+
+  /**
+   * Append an item with key greater than every key already present.
+   *
+   * @param key TODO.
+   * @param args arguments forwarded to mapped type's constructor.
+   * @return reference to new mapped value.
+   */
+  template<typename... Args>
+  T& emplace_back(const Key& key, Args&&... args) {
+    emp_assert( data.empty() || data.back().first < key );
+    data.emplace_back(
+      std::piecewise_construct,
+      std::forward_as_tuple(key),
+      std::forward_as_tuple(std::forward<Args>(args)...)
+    );
+    return data.back().second;
+  }
+
+  iterator find(const Key& key) {
+    const auto it = std::lower_bound(
+      std::begin( data ), std::end( data ), key, CompareKey
+    );
+    return (it != std::end( data ) && it->first == key) ? it : std::end(data);
+  }
+
+  const_iterator find(const Key& key) const {
+    const auto it = std::lower_bound(
+      std::begin( data ), std::end( data ), key, CompareKey
+    );
+    return (it != std::end( data ) && it->first == key) ? it : std::end(data);
+  }
+
+  size_t count(const Key& key) const { return find(key) != std::end(data); }
+
+  bool contains(const Key& key) const { return count(key); }
+
+  T& at(const Key& key) {
+    const auto it = find(key);
+    emp_assert( it != std::end(data), key );
+    return it->second;
+  }
+
+  const T& at(const Key& key) const {
+    const auto it = find(key);
+    emp_assert( it != std::end(data), key );
+    return it->second;
+  }
+
+  iterator begin() { return std::begin( data ); }
+
+  iterator end() { return std::end( data ); }
+
+  const_iterator begin() const { return std::cbegin( data ); }
+
+  const_iterator end() const { return std::cend( data ); }
+
+  const_iterator cbegin() const { return std::cbegin( data ); }
+
+  const_iterator cend() const { return std::cend( data ); }
+
+  size_t size() const { return data.size(); }
+
+  bool empty() const { return data.empty(); }
+
+  void clear() { data.clear(); }
+
+};
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_DATASTRUCTS_SORTEDVECTORMAP_HPP_INCLUDE
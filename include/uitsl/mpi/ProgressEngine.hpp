@@ -0,0 +1,212 @@
+#pragma once
+#ifndef UITSL_MPI_PROGRESSENGINE_HPP_INCLUDE
+#define UITSL_MPI_PROGRESSENGINE_HPP_INCLUDE
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <stddef.h>
+#include <thread>
+
+#include <mpi.h>
+
+#include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+
+#include "../parallel/ShardedRegistry.hpp"
+
+#include "audited_routines.hpp"
+
+namespace uitsl {
+
+/**
+ * Per-process thread that repeatedly sweeps over registered progress tasks,
+ * e.g., testing and reposting MPI requests, so that communication advances
+ * while simulation threads are busy computing.
+ *
+ * Requires MPI to have been initialized with `MPI_THREAD_MULTIPLE`, e.g.,
+ * through `uitsl::MpiMultithreadGuard`. The thread is started when the first
+ * task registers and is joined at static destruction.
+ *
+ * The thread parks while no tasks are registered. Once sweeps stop making
+ * progress, it yields for a while and then sleeps for exponentially longer
+ * stretches, capped at `max_backoff`. `Wake` cuts a sleep short.
+ */
+class ProgressEngine {
+
+public:
+
+  /// Progress task, returns whether it did any work.
+  using task_t = std::function<bool()>;
+
+  /// Number of consecutive idle sweeps to yield between before sleeping.
+  constexpr inline static size_t num_spin_sweeps{ 64 };
+
+  /// Longest the thread sleeps between idle sweeps.
+  constexpr inline static std::chrono::microseconds max_backoff{ 1024 };
+
+private:
+
+  using registry_t = uitsl::ShardedRegistry<const task_t*>;
+  registry_t registry;
+
+  std::atomic<bool> stop_flag{ false };
+  std::atomic<size_t> num_sweeps{};
+
+  // registered task count, to park while there is nothing to sweep
+  std::atomic<size_t> num_tasks{};
+
+  std::mutex park_mutex;
+  std::condition_variable park_cv;
+  std::atomic<bool> parked{ false };
+
+  std::thread worker;
+
+  // clear parked and notify if the worker is parked or about to park
+  void Unpark() {
+    if ( parked.exchange( false ) ) {
+      const std::lock_guard guard{ park_mutex };
+      park_cv.notify_one();
+    }
+  }
+
+  // sleep until timeout, unpark, stop, or a task registers
+  // a duration of zero sleeps until there are tasks to run
+  void Park(const std::chrono::microseconds duration) {
+    std::unique_lock lock{ park_mutex };
+    parked.store( true );
+    const auto should_wake = [this, duration](){
+      return !parked.load()
+        || stop_flag.load()
+        || ( duration.count() == 0 && num_tasks.load() );
+    };
+    if ( duration.count() ) park_cv.wait_for( lock, duration, should_wake );
+    else park_cv.wait( lock, should_wake );
+    parked.store( false );
+  }
+
+  void Backoff(const size_t num_idle_sweeps) {
+    if ( num_idle_sweeps < num_spin_sweeps ) std::this_thread::yield();
+    else Park( std::min(
+      std::chrono::microseconds{
+        1ull << std::min( num_idle_sweeps - num_spin_sweeps, size_t{ 10 } )
+      },
+      max_backoff
+    ) );
+  }
+
+  void Run() {
+    size_t num_idle_sweeps{};
+    while ( !stop_flag.load( std::memory_order_relaxed ) ) {
+      if ( num_tasks.load() == 0 ) {
+        Park( std::chrono::microseconds{} );
+        num_idle_sweeps = 0;
+        continue;
+      }
+
+      bool progressed{ false };
+      registry.Visit(
+        [&progressed](const task_t* task){ progressed |= (*task)(); }
+      );
+      num_sweeps.fetch_add( 1, std::memory_order_release );
+
+      if ( progressed ) num_idle_sweeps = 0;
+      else Backoff( num_idle_sweeps++ );
+    }
+  }
+
+  ProgressEngine() {
+    int provided{};
+    UITSL_Query_thread( &provided );
+    emp_always_assert(
+      provided == MPI_THREAD_MULTIPLE,
+      "ProgressEngine requires MPI_THREAD_MULTIPLE", provided
+    );
+    worker = std::thread( [this](){ Run(); } );
+  }
+
+public:
+
+  ~ProgressEngine() {
+    stop_flag.store( true );
+    {
+      const std::lock_guard guard{ park_mutex };
+      park_cv.notify_one();
+    }
+    worker.join();
+  }
+
+  ProgressEngine(const ProgressEngine&) = delete;
+
+  static ProgressEngine& Get() {
+    static ProgressEngine instance;
+    return instance;
+  }
+
+  /**
+   * RAII registration of a progress task.
+   *
+   * Deregistration blocks while the task is being run, so a task may safely
+   * touch its owner's members until the owner destroys its registration.
+   */
+  class Registration {
+
+    registry_t::Registration registration;
+
+  public:
+
+    /**
+     * @param task called from the progress thread, must outlive
+     * registration.
+     */
+    explicit Registration(const task_t& task)
+    : registration( ProgressEngine::Get().registry, &task ) {
+      auto& engine = ProgressEngine::Get();
+      engine.num_tasks.fetch_add( 1 );
+      engine.Unpark();
+    }
+
+    Registration(const Registration&) = delete;
+
+    ~Registration() { ProgressEngine::Get().num_tasks.fetch_sub( 1 ); }
+
+  };
+
+  /**
+   * Cut short the progress thread's backoff, e.g., after handing it new
+   * work. Cheap when the thread isn't sleeping. A wake that races the
+   * thread falling asleep may be missed, delaying it by at most
+   * `max_backoff`.
+   */
+  void Wake() {
+    if ( parked.load( std::memory_order_relaxed ) ) Unpark();
+  }
+
+  /**
+   * Count completed sweeps over registered tasks.
+   *
+   * @return number of sweeps since the engine started.
+   */
+  size_t GetNumSweeps() const {
+    return num_sweeps.load( std::memory_order_acquire );
+  }
+
+  /**
+   * Block until at least one full sweep has begun and ended after the call,
+   * or until no tasks are registered, in which case none can be running.
+   */
+  void WaitForSweep() {
+    const size_t target = GetNumSweeps() + 2;
+    while ( GetNumSweeps() < target && num_tasks.load() ) {
+      Wake();
+      std::this_thread::yield();
+    }
+  }
+
+};
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_MPI_PROGRESSENGINE_HPP_INCLUDE
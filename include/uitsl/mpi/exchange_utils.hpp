@@ -0,0 +1,167 @@
+#pragma once
+#ifndef UITSL_MPI_EXCHANGE_UTILS_HPP_INCLUDE
+#define UITSL_MPI_EXCHANGE_UTILS_HPP_INCLUDE
+
+#include <cstring>
+#include <numeric>
+#include <stddef.h>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <mpi.h>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../debug/safe_cast.hpp"
+
+#include "audited_routines.hpp"
+#include "comm_utils.hpp"
+
+namespace uitsl {
+
+/// Append the bytes of val to buffer.
+template<typename T>
+void pack_bytes(std::string& buffer, const T& val) {
+  static_assert( std::is_trivially_copyable<T>::value );
+  buffer.append( reinterpret_cast<const char*>(&val), sizeof(T) );
+}
+
+/// Read a T from the front of buffer, advancing buffer past it.
+template<typename T>
+T unpack_bytes(std::string_view& buffer) {
+  static_assert( std::is_trivially_copyable<T>::value );
+  emp_assert( buffer.size() >= sizeof(T) );
+  T res;
+  std::memcpy( &res, buffer.data(), sizeof(T) );
+  buffer.remove_prefix( sizeof(T) );
+  return res;
+}
+
+namespace internal {
+
+inline emp::vector<int> calc_displacements(const emp::vector<int>& counts) {
+  emp::vector<int> res( counts.size() );
+  std::exclusive_scan(
+    std::begin(counts), std::end(counts), std::begin(res), 0
+  );
+  return res;
+}
+
+inline emp::vector<std::string> split_bytes(
+  const std::string& buffer,
+  const emp::vector<int>& counts,
+  const emp::vector<int>& displacements
+) {
+  emp::vector<std::string> res;
+  res.reserve( counts.size() );
+  for (size_t i{}; i < counts.size(); ++i) {
+    res.emplace_back( buffer, displacements[i], counts[i] );
+  }
+  return res;
+}
+
+} // namespace internal
+
+/// Collectively send outgoing[p] to every proc p in comm.
+/// @param[in] outgoing one buffer per proc in comm, possibly empty.
+/// @param[in] comm communicator to exchange over.
+/// @return one buffer from every proc in comm, indexed by sender.
+inline emp::vector<std::string> exchange_bytes(
+  const emp::vector<std::string>& outgoing,
+  const MPI_Comm& comm=MPI_COMM_WORLD
+) {
+  const size_t num_procs = uitsl::comm_size( comm );
+  emp_assert( outgoing.size() == num_procs );
+
+  emp::vector<int> send_counts;
+  send_counts.reserve( num_procs );
+  std::string send_buffer;
+  for (const auto& buffer : outgoing) {
+    send_counts.push_back( uitsl::safe_cast<int>( buffer.size() ) );
+    send_buffer += buffer;
+  }
+
+  emp::vector<int> recv_counts( num_procs );
+  UITSL_Alltoall(
+    send_counts.data(), // const void *sendbuf
+    1, // int sendcount
+    MPI_INT, // MPI_Datatype sendtype
+    recv_counts.data(), // void *recvbuf
+    1, // int recvcount
+    MPI_INT, // MPI_Datatype recvtype
+    comm // MPI_Comm comm
+  );
+
+  const auto send_displacements = internal::calc_displacements( send_counts );
+  const auto recv_displacements = internal::calc_displacements( recv_counts );
+  std::string recv_buffer(
+    std::accumulate( std::begin(recv_counts), std::end(recv_counts), 0 ),
+    '\0'
+  );
+
+  UITSL_Alltoallv(
+    send_buffer.data(), // const void *sendbuf
+    send_counts.data(), // const int sendcounts[]
+    send_displacements.data(), // const int sdispls[]
+    MPI_BYTE, // MPI_Datatype sendtype
+    recv_buffer.data(), // void *recvbuf
+    recv_counts.data(), // const int recvcounts[]
+    recv_displacements.data(), // const int rdispls[]
+    MPI_BYTE, // MPI_Datatype recvtype
+    comm // MPI_Comm comm
+  );
+
+  return internal::split_bytes(
+    recv_buffer, recv_counts, recv_displacements
+  );
+}
+
+/// Collectively share contribution with every proc in comm.
+/// @param[in] contribution this proc's buffer.
+/// @param[in] comm communicator to gather over.
+/// @return every proc's contribution, indexed by proc.
+inline emp::vector<std::string> allgather_bytes(
+  const std::string& contribution,
+  const MPI_Comm& comm=MPI_COMM_WORLD
+) {
+  const size_t num_procs = uitsl::comm_size( comm );
+
+  const int send_count = uitsl::safe_cast<int>( contribution.size() );
+  emp::vector<int> recv_counts( num_procs );
+  UITSL_Allgather(
+    &send_count, // const void *sendbuf
+    1, // int sendcount
+    MPI_INT, // MPI_Datatype sendtype
+    recv_counts.data(), // void *recvbuf
+    1, // int recvcount
+    MPI_INT, // MPI_Datatype recvtype
+    comm // MPI_Comm comm
+  );
+
+  const auto recv_displacements = internal::calc_displacements( recv_counts );
+  std::string recv_buffer(
+    std::accumulate( std::begin(recv_counts), std::end(recv_counts), 0 ),
+    '\0'
+  );
+
+  UITSL_Allgatherv(
+    contribution.data(), // const void *sendbuf
+    send_count, // int sendcount
+    MPI_BYTE, // MPI_Datatype sendtype
+    recv_buffer.data(), // void *recvbuf
+    recv_counts.data(), // const int recvcounts[]
+    recv_displacements.data(), // const int displs[]
+    MPI_BYTE, // MPI_Datatype recvtype
+    comm // MPI_Comm comm
+  );
+
+  return internal::split_bytes(
+    recv_buffer, recv_counts, recv_displacements
+  );
+}
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_MPI_EXCHANGE_UTILS_HPP_INCLUDE
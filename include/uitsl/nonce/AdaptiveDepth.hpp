@@ -0,0 +1,84 @@
+#pragma once
+#ifndef UITSL_NONCE_ADAPTIVEDEPTH_HPP_INCLUDE
+#define UITSL_NONCE_ADAPTIVEDEPTH_HPP_INCLUDE
+
+#include <algorithm>
+#include <stddef.h>
+
+namespace uitsl {
+
+/**
+ * Runtime buffer depth, bounded by a compile-time cap, that grows when
+ * demand saturates it and shrinks when it sits mostly unused.
+ *
+ * Depth doubles on each reported saturation. Occupancy reports are grouped
+ * into windows; depth halves at the end of any window whose peak occupancy
+ * never exceeded a quarter of depth. The gap between the grow and shrink
+ * thresholds keeps depth from oscillating under steady load.
+ *
+ * @tparam MaxDepth largest depth ever granted.
+ * @tparam WindowSize number of occupancy reports per shrink decision.
+ */
+template<size_t MaxDepth, size_t WindowSize=MaxDepth>
+class AdaptiveDepth {
+
+  static_assert( MaxDepth > 0 );
+  static_assert( WindowSize > 0 );
+
+  size_t depth;
+
+  size_t window_countdown{ WindowSize };
+  size_t window_peak_occupancy{};
+
+  void ResetWindow() {
+    window_countdown = WindowSize;
+    window_peak_occupancy = 0;
+  }
+
+public:
+
+  /**
+   * @param initial_depth starting depth, clamped to [1, MaxDepth].
+   */
+  explicit AdaptiveDepth(const size_t initial_depth=1)
+  : depth( std::clamp<size_t>( initial_depth, 1, MaxDepth ) )
+  { }
+
+  size_t GetDepth() const { return depth; }
+
+  static constexpr size_t GetMaxDepth() { return MaxDepth; }
+
+  /**
+   * Report that demand exceeded current depth, e.g., a put would have been
+   * dropped or every buffered slot was found laden.
+   *
+   * @return whether depth grew.
+   */
+  bool ReportSaturation() {
+    if ( depth == MaxDepth ) return false;
+    depth = std::min( depth * 2, MaxDepth );
+    ResetWindow();
+    return true;
+  }
+
+  /**
+   * Report number of slots currently in use.
+   *
+   * @param occupancy slots in use, which may briefly exceed current depth
+   * while slots in use from before a shrink drain.
+   */
+  void ReportOccupancy(const size_t occupancy) {
+    window_peak_occupancy = std::max( window_peak_occupancy, occupancy );
+    if ( --window_countdown ) return;
+
+    if ( window_peak_occupancy * 4 <= depth ) {
+      depth = std::max<size_t>( depth / 2, 1 );
+    }
+    ResetWindow();
+  }
+
+};
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_NONCE_ADAPTIVEDEPTH_HPP_INCLUDE
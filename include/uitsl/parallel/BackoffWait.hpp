@@ -0,0 +1,62 @@
+#pragma once
+#ifndef UITSL_PARALLEL_BACKOFFWAIT_HPP_INCLUDE
+#define UITSL_PARALLEL_BACKOFFWAIT_HPP_INCLUDE
+
+#include <algorithm>
+#include <chrono>
+#include <stddef.h>
+#include <thread>
+
+namespace uitsl {
+
+/**
+ * Wait strategy that spins briefly then sleeps between retries, doubling
+ * the sleep after each failed retry up to a cap.
+ *
+ * Frees the core entirely during long waits, at the cost of up to
+ * `MaxSleepNs` of added latency once a wait ends.
+ *
+ * @tparam SpinCount number of attempts to retry immediately before sleeping.
+ * @tparam MinSleepNs first sleep duration, in nanoseconds.
+ * @tparam MaxSleepNs longest sleep duration, in nanoseconds.
+ */
+template<
+  size_t SpinCount=64,
+  size_t MinSleepNs=1000,
+  size_t MaxSleepNs=1000000
+>
+struct BackoffWait {
+
+  static_assert( MinSleepNs > 0 );
+  static_assert( MinSleepNs <= MaxSleepNs );
+
+  /**
+   * Call attempt until it returns true.
+   *
+   * @param attempt callable returning whether waiting is over.
+   * @param key ignored.
+   */
+  template<typename Attempt>
+  static void Until(
+    Attempt&& attempt, [[maybe_unused]] const void* key=nullptr
+  ) {
+    for (size_t i{}; i < SpinCount; ++i) if ( attempt() ) return;
+
+    size_t sleep_ns{ MinSleepNs };
+    while ( !attempt() ) {
+      std::this_thread::sleep_for( std::chrono::nanoseconds{ sleep_ns } );
+      sleep_ns = std::min( sleep_ns * 2, MaxSleepNs );
+    }
+  }
+
+  /**
+   * Wake threads waiting under this strategy. No-op, sleepers wake on their
+   * own.
+   */
+  static void Notify([[maybe_unused]] const void* key=nullptr) { }
+
+};
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_PARALLEL_BACKOFFWAIT_HPP_INCLUDE
@@ -0,0 +1,186 @@
+#pragma once
+#ifndef UITSL_PARALLEL_CPUTOPOLOGY_HPP_INCLUDE
+#define UITSL_PARALLEL_CPUTOPOLOGY_HPP_INCLUDE
+
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+#include <stddef.h>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/optional.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../polyfill/filesystem.hpp"
+
+#include "affinity_utils.hpp"
+
+namespace uitsl {
+
+/// Where one logical CPU sits in the machine's hardware hierarchy.
+struct CpuInfo {
+
+  cpu_id_t cpu_id;
+  size_t package_id{};
+  size_t numa_node_id{};
+  /// Unique within a package.
+  size_t core_id{};
+
+  auto AsTuple() const {
+    return std::tuple{ package_id, numa_node_id, core_id, cpu_id };
+  }
+
+  bool operator==(const CpuInfo& other) const {
+    return AsTuple() == other.AsTuple();
+  }
+
+  bool operator<(const CpuInfo& other) const {
+    return AsTuple() < other.AsTuple();
+  }
+
+};
+
+/// Parse a Linux CPU list, like "0-3,8,10-11".
+/// @return listed CPUs, in the order listed.
+inline emp::vector<cpu_id_t> parse_cpu_list(const std::string& list) {
+  emp::vector<cpu_id_t> res;
+
+  std::istringstream stream( list );
+  std::string range;
+  while ( std::getline(stream, range, ',') ) {
+    if ( range.find_first_not_of(" \n") == std::string::npos ) continue;
+    const size_t dash = range.find( '-' );
+    const cpu_id_t first = std::stoul( range.substr(0, dash) );
+    const cpu_id_t last = dash == std::string::npos
+      ? first
+      : std::stoul( range.substr(dash + 1) );
+    for (cpu_id_t cpu = first; cpu <= last; ++cpu) res.push_back( cpu );
+  }
+
+  return res;
+}
+
+/**
+ * The CPUs available to this process, ordered so that CPUs sharing a
+ * package, then a NUMA node, then a core, are contiguous.
+ *
+ * Levels of the hierarchy are numbered from the outside in: package, NUMA
+ * node, core, then CPU.
+ */
+class CpuTopology {
+
+  emp::vector<CpuInfo> cpus;
+
+  static emp::optional<size_t> ReadID(const std::filesystem::path& path) {
+    std::ifstream file( path );
+    size_t res;
+    if ( file >> res ) return res;
+    else return std::nullopt;
+  }
+
+public:
+
+  static constexpr size_t package_level = 0;
+  static constexpr size_t numa_node_level = 1;
+  static constexpr size_t core_level = 2;
+  static constexpr size_t cpu_level = 3;
+  static constexpr size_t num_levels = 4;
+
+  explicit CpuTopology(emp::vector<CpuInfo> cpus_) : cpus( std::move(cpus_) ) {
+    std::sort( std::begin(cpus), std::end(cpus) );
+  }
+
+  /**
+   * Read the CPU hierarchy from Linux sysfs.
+   *
+   * CPUs without readable topology are treated as their own core on package
+   * zero. If allowed CPUs are unknown, assumes the first
+   * std::thread::hardware_concurrency CPUs.
+   *
+   * @param allowed CPUs to include, defaulting to those this thread may run
+   * on.
+   * @param sysfs_root path to sysfs's system devices directory.
+   */
+  static CpuTopology FromSysfs(
+    emp::vector<cpu_id_t> allowed=uitsl::get_allowed_cpus(),
+    const std::filesystem::path& sysfs_root="/sys/devices/system"
+  ) {
+    if ( allowed.empty() ) {
+      allowed.resize( std::max( std::thread::hardware_concurrency(), 1u ) );
+      std::iota( std::begin(allowed), std::end(allowed), cpu_id_t{} );
+    }
+
+    std::unordered_map<cpu_id_t, size_t> numa_nodes;
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator(
+      sysfs_root / "node", error
+    )) {
+      const std::string name = entry.path().filename().string();
+      if ( name.rfind("node", 0) != 0 || name.size() == 4 ) continue;
+      if ( name.find_first_not_of("0123456789", 4) != std::string::npos ) {
+        continue;
+      }
+      std::ifstream file( entry.path() / "cpulist" );
+      std::string list;
+      std::getline( file, list );
+      for (const cpu_id_t cpu : uitsl::parse_cpu_list(list)) {
+        numa_nodes[cpu] = std::stoul( name.substr(4) );
+      }
+    }
+
+    emp::vector<CpuInfo> res;
+    for (const cpu_id_t cpu : allowed) {
+      const auto topology_path = sysfs_root / "cpu"
+        / ( "cpu" + std::to_string(cpu) ) / "topology";
+      const auto package_id = ReadID( topology_path / "physical_package_id" );
+      const auto core_id = ReadID( topology_path / "core_id" );
+      res.push_back( {
+        cpu,
+        package_id.value_or( 0 ),
+        numa_nodes.count(cpu) ? numa_nodes.at(cpu) : 0,
+        core_id.value_or( cpu )
+      } );
+    }
+
+    return CpuTopology{ res };
+  }
+
+  size_t GetSize() const { return cpus.size(); }
+
+  const CpuInfo& GetCpu(const size_t idx) const { return cpus[idx]; }
+
+  /// @return OS numbers of CPUs, in hierarchical order.
+  emp::vector<cpu_id_t> GetCpuIDs() const {
+    emp::vector<cpu_id_t> res;
+    for (const auto& cpu : cpus) res.push_back( cpu.cpu_id );
+    return res;
+  }
+
+  /// Do CPUs at positions a and b share a package, NUMA node, core, or CPU?
+  /// @param level how far into the hierarchy they must match.
+  bool SharesLevel(const size_t a, const size_t b, const size_t level) const {
+    emp_assert( level < num_levels );
+    const auto& x = cpus[a];
+    const auto& y = cpus[b];
+    switch ( level ) {
+      case package_level: return x.package_id == y.package_id;
+      case numa_node_level: return SharesLevel(a, b, package_level)
+        && x.numa_node_id == y.numa_node_id;
+      case core_level: return SharesLevel(a, b, numa_node_level)
+        && x.core_id == y.core_id;
+      default: return x == y;
+    }
+  }
+
+};
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_PARALLEL_CPUTOPOLOGY_HPP_INCLUDE
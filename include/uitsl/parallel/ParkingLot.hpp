@@ -0,0 +1,97 @@
+#pragma once
+#ifndef UITSL_PARALLEL_PARKINGLOT_HPP_INCLUDE
+#define UITSL_PARALLEL_PARKINGLOT_HPP_INCLUDE
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <stddef.h>
+
+namespace uitsl {
+
+/**
+ * Event count that threads park on until notified or timed out.
+ *
+ * Waiters take a ticket with `PrepareWait`, recheck whatever they are
+ * waiting on, then either `CancelWait` or `Wait` on the ticket. A
+ * notification between taking the ticket and waiting on it is not lost.
+ * `NotifyAll` skips the mutex entirely while nobody is parked, so notifying
+ * from a hot path is cheap. Callers notifying several lots can issue one
+ * seq_cst fence themselves, then check each lot's `MayHaveWaiters` before
+ * calling `NotifyAll`.
+ */
+class ParkingLot {
+
+  std::mutex mutex;
+  std::condition_variable cv;
+
+  std::atomic<size_t> epoch{};
+  std::atomic<size_t> num_waiting{};
+
+public:
+
+  /**
+   * Register as a waiter.
+   *
+   * @return ticket to pass to `Wait`.
+   */
+  size_t PrepareWait() {
+    num_waiting.fetch_add( 1, std::memory_order_seq_cst );
+    // order registration before caller rechecks its wait condition
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+    return epoch.load( std::memory_order_seq_cst );
+  }
+
+  /**
+   * Deregister as a waiter without parking.
+   */
+  void CancelWait() { num_waiting.fetch_sub( 1, std::memory_order_relaxed ); }
+
+  /**
+   * Park until a notification after ticket was taken or until timeout,
+   * then deregister as a waiter.
+   *
+   * @param ticket from `PrepareWait`.
+   * @param timeout longest time to park.
+   */
+  template<typename Duration>
+  void Wait(const size_t ticket, const Duration& timeout) {
+    {
+      std::unique_lock lock{ mutex };
+      cv.wait_for( lock, timeout, [this, ticket](){
+        return epoch.load( std::memory_order_relaxed ) != ticket;
+      } );
+    }
+    CancelWait();
+  }
+
+  /**
+   * Wake all parked threads.
+   */
+  void NotifyAll() {
+    // order caller's preceding writes before checking for waiters
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+    if ( num_waiting.load( std::memory_order_relaxed ) == 0 ) return;
+    {
+      const std::lock_guard lock{ mutex };
+      epoch.fetch_add( 1, std::memory_order_relaxed );
+    }
+    cv.notify_all();
+  }
+
+  size_t GetNumWaiting() const { return num_waiting; }
+
+  /**
+   * Cheaply check for waiters, without ordering against the caller's
+   * preceding writes. Only misses no waiter if the caller issued a seq_cst
+   * fence after those writes.
+   */
+  bool MayHaveWaiters() const {
+    return num_waiting.load( std::memory_order_relaxed );
+  }
+
+};
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_PARALLEL_PARKINGLOT_HPP_INCLUDE
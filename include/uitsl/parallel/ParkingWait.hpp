@@ -0,0 +1,109 @@
+#pragma once
+#ifndef UITSL_PARALLEL_PARKINGWAIT_HPP_INCLUDE
+#define UITSL_PARALLEL_PARKINGWAIT_HPP_INCLUDE
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <stddef.h>
+
+#include "../../../third-party/Empirical/include/emp/base/array.hpp"
+
+#include "cache_line.hpp"
+#include "ParkingLot.hpp"
+
+namespace uitsl {
+
+/**
+ * Wait strategy that spins briefly then parks until notified.
+ *
+ * Waiters park on a lot chosen by hashing the key they wait on, e.g., the
+ * duct they wait for, and `Notify` only wakes the lot its key hashes to, so
+ * a publish on one duct doesn't wake threads waiting on unrelated ducts.
+ * Unkeyed waits park on a separate lot that every `Notify` wakes.
+ *
+ * Only ducts that call `Notify` on publish wake parked waiters early. Every
+ * park also times out after `TimeoutUs`, so waits on ducts that never
+ * notify, e.g., inter-process ducts, still make progress. `Notify` issues a
+ * single fence, then only takes a lot's mutex if someone is parked on it.
+ *
+ * @tparam SpinCount number of attempts to retry immediately before parking.
+ * @tparam TimeoutUs longest time to park between attempts, in microseconds.
+ * @tparam NumLots number of lots keys are hashed into.
+ */
+template<size_t SpinCount=64, size_t TimeoutUs=1000, size_t NumLots=64>
+struct ParkingWait {
+
+  static_assert( NumLots > 0 );
+
+private:
+
+  // keep lots from sharing cache lines, waiter counts are hot
+  struct alignas(uitsl::CACHE_LINE_SIZE) PaddedLot {
+    uitsl::ParkingLot lot;
+  };
+
+  static uitsl::ParkingLot& GetUnkeyedLot() {
+    static uitsl::ParkingLot lot;
+    return lot;
+  }
+
+  // caller must fence first, pairing with the fence in PrepareWait
+  static void TryNotify(uitsl::ParkingLot& lot) {
+    if ( lot.MayHaveWaiters() ) lot.NotifyAll();
+  }
+
+public:
+
+  /**
+   * @param key address waited on, or nullptr for an unkeyed wait.
+   * @return lot that waiters on key park on.
+   */
+  static uitsl::ParkingLot& GetLot(const void* key) {
+    if ( key == nullptr ) return GetUnkeyedLot();
+
+    static emp::array<PaddedLot, NumLots> lots;
+    // mix high bits down, addresses' low bits are mostly alignment
+    const size_t hash = std::hash<const void*>{}( key );
+    return lots[
+      ( hash ^ (hash >> 7) ^ (hash >> 17) ) % NumLots
+    ].lot;
+  }
+
+  /**
+   * Call attempt until it returns true.
+   *
+   * @param attempt callable returning whether waiting is over.
+   * @param key address waited on, which notifiers pass to `Notify`.
+   */
+  template<typename Attempt>
+  static void Until(Attempt&& attempt, const void* key=nullptr) {
+    for (size_t i{}; i < SpinCount; ++i) if ( attempt() ) return;
+
+    auto& lot = GetLot( key );
+    while (true) {
+      const size_t ticket = lot.PrepareWait();
+      if ( attempt() ) { lot.CancelWait(); return; }
+      lot.Wait( ticket, std::chrono::microseconds{ TimeoutUs } );
+    }
+  }
+
+  /**
+   * Wake threads parked on key, along with any unkeyed waiters.
+   *
+   * @param key address published to, or nullptr to wake only unkeyed
+   * waiters.
+   */
+  static void Notify(const void* key=nullptr) {
+    // order caller's preceding writes before checking for waiters,
+    // so a waiter that registered before they landed is seen
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+    if ( key != nullptr ) TryNotify( GetLot( key ) );
+    TryNotify( GetUnkeyedLot() );
+  }
+
+};
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_PARALLEL_PARKINGWAIT_HPP_INCLUDE
@@ -0,0 +1,167 @@
+#pragma once
+#ifndef UITSL_PARALLEL_READINESSHUB_HPP_INCLUDE
+#define UITSL_PARALLEL_READINESSHUB_HPP_INCLUDE
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <stddef.h>
+
+#include "../../../third-party/Empirical/include/emp/base/array.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "cache_line.hpp"
+
+namespace uitsl {
+
+/**
+ * Process-wide board of one-shot readiness subscriptions, keyed by address.
+ *
+ * A subscriber registers interest in a key with its `Inbox`, then rechecks
+ * whatever it is waiting on. The next `Publish` on that key, from any
+ * thread, posts the key to the inbox and drops the subscription. A publish
+ * between subscribing and rechecking is not lost.
+ *
+ * `Publish` costs a fence and a load while nobody has subscribed to any key
+ * hashing alongside its own.
+ */
+class ReadinessHub {
+
+public:
+
+  /// Collects keys published to since they were subscribed to.
+  class Inbox {
+
+    friend class ReadinessHub;
+
+    std::mutex mutex;
+    emp::vector<const void*> keys;
+
+  public:
+
+    Inbox() = default;
+
+    Inbox(const Inbox&) = delete;
+
+    /// Drop any outstanding subscriptions.
+    ~Inbox() { ReadinessHub::Unsubscribe( *this ); }
+
+    /**
+     * Move keys posted since the last drain into out.
+     *
+     * @param out appended to.
+     */
+    void Drain(emp::vector<const void*>& out) {
+      const std::lock_guard guard{ mutex };
+      out.insert( std::end( out ), std::begin( keys ), std::end( keys ) );
+      keys.clear();
+    }
+
+  };
+
+private:
+
+  struct Subscription {
+    const void* key;
+    Inbox* inbox;
+  };
+
+  // keep buckets from sharing cache lines, subscription counts are hot
+  struct alignas(uitsl::CACHE_LINE_SIZE) Bucket {
+    std::mutex mutex;
+    std::atomic<size_t> num_subscriptions{};
+    emp::vector<Subscription> subscriptions;
+  };
+
+  constexpr inline static size_t num_buckets{ 64 };
+
+  static emp::array<Bucket, num_buckets>& GetBuckets() {
+    static emp::array<Bucket, num_buckets> buckets;
+    return buckets;
+  }
+
+  static Bucket& GetBucket(const void* key) {
+    // mix high bits down, addresses' low bits are mostly alignment
+    const size_t hash = std::hash<const void*>{}( key );
+    return GetBuckets()[ ( hash ^ (hash >> 7) ^ (hash >> 17) ) % num_buckets ];
+  }
+
+  template<typename Pred>
+  static void EraseIf(Bucket& bucket, Pred&& pred) {
+    auto& subscriptions = bucket.subscriptions;
+    subscriptions.erase(
+      std::remove_if(
+        std::begin( subscriptions ), std::end( subscriptions ),
+        std::forward<Pred>( pred )
+      ),
+      std::end( subscriptions )
+    );
+    bucket.num_subscriptions.store( subscriptions.size() );
+  }
+
+public:
+
+  /**
+   * Post key to inbox on the next publish to key.
+   *
+   * Callers should recheck whatever they wait on after subscribing.
+   *
+   * @param key address to watch.
+   * @param inbox to post to, must not already be subscribed to key.
+   */
+  static void Subscribe(const void* key, Inbox& inbox) {
+    auto& bucket = GetBucket( key );
+    {
+      const std::lock_guard guard{ bucket.mutex };
+      bucket.subscriptions.push_back( { key, &inbox } );
+      bucket.num_subscriptions.store( bucket.subscriptions.size() );
+    }
+    // order subscription before caller rechecks its wait condition
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+  }
+
+  /**
+   * Post key to every inbox subscribed to it, dropping their subscriptions.
+   *
+   * @param key address published to.
+   */
+  static void Publish(const void* key) {
+    // order caller's preceding writes before checking for subscribers
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+    auto& bucket = GetBucket( key );
+    if ( bucket.num_subscriptions.load( std::memory_order_relaxed ) == 0 ) {
+      return;
+    }
+
+    const std::lock_guard guard{ bucket.mutex };
+    EraseIf( bucket, [key](const Subscription& subscription){
+      if ( subscription.key != key ) return false;
+      const std::lock_guard inbox_guard{ subscription.inbox->mutex };
+      subscription.inbox->keys.push_back( key );
+      return true;
+    } );
+  }
+
+  /**
+   * Drop all of inbox's subscriptions. Once this returns, no publish will
+   * post to inbox.
+   *
+   * @param inbox to unsubscribe.
+   */
+  static void Unsubscribe(Inbox& inbox) {
+    for (auto& bucket : GetBuckets()) {
+      if ( bucket.num_subscriptions.load() == 0 ) continue;
+      const std::lock_guard guard{ bucket.mutex };
+      EraseIf( bucket, [&inbox](const Subscription& subscription){
+        return subscription.inbox == &inbox;
+      } );
+    }
+  }
+
+};
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_PARALLEL_READINESSHUB_HPP_INCLUDE
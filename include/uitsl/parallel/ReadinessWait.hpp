@@ -0,0 +1,47 @@
+#pragma once
+#ifndef UITSL_PARALLEL_READINESSWAIT_HPP_INCLUDE
+#define UITSL_PARALLEL_READINESSWAIT_HPP_INCLUDE
+
+#include <utility>
+
+#include "ReadinessHub.hpp"
+#include "SpinWait.hpp"
+
+namespace uitsl {
+
+/**
+ * Wait strategy that waits like BaseWait and also publishes every keyed
+ * notification to `uitsl::ReadinessHub`, so schedulers can sleep awaits on
+ * a duct until it is published to.
+ *
+ * @tparam BaseWait wait strategy to wait and notify through.
+ */
+template<typename BaseWait=uitsl::SpinWait>
+struct ReadinessWait {
+
+  /**
+   * Call attempt until it returns true.
+   *
+   * @param attempt callable returning whether waiting is over.
+   * @param key address waited on, forwarded to BaseWait.
+   */
+  template<typename Attempt>
+  static void Until(Attempt&& attempt, const void* key=nullptr) {
+    BaseWait::Until( std::forward<Attempt>(attempt), key );
+  }
+
+  /**
+   * Wake threads waiting under BaseWait and publish key's readiness.
+   *
+   * @param key address published to, or nullptr to publish nothing.
+   */
+  static void Notify(const void* key=nullptr) {
+    BaseWait::Notify( key );
+    if ( key != nullptr ) uitsl::ReadinessHub::Publish( key );
+  }
+
+};
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_PARALLEL_READINESSWAIT_HPP_INCLUDE
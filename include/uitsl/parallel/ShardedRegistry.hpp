@@ -0,0 +1,366 @@
+#pragma once
+#ifndef UITSL_PARALLEL_SHARDEDREGISTRY_HPP_INCLUDE
+#define UITSL_PARALLEL_SHARDEDREGISTRY_HPP_INCLUDE
+
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stddef.h>
+#include <utility>
+
+#include "../../../third-party/Empirical/include/emp/base/array.hpp"
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+namespace uitsl {
+
+/**
+ * Set of non-null pointer-like handles that many threads can register into
+ * concurrently without contending with one another.
+ *
+ * Each thread appends into its own shard, lock-free. Shards are handed off
+ * to new threads when their owning thread exits. Deregistration may happen
+ * from any thread and only excludes concurrent visits to the same shard, so
+ * visitors never observe an item that is being destroyed.
+ *
+ * @tparam T pointer-like item type; a null `T` marks a vacant slot.
+ * @tparam BlockSize number of slots allocated at a time within a shard.
+ */
+template<typename T, size_t BlockSize=1024>
+class ShardedRegistry {
+
+  struct Block {
+    emp::array<std::atomic<T>, BlockSize> slots{};
+    std::atomic<Block*> next{ nullptr };
+
+    ~Block() { delete next.load(); }
+  };
+
+  struct Shard {
+    // held by a live thread?
+    std::atomic<bool> owned{ true };
+
+    // visitors take shared, deregistration takes exclusive
+    mutable std::shared_mutex mutex;
+
+    Block head_block;
+
+    // number of slots ever handed out, published with release semantics
+    std::atomic<size_t> size{};
+
+    // number of slots vacated by deregistration and not yet reused
+    std::atomic<size_t> num_vacant{};
+
+    // owner-only bookkeeping
+    Block* tail_block{ &head_block };
+    size_t reuse_cursor{};
+
+    Block* GetBlock(const size_t idx) {
+      Block* block{ &head_block };
+      for (size_t i = 0; i < idx / BlockSize; ++i) block = block->next.load();
+      return block;
+    }
+
+    std::atomic<T>* TryReuseSlot(const T& item) {
+      // only bother scanning once a sizable fraction of slots are vacant
+      const size_t cur_size = size.load( std::memory_order_relaxed );
+      if (
+        cur_size == 0
+        || num_vacant.load( std::memory_order_relaxed ) * 4 < cur_size
+      ) return nullptr;
+
+      // resume scanning where the last reuse left off
+      if ( reuse_cursor >= cur_size ) reuse_cursor = 0;
+      Block* block = GetBlock( reuse_cursor );
+      for (size_t i = 0; i < cur_size; ++i) {
+        auto& slot = block->slots[ reuse_cursor % BlockSize ];
+        if ( ++reuse_cursor == cur_size ) {
+          reuse_cursor = 0;
+          block = &head_block;
+        } else if ( reuse_cursor % BlockSize == 0 ) block = block->next.load();
+
+        // only the owner fills vacant slots, so there's no race to claim one
+        if ( slot.load( std::memory_order_relaxed ) == T{} ) {
+          slot.store( item, std::memory_order_release );
+          num_vacant.fetch_sub( 1, std::memory_order_relaxed );
+          return &slot;
+        }
+      }
+
+      return nullptr;
+    }
+
+    std::atomic<T>* Append(const T& item) {
+      const size_t idx = size.load( std::memory_order_relaxed );
+      if ( idx && idx % BlockSize == 0 ) {
+        Block* const block = new Block{};
+        tail_block->next.store( block, std::memory_order_release );
+        tail_block = block;
+      }
+      auto& slot = tail_block->slots[ idx % BlockSize ];
+      slot.store( item, std::memory_order_relaxed );
+      size.store( idx + 1, std::memory_order_release );
+      return &slot;
+    }
+
+    template<typename Visitor>
+    void Visit(Visitor&& visitor) const {
+      std::shared_lock lock{ mutex };
+      const size_t cur_size = size.load( std::memory_order_acquire );
+      const Block* block{ &head_block };
+      for (size_t i = 0; i < cur_size; ++i) {
+        if ( i && i % BlockSize == 0 ) {
+          block = block->next.load( std::memory_order_acquire );
+        }
+        const T item = block->slots[ i % BlockSize ].load(
+          std::memory_order_acquire
+        );
+        if ( item != T{} ) visitor( item );
+      }
+    }
+
+  };
+
+  // releases the calling thread's claim on a shard when the thread exits
+  struct Lease {
+    size_t registry_uid;
+    std::shared_ptr<Shard> shard;
+
+    Lease(const size_t registry_uid_, std::shared_ptr<Shard> shard_)
+    : registry_uid( registry_uid_ ), shard( std::move(shard_) )
+    { }
+
+    Lease(Lease&&) = default;
+
+    ~Lease() { if ( shard ) shard->owned.store( false ); }
+  };
+
+  inline static std::atomic<size_t> uid_counter{};
+  const size_t uid{ uid_counter++ };
+
+  // guards shard list, only contended when a thread registers for the first
+  // time or while a visit copies the list
+  mutable std::mutex shards_mutex;
+  emp::vector<std::shared_ptr<Shard>> shards;
+
+  std::shared_ptr<Shard> AcquireShard() {
+    const std::lock_guard guard{ shards_mutex };
+
+    // adopt a shard orphaned by an exited thread, if there is one
+    for (const auto& shard : shards) {
+      bool expected{ false };
+      if ( shard->owned.compare_exchange_strong( expected, true ) ) {
+        shard->tail_block = &shard->head_block;
+        while ( shard->tail_block->next.load() ) {
+          shard->tail_block = shard->tail_block->next.load();
+        }
+        return shard;
+      }
+    }
+
+    return shards.emplace_back( std::make_shared<Shard>() );
+  }
+
+  const std::shared_ptr<Shard>& GetLocalShard() {
+    thread_local emp::vector<Lease> leases;
+
+    for (const auto& lease : leases) {
+      if ( lease.registry_uid == uid ) return lease.shard;
+    }
+
+    return leases.emplace_back( uid, AcquireShard() ).shard;
+  }
+
+public:
+
+  using value_type = T;
+
+  /**
+   * RAII registration of a single item. Copies and assignments don't
+   * transfer registration, they leave each registration pinned to the item
+   * it was constructed with.
+   */
+  class Registration {
+
+    std::shared_ptr<Shard> shard;
+    std::atomic<T>* slot;
+
+  public:
+
+    Registration(ShardedRegistry& registry, const T& item)
+    : shard( registry.GetLocalShard() )
+    , slot( shard->TryReuseSlot( item ) ) {
+      emp_assert( item != T{} );
+      if ( slot == nullptr ) slot = shard->Append( item );
+    }
+
+    Registration(const Registration&) = delete;
+
+    Registration& operator=(const Registration&) { return *this; }
+
+    ~Registration() {
+      const std::unique_lock lock{ shard->mutex };
+      slot->store( T{}, std::memory_order_relaxed );
+      shard->num_vacant.fetch_add( 1, std::memory_order_relaxed );
+    }
+
+  };
+
+  ShardedRegistry() = default;
+
+  ShardedRegistry(const ShardedRegistry&) = delete;
+
+  /**
+   * Call visitor on every registered item, in no particular order.
+   *
+   * Items may be registered concurrently with a visit and may or may not be
+   * visited. Deregistration of any item in a shard under visit waits for the
+   * visit to move past that shard.
+   *
+   * @param visitor callable taking `const T&`.
+   */
+  template<typename Visitor>
+  void Visit(Visitor&& visitor) const {
+    // shards are never removed, so visit a copy of the list to let other
+    // visits and first-time registrations proceed meanwhile
+    const auto cur_shards = [this](){
+      const std::lock_guard guard{ shards_mutex };
+      return shards;
+    }();
+    for (const auto& shard : cur_shards) shard->Visit( visitor );
+  }
+
+  /**
+   * Block deregistration everywhere, e.g., to iterate with begin and end.
+   *
+   * @return handle that holds the lock until it is destroyed.
+   */
+  std::shared_ptr<void> MakeSharedLock() const {
+    struct Lock {
+      std::unique_lock<std::mutex> shards_lock;
+      emp::vector<std::shared_lock<std::shared_mutex>> shard_locks;
+    };
+
+    auto res = std::make_shared<Lock>();
+    res->shards_lock = std::unique_lock{ shards_mutex };
+    for (const auto& shard : shards) {
+      res->shard_locks.emplace_back( shard->mutex );
+    }
+    return res;
+  }
+
+  /**
+   * Forward iterator over registered items, which must be guarded by
+   * MakeSharedLock.
+   */
+  class const_iterator {
+
+    const ShardedRegistry* registry{ nullptr };
+    size_t shard_idx{};
+    size_t slot_idx{};
+    size_t shard_size{};
+    const Block* block{ nullptr };
+
+    bool AtEnd() const { return shard_idx == registry->shards.size(); }
+
+    T Peek() const {
+      return block->slots[ slot_idx % BlockSize ].load(
+        std::memory_order_acquire
+      );
+    }
+
+    void Step() {
+      ++slot_idx;
+      if ( slot_idx < shard_size && slot_idx % BlockSize == 0 ) {
+        block = block->next.load( std::memory_order_acquire );
+      }
+    }
+
+    void EnterShard() {
+      slot_idx = 0;
+      if ( AtEnd() ) return;
+      const auto& shard = *registry->shards[ shard_idx ];
+      shard_size = shard.size.load( std::memory_order_acquire );
+      block = &shard.head_block;
+    }
+
+    // advance until positioned at an occupied slot or the end
+    void Settle() {
+      while ( !AtEnd() ) {
+        while ( slot_idx < shard_size ) {
+          if ( Peek() != T{} ) return;
+          Step();
+        }
+        ++shard_idx;
+        EnterShard();
+      }
+    }
+
+  public:
+
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = T;
+
+    const_iterator() = default;
+
+    const_iterator(const ShardedRegistry& registry_, const size_t shard_idx_)
+    : registry( &registry_ ), shard_idx( shard_idx_ ) {
+      EnterShard();
+      Settle();
+    }
+
+    reference operator*() const { return Peek(); }
+
+    const_iterator& operator++() {
+      Step();
+      Settle();
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator res{ *this };
+      ++*this;
+      return res;
+    }
+
+    bool operator==(const const_iterator& other) const {
+      return shard_idx == other.shard_idx && (
+        AtEnd() || slot_idx == other.slot_idx
+      );
+    }
+
+    bool operator!=(const const_iterator& other) const {
+      return !operator==(other);
+    }
+
+  };
+
+  using iterator = const_iterator;
+
+  const_iterator begin() const { return const_iterator{ *this, 0 }; }
+
+  const_iterator end() const {
+    return const_iterator{ *this, shards.size() };
+  }
+
+  /**
+   * Count registered items.
+   *
+   * @return number of items visited.
+   */
+  size_t GetSize() const {
+    size_t res{};
+    Visit( [&res](const T&){ ++res; } );
+    return res;
+  }
+
+};
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_PARALLEL_SHARDEDREGISTRY_HPP_INCLUDE
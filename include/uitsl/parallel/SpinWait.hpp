@@ -0,0 +1,38 @@
+#pragma once
+#ifndef UITSL_PARALLEL_SPINWAIT_HPP_INCLUDE
+#define UITSL_PARALLEL_SPINWAIT_HPP_INCLUDE
+
+namespace uitsl {
+
+/**
+ * Wait strategy that retries immediately, keeping a core busy for as long as
+ * it waits.
+ *
+ * Lowest latency when every waiting thread has a core to itself.
+ */
+struct SpinWait {
+
+  /**
+   * Call attempt until it returns true.
+   *
+   * @param attempt callable returning whether waiting is over.
+   * @param key ignored.
+   */
+  template<typename Attempt>
+  static void Until(
+    Attempt&& attempt, [[maybe_unused]] const void* key=nullptr
+  ) {
+    while ( !attempt() );
+  }
+
+  /**
+   * Wake threads waiting under this strategy. No-op, spinners need no
+   * waking.
+   */
+  static void Notify([[maybe_unused]] const void* key=nullptr) { }
+
+};
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_PARALLEL_SPINWAIT_HPP_INCLUDE
@@ -20,7 +20,9 @@ public:
   : manager(std::make_shared<internal::ThreadIbarrierManager>(expected))
   { ; }
 
-  uitsl::ThreadIbarrier MakeBarrier() { return manager->MakeBarrier(); }
+  uitsl::ThreadIbarrier MakeBarrier() {
+    return uitsl::ThreadIbarrier{ manager, manager->Arrive() };
+  }
 
 };
 
@@ -3,8 +3,10 @@
 #define UITSL_PARALLEL_THREADTEAM_HPP_INCLUDE
 
 #include <algorithm>
+#include <functional>
 #include <stddef.h>
 #include <thread>
+#include <tuple>
 #include <utility>
 
 #include "../../../third-party/Empirical/include/emp/base/vector.hpp"
@@ -12,6 +14,7 @@
 #include "../polyfill/erase_if.hpp"
 
 #include "_TryJoinableThread.hpp"
+#include "affinity_utils.hpp"
 
 namespace uitsl {
 
@@ -19,11 +22,74 @@ class ThreadTeam {
 
   emp::vector<internal::TryJoinableThread> workers;
 
+  // if nonempty, the nth worker added is pinned to cpus[n % cpus.size()]
+  emp::vector<uitsl::cpu_id_t> cpus;
+  size_t num_added{};
+
+  // packs task and args into a callable that takes none, as std::thread does
+  template <typename Task, typename... Args>
+  static auto Bind(Task&& task, Args&&... args) {
+    return [call = std::make_tuple(
+      std::forward<Task>(task), std::forward<Args>(args)...
+    )]() mutable {
+      std::apply(
+        [](auto&... bound){ std::invoke( std::move(bound)... ); },
+        call
+      );
+    };
+  }
+
 public:
 
-  template <typename... Args>
-  void Add(Args&&... args) {
-    workers.emplace_back(std::forward<Args>(args)...);
+  ThreadTeam() = default;
+
+  /**
+   * @param cpus_ CPUs to pin workers to, in the order workers are added.
+   */
+  explicit ThreadTeam(emp::vector<uitsl::cpu_id_t> cpus_)
+  : cpus( std::move(cpus_) )
+  { }
+
+  /**
+   * Launch a worker that calls task with args, pinned if this team was
+   * given CPUs.
+   *
+   * @param task callable for worker to run.
+   * @param args arguments to call task with.
+   */
+  template <typename Task, typename... Args>
+  void Add(Task&& task, Args&&... args) {
+    if ( cpus.empty() ) workers.emplace_back(
+      Bind( std::forward<Task>(task), std::forward<Args>(args)... )
+    );
+    else AddPinned(
+      cpus[num_added % cpus.size()],
+      std::forward<Task>(task),
+      std::forward<Args>(args)...
+    );
+    ++num_added;
+  }
+
+  /**
+   * Launch a worker that runs only on cpu.
+   *
+   * Like `std::thread`, task and args are copied or moved into the worker,
+   * which then calls task with them.
+   *
+   * @param cpu CPU to pin worker to.
+   * @param task callable for worker to run.
+   * @param args arguments to call task with.
+   */
+  template <typename Task, typename... Args>
+  void AddPinned(const uitsl::cpu_id_t cpu, Task&& task, Args&&... args) {
+    workers.emplace_back(
+      [cpu, call = Bind(
+        std::forward<Task>(task), std::forward<Args>(args)...
+      )]() mutable {
+        uitsl::pin_this_thread( cpu );
+        call();
+      }
+    );
   }
 
   void Join() {
@@ -0,0 +1,335 @@
+#pragma once
+#ifndef UITSL_PARALLEL_WORKSTEALINGEXECUTOR_HPP_INCLUDE
+#define UITSL_PARALLEL_WORKSTEALINGEXECUTOR_HPP_INCLUDE
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <stddef.h>
+#include <utility>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/optional.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../polyfill/barrier.hpp"
+
+#include "affinity_utils.hpp"
+#include "cache_line.hpp"
+#include "thread_utils.hpp"
+#include "ThreadTeam.hpp"
+
+namespace uitsl {
+
+/**
+ * Runs rounds of tasks over a fixed team of threads, balancing load by
+ * work stealing within rounds and by migrating tasks between rounds.
+ *
+ * Each task is owned by one thread. Every round, each thread runs the tasks
+ * it owns. A thread that runs out steals not-yet-started tasks that are
+ * stealable from other threads, preferring tasks with the highest affinity
+ * for it. Thieves keep what they steal: ownership of stolen tasks moves
+ * once the round ends.
+ *
+ * Between rounds, while no task is running, ownership is further rebalanced
+ * from the thread that spent the longest on its tasks to the thread that
+ * spent the shortest, again preferring tasks with the highest affinity for
+ * the receiving thread. Each change of owner is reported through the
+ * migration callback at that same quiescent point, so it may safely rewire
+ * state shared between tasks.
+ *
+ * Tasks that run concurrently within a round must not race with one
+ * another. Use the stealable predicate to keep tasks that may only run on
+ * their owner's thread off other threads mid-round.
+ */
+class WorkStealingExecutor {
+
+public:
+
+  using task_id_t = size_t;
+  using task_t = std::function<void()>;
+
+  /// Higher values are stolen or migrated to thread first.
+  using affinity_t = std::function<size_t(task_id_t, uitsl::thread_id_t)>;
+
+  /// Whether a task may currently run on threads other than its owner.
+  using stealable_t = std::function<bool(task_id_t)>;
+
+  using migrate_t = std::function<void(
+    task_id_t, uitsl::thread_id_t from, uitsl::thread_id_t to
+  )>;
+
+private:
+
+  struct alignas(uitsl::CACHE_LINE_SIZE) Queue {
+    std::mutex mutex;
+    // owner pops from back, thieves steal from front
+    std::deque<task_id_t> pending;
+  };
+
+  struct Completion {
+    WorkStealingExecutor* executor;
+    void operator()() noexcept { executor->CompleteRound(); }
+  };
+
+  const size_t num_threads;
+
+  emp::vector<task_t> tasks;
+  emp::vector<uitsl::thread_id_t> owners;
+  emp::vector<bool> pinned;
+
+  // per-round bookkeeping, each element written only by the thread that ran
+  // the task
+  emp::vector<uitsl::thread_id_t> runners;
+  emp::vector<std::chrono::steady_clock::duration> costs;
+
+  emp::vector<Queue> queues;
+
+  affinity_t affinity{ [](task_id_t, uitsl::thread_id_t){ return 0; } };
+  stealable_t stealable{ [](task_id_t){ return true; } };
+  migrate_t on_migrate{ [](task_id_t, uitsl::thread_id_t, uitsl::thread_id_t){} };
+
+  // if nonempty, thread i runs on cpus[i % cpus.size()]
+  emp::vector<uitsl::cpu_id_t> cpus;
+
+  size_t steal_scan_depth{ 16 };
+  double imbalance_tolerance{ 0.1 };
+  size_t max_rebalances_per_round{ 16 };
+
+  size_t num_steals{};
+  size_t num_migrations{};
+
+  void FillQueues() {
+    for (task_id_t task{}; task < tasks.size(); ++task) {
+      queues[ owners[task] ].pending.push_back( task );
+    }
+  }
+
+  void RunTask(const task_id_t task, const uitsl::thread_id_t thread) {
+    const auto start = std::chrono::steady_clock::now();
+    tasks[task]();
+    costs[task] = std::chrono::steady_clock::now() - start;
+    runners[task] = thread;
+  }
+
+  emp::optional<task_id_t> PopOwn(const uitsl::thread_id_t thread) {
+    Queue& queue = queues[thread];
+    const std::lock_guard lock{ queue.mutex };
+    if ( queue.pending.empty() ) return std::nullopt;
+    const task_id_t res = queue.pending.back();
+    queue.pending.pop_back();
+    return res;
+  }
+
+  emp::optional<task_id_t> Steal(const uitsl::thread_id_t thief) {
+    for (size_t offset{ 1 }; offset < num_threads; ++offset) {
+      Queue& queue = queues[ (thief + offset) % num_threads ];
+      const std::lock_guard lock{ queue.mutex };
+
+      const size_t scan_depth = std::min(
+        steal_scan_depth, queue.pending.size()
+      );
+      emp::optional<size_t> best;
+      size_t best_affinity{};
+      for (size_t i{}; i < scan_depth; ++i) {
+        const task_id_t task = queue.pending[i];
+        if ( pinned[task] || !stealable(task) ) continue;
+        const size_t task_affinity = affinity( task, thief );
+        if ( !best.has_value() || task_affinity > best_affinity ) {
+          best = i;
+          best_affinity = task_affinity;
+        }
+      }
+
+      if ( best.has_value() ) {
+        const task_id_t res = queue.pending[*best];
+        queue.pending.erase( std::next( std::begin(queue.pending), *best ) );
+        return res;
+      }
+    }
+    return std::nullopt;
+  }
+
+  void RunRound(const uitsl::thread_id_t thread) {
+    while ( const auto task = PopOwn(thread) ) RunTask( *task, thread );
+    while ( const auto task = Steal(thread) ) RunTask( *task, thread );
+  }
+
+  void Migrate(
+    const task_id_t task,
+    const uitsl::thread_id_t to
+  ) {
+    const uitsl::thread_id_t from = owners[task];
+    owners[task] = to;
+    ++num_migrations;
+    on_migrate( task, from, to );
+  }
+
+  void Rebalance() {
+    using duration_t = std::chrono::steady_clock::duration;
+
+    emp::vector<duration_t> loads( num_threads );
+    for (task_id_t task{}; task < tasks.size(); ++task) {
+      loads[ owners[task] ] += costs[task];
+    }
+    const duration_t mean_load = std::accumulate(
+      std::begin(loads), std::end(loads), duration_t{}
+    ) / num_threads;
+
+    for (size_t i{}; i < max_rebalances_per_round; ++i) {
+      const auto [idlest, busiest] = std::minmax_element(
+        std::begin(loads), std::end(loads)
+      );
+      const duration_t gap = *busiest - *idlest;
+      if ( gap <= mean_load * imbalance_tolerance ) return;
+
+      const uitsl::thread_id_t from = std::distance( std::begin(loads), busiest );
+      const uitsl::thread_id_t to = std::distance( std::begin(loads), idlest );
+
+      // moving a task costing more than half the gap would overshoot
+      emp::optional<task_id_t> best;
+      size_t best_affinity{};
+      for (task_id_t task{}; task < tasks.size(); ++task) {
+        if ( owners[task] != from || pinned[task] ) continue;
+        if ( costs[task] * 2 > gap ) continue;
+        const size_t task_affinity = affinity( task, to );
+        if (
+          !best.has_value()
+          || task_affinity > best_affinity
+          || (task_affinity == best_affinity && costs[task] > costs[*best])
+        ) {
+          best = task;
+          best_affinity = task_affinity;
+        }
+      }
+      if ( !best.has_value() ) return;
+
+      loads[from] -= costs[*best];
+      loads[to] += costs[*best];
+      Migrate( *best, to );
+    }
+  }
+
+  // runs on one thread while all others wait at the barrier
+  void CompleteRound() {
+    for (task_id_t task{}; task < tasks.size(); ++task) {
+      if ( runners[task] != owners[task] ) {
+        ++num_steals;
+        Migrate( task, runners[task] );
+      }
+    }
+    Rebalance();
+    FillQueues();
+  }
+
+public:
+
+  /**
+   * @param num_threads_ number of threads to run tasks on.
+   */
+  explicit WorkStealingExecutor(const size_t num_threads_)
+  : num_threads( num_threads_ )
+  , queues( num_threads_ )
+  { emp_assert( num_threads ); }
+
+  /**
+   * Add a task.
+   *
+   * @param task callable to run once per round.
+   * @param owner thread to initially run task on.
+   * @param pin_task if true, task never runs on or moves to another thread.
+   * @return id of task.
+   */
+  task_id_t AddTask(
+    task_t task,
+    const uitsl::thread_id_t owner,
+    const bool pin_task=false
+  ) {
+    emp_assert( owner < num_threads );
+    tasks.push_back( std::move(task) );
+    owners.push_back( owner );
+    pinned.push_back( pin_task );
+    runners.push_back( owner );
+    costs.emplace_back();
+    return tasks.size() - 1;
+  }
+
+  void SetAffinity(affinity_t affinity_) { affinity = std::move(affinity_); }
+
+  void SetStealable(stealable_t stealable_) {
+    stealable = std::move(stealable_);
+  }
+
+  void SetOnMigrate(migrate_t on_migrate_) {
+    on_migrate = std::move(on_migrate_);
+  }
+
+  /**
+   * @param cpus_ CPUs to pin threads to, indexed by thread id.
+   */
+  void SetCpus(emp::vector<uitsl::cpu_id_t> cpus_) { cpus = std::move(cpus_); }
+
+  /**
+   * @param depth how many of a victim's next tasks a thief considers.
+   */
+  void SetStealScanDepth(const size_t depth) { steal_scan_depth = depth; }
+
+  /**
+   * @param tolerance skip rebalancing while the gap between the busiest and
+   * idlest thread is within this fraction of mean per-thread load.
+   * @param max_per_round most tasks rebalanced after any round.
+   */
+  void SetRebalancing(const double tolerance, const size_t max_per_round) {
+    imbalance_tolerance = tolerance;
+    max_rebalances_per_round = max_per_round;
+  }
+
+  /**
+   * Run every task num_rounds times, with all tasks finishing each round
+   * before any task starts the next.
+   *
+   * @param num_rounds number of rounds to run.
+   */
+  void Run(const size_t num_rounds) {
+    FillQueues();
+
+    std::barrier<Completion> barrier{
+      static_cast<std::ptrdiff_t>(num_threads), Completion{ this }
+    };
+
+    uitsl::ThreadTeam team{ cpus };
+    for (uitsl::thread_id_t thread{}; thread < num_threads; ++thread) {
+      team.Add( [this, &barrier, thread, num_rounds](){
+        for (size_t round{}; round < num_rounds; ++round) {
+          RunRound( thread );
+          barrier.arrive_and_wait();
+        }
+      } );
+    }
+    team.Join();
+
+    for (auto& queue : queues) queue.pending.clear();
+  }
+
+  uitsl::thread_id_t GetOwner(const task_id_t task) const {
+    return owners[task];
+  }
+
+  size_t GetNumTasks() const { return tasks.size(); }
+
+  size_t GetNumThreads() const { return num_threads; }
+
+  /// How many tasks ran on a thread other than their owner?
+  size_t GetNumSteals() const { return num_steals; }
+
+  /// How many times has a task changed owner?
+  size_t GetNumMigrations() const { return num_migrations; }
+
+};
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_PARALLEL_WORKSTEALINGEXECUTOR_HPP_INCLUDE
@@ -0,0 +1,45 @@
+#pragma once
+#ifndef UITSL_PARALLEL_YIELDWAIT_HPP_INCLUDE
+#define UITSL_PARALLEL_YIELDWAIT_HPP_INCLUDE
+
+#include <stddef.h>
+#include <thread>
+
+namespace uitsl {
+
+/**
+ * Wait strategy that spins briefly then yields its core between retries.
+ *
+ * Suits oversubscribed cores, where whoever the waiter is waiting on may
+ * need the core to make progress.
+ *
+ * @tparam SpinCount number of attempts to retry immediately before yielding.
+ */
+template<size_t SpinCount=64>
+struct YieldWait {
+
+  /**
+   * Call attempt until it returns true.
+   *
+   * @param attempt callable returning whether waiting is over.
+   * @param key ignored.
+   */
+  template<typename Attempt>
+  static void Until(
+    Attempt&& attempt, [[maybe_unused]] const void* key=nullptr
+  ) {
+    for (size_t i{}; i < SpinCount; ++i) if ( attempt() ) return;
+    while ( !attempt() ) std::this_thread::yield();
+  }
+
+  /**
+   * Wake threads waiting under this strategy. No-op, yielders need no
+   * waking.
+   */
+  static void Notify([[maybe_unused]] const void* key=nullptr) { }
+
+};
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_PARALLEL_YIELDWAIT_HPP_INCLUDE
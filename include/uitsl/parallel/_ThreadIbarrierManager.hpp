@@ -2,82 +2,172 @@
 #ifndef UITSL_PARALLEL__THREADIBARRIERMANAGER_HPP_INCLUDE
 #define UITSL_PARALLEL__THREADIBARRIERMANAGER_HPP_INCLUDE
 
+#include <algorithm>
+#include <atomic>
 #include <iterator>
+#include <limits>
 #include <memory>
-#include <mutex>
+#include <stddef.h>
+#include <unordered_map>
 
-#include "../containers/safe/list.hpp"
-#include "../polyfill/latch.hpp"
+#include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
 
-#include "ThreadIbarrier.hpp"
-#include "ThreadMap.hpp"
+#include "cache_line.hpp"
 
 namespace uitsl {
 namespace internal {
 
+/*
+ * Lock-free state behind a `ThreadIbarrierFactory`.
+ *
+ * Each participating thread owns one cache-line-padded slot counting how
+ * many barriers it has arrived at. Round r is complete once every slot has
+ * counted past r. This is a sense-reversing barrier with the sense bit
+ * widened to a full round count, so threads may run any number of rounds
+ * ahead. Arriving writes only the caller's own slot. Checking completion
+ * reads every slot, unless a previous check already recorded the round as
+ * complete.
+ *
+ * A thread that exits gives up its slot, and the next thread to claim the
+ * slot takes over its count of arrivals. So, a long-lived manager may serve
+ * any number of successive teams, as long as no more than the expected
+ * number of threads use it at once. Managers must be owned by a
+ * `std::shared_ptr`.
+ */
 class ThreadIbarrierManager
-: public std::enable_shared_from_this<ThreadIbarrierManager>
-{
+: public std::enable_shared_from_this<ThreadIbarrierManager> {
 
-  using latches_t = uitsl::safe::list<internal::SharedLatch>;
-  latches_t latches;
+  struct alignas(uitsl::CACHE_LINE_SIZE) Slot {
+    std::atomic<size_t> arrivals{};
+    std::atomic<bool> claimed{};
+  };
 
-  uitsl::ThreadMap<latches_t::iterator> thread_positions;
+  emp::vector<Slot> slots;
 
-  size_t expected;
+  /// Every round before this one is known to be complete.
+  alignas(uitsl::CACHE_LINE_SIZE) std::atomic<size_t> num_completed{};
 
-  std::mutex flush_mutex;
+  /// Distinguishes managers in the per-thread slot cache, even if one is
+  /// allocated where another was freed.
+  const size_t uid{ next_uid.fetch_add(1, std::memory_order_relaxed) };
 
-  void TryFlush() {
+  inline static std::atomic<size_t> next_uid{};
 
-    // prevent double-popping race condition
-    const std::lock_guard guard{ flush_mutex };
+  /// Bumped whenever any manager is destroyed, so threads know to prune.
+  inline static std::atomic<size_t> num_destroyed{};
 
-    // try to discard old latches
-    while ( latches.size() && latches.front().IsObsolete() ) {
-      latches.pop_front();
-    }
+  /// A thread's claimed slots, given up when the thread exits.
+  class ThreadClaims {
 
-  }
+    struct Claim {
+      std::weak_ptr<ThreadIbarrierManager> manager;
+      size_t slot;
+    };
 
-public:
+    // manager uid -> claim
+    std::unordered_map<size_t, Claim> claims;
 
-  ThreadIbarrierManager(const size_t expected_)
-  : expected(expected_)
-  { ; }
+    size_t num_destroyed_seen{};
 
-  uitsl::ThreadIbarrier MakeBarrier() {
+  public:
 
-    // race condition where multiple latches are appended is okay
-    if (latches.empty()) latches.emplace_back(expected);
+    ~ThreadClaims() {
+      for (const auto& [uid, claim] : claims) {
+        if ( const auto manager = claim.manager.lock() ) {
+          manager->ReleaseSlot( claim.slot );
+        }
+      }
+    }
 
-    emp_assert(latches.size());
+    /// Forget claims on managers destroyed since the last call.
+    void Prune() {
+      const size_t destroyed = num_destroyed.load( std::memory_order_relaxed );
+      if ( destroyed == num_destroyed_seen ) return;
+      num_destroyed_seen = destroyed;
 
-    auto& position = thread_positions.HasEntry()
-      ? thread_positions.Get()
-      : thread_positions.GetWithDefault( std::begin(latches) );
-    emp_assert(thread_positions.GetSize() <= expected);
+      for (auto it = std::begin( claims ); it != std::end( claims ); ) {
+        if ( it->second.manager.expired() ) it = claims.erase( it );
+        else ++it;
+      }
+    }
 
-    emp_assert(position != std::end(latches));
-    emp_assert(!position->TryWait());
+    /// Get manager's slot for the calling thread, claiming one if need be.
+    size_t Get(ThreadIbarrierManager& manager) {
+      Prune();
+      const auto [it, inserted] = claims.try_emplace( manager.uid );
+      if ( inserted ) it->second = Claim{
+        manager.weak_from_this(), manager.ClaimSlot()
+      };
+      emp_assert( !it->second.manager.expired() );
+      return it->second.slot;
+    }
 
-    // race condition where multiple latches are appended is okay
-    if (std::next(position) == std::end(latches)) {
-      latches.emplace_back(expected);
-      emp_assert(std::next(position) != std::end(latches));
+  };
+
+  size_t ClaimSlot() {
+    for (size_t slot{}; slot < slots.size(); ++slot) {
+      bool claimed = slots[slot].claimed.load( std::memory_order_relaxed );
+      if ( !claimed && slots[slot].claimed.compare_exchange_strong(
+        claimed, true, std::memory_order_acquire, std::memory_order_relaxed
+      ) ) return slot;
     }
+    emp_always_assert( false, "more threads than expected", slots.size() );
+    return slots.size();
+  }
 
-    std::advance(position, 1);
-    emp_assert(position != std::end(latches));
-    emp_assert(!position->TryWait());
+  void ReleaseSlot(const size_t slot) {
+    // hand the slot's arrivals over to whichever thread claims it next
+    slots[slot].claimed.store( false, std::memory_order_release );
+  }
 
-    TryFlush();
+  Slot& GetSlot() {
+    // allocates only on a thread's first arrival
+    static thread_local ThreadClaims claims;
+    return slots[ claims.Get( *this ) ];
+  }
 
-    return ThreadIbarrier{
-      shared_from_this(),
-      *std::prev(position)
-    };
+public:
+
+  ThreadIbarrierManager(const size_t expected)
+  : slots( expected )
+  { ; }
+
+  ~ThreadIbarrierManager() {
+    num_destroyed.fetch_add( 1, std::memory_order_relaxed );
+  }
+
+  /// Arrive at the calling thread's next barrier.
+  /// @return round of the barrier arrived at.
+  size_t Arrive() {
+    auto& arrivals = GetSlot().arrivals;
+    // only the owning thread writes its slot
+    const size_t round = arrivals.load( std::memory_order_relaxed );
+    arrivals.store( round + 1, std::memory_order_release );
+    return round;
+  }
 
+  /// Has every thread arrived at round?
+  bool IsComplete(const size_t round) {
+    size_t completed = num_completed.load( std::memory_order_acquire );
+    if ( completed > round ) return true;
+
+    size_t least = std::numeric_limits<size_t>::max();
+    for (const auto& slot : slots) least = std::min(
+      least, slot.arrivals.load( std::memory_order_acquire )
+    );
+
+    // record progress so later checks can skip the scan
+    while (
+      completed < least
+      && !num_completed.compare_exchange_weak(
+        completed, least,
+        std::memory_order_acq_rel, std::memory_order_acquire
+      )
+    );
+
+    return least > round;
   }
 
 };
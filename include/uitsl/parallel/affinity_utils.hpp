@@ -0,0 +1,53 @@
+#pragma once
+#ifndef UITSL_PARALLEL_AFFINITY_UTILS_HPP_INCLUDE
+#define UITSL_PARALLEL_AFFINITY_UTILS_HPP_INCLUDE
+
+#include <stddef.h>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+namespace uitsl {
+
+/// Logical CPU number, as the operating system numbers them.
+using cpu_id_t = size_t;
+
+/// Which CPUs may the calling thread run on?
+/// @return allowed CPUs in ascending order, empty if unknown.
+inline emp::vector<cpu_id_t> get_allowed_cpus() {
+  emp::vector<cpu_id_t> res;
+
+  #ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO( &set );
+  if ( sched_getaffinity(0, sizeof(set), &set) == 0 ) {
+    for (cpu_id_t cpu{}; cpu < CPU_SETSIZE; ++cpu) {
+      if ( CPU_ISSET(cpu, &set) ) res.push_back( cpu );
+    }
+  }
+  #endif
+
+  return res;
+}
+
+/// Restrict the calling thread to run only on cpu.
+/// @return true if the thread was pinned.
+inline bool pin_this_thread(const cpu_id_t cpu) {
+  #ifdef __linux__
+  if ( cpu >= CPU_SETSIZE ) return false;
+  cpu_set_t set;
+  CPU_ZERO( &set );
+  CPU_SET( cpu, &set );
+  return pthread_setaffinity_np( pthread_self(), sizeof(set), &set ) == 0;
+  #else
+  return false;
+  #endif
+}
+
+} // namespace uitsl
+
+#endif // #ifndef UITSL_PARALLEL_AFFINITY_UTILS_HPP_INCLUDE
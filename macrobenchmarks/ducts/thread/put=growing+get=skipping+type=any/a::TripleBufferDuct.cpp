@@ -0,0 +1,9 @@
+#include "uit/ducts/thread/put=growing+get=skipping+type=any/a::TripleBufferDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+using ImplSel = uit::ImplSelect<
+  uit::a::TripleBufferDuct,
+  uit::a::TripleBufferDuct
+>;
+
+#include "../ThreadDuct.hpp"
@@ -0,0 +1,10 @@
+#include "uit/ducts/proc/put=dropping+get=stepping+type=trivial/inlet=RingSendInit+outlet=RingRecvInit_t::IrsiOrriDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+using ImplSel = uit::ImplSelect<
+  uit::a::SerialPendingDuct,
+  uit::a::AtomicPendingDuct,
+  uit::t::IrsiOrriDuct
+>;
+
+#include "../ProcDuct.hpp"
@@ -0,0 +1,10 @@
+#include "uit/ducts/proc/put=dropping+get=stepping+type=trivial/inlet=ShmPush+outlet=ShmPop_t::IspOspDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+using ImplSel = uit::ImplSelect<
+  uit::a::SerialPendingDuct,
+  uit::a::AtomicPendingDuct,
+  uit::t::IspOspDuct
+>;
+
+#include "../ProcDuct.hpp"
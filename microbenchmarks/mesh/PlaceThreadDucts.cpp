@@ -0,0 +1,90 @@
+#include <atomic>
+#include <stddef.h>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+#include <mpi.h>
+
+#include "uitsl/mpi/MpiGuard.hpp"
+#include "uitsl/parallel/affinity_utils.hpp"
+#include "uitsl/parallel/CpuTopology.hpp"
+
+#include "uit/setup/ImplSpec.hpp"
+
+#include "netuit/arrange/RingTopologyFactory.hpp"
+#include "netuit/mesh/Mesh.hpp"
+
+const uitsl::MpiGuard guard;
+
+using Spec = uit::ImplSpec<size_t>;
+
+// read before any benchmark pins the main thread
+const uitsl::CpuTopology cpus = uitsl::CpuTopology::FromSysfs();
+
+// CPUs are in hierarchical order, so the first and last are farthest apart
+const uitsl::cpu_id_t producer_cpu = cpus.GetCpu( 0 ).cpu_id;
+const uitsl::cpu_id_t consumer_cpu = cpus.GetCpu( cpus.GetSize() - 1 ).cpu_id;
+
+template<bool Place>
+static void PlaceThreadDucts(benchmark::State& state) {
+
+  // set up
+  // build the mesh on the producer's CPU, so without placement duct storage
+  // lands on the producer's NUMA node
+  uitsl::pin_this_thread( producer_cpu );
+
+  netuit::Mesh<Spec> mesh{
+    netuit::RingTopologyFactory{}( 2 ),
+    [](const size_t node_id){ return node_id; }
+  };
+  if constexpr ( Place ) mesh.PlaceThreadDucts( { producer_cpu, consumer_cpu } );
+
+  auto producer = mesh.GetSubmesh( 0 );
+  auto consumer = mesh.GetSubmesh( 1 );
+
+  std::atomic<bool> done{};
+  std::thread producer_thread{ [&producer, &done](){
+    uitsl::pin_this_thread( producer_cpu );
+    size_t msg{};
+    while ( !done.load(std::memory_order_relaxed) ) {
+      producer.front().GetOutput(0).TryPut( ++msg );
+    }
+  } };
+
+  uitsl::pin_this_thread( consumer_cpu );
+
+  // benchmark
+  size_t num_fresh{};
+  size_t prev{};
+  for (auto _ : state) {
+    const size_t msg = consumer.front().GetInput(0).JumpGet();
+    num_fresh += msg != prev;
+    prev = msg;
+  }
+
+  done = true;
+  producer_thread.join();
+
+  // log results
+  state.counters.insert({
+    {
+      "Fresh Messages Received",
+      benchmark::Counter( num_fresh, benchmark::Counter::kIsRate )
+    },
+    {
+      "Cross-Package",
+      cpus.GetCpu( 0 ).package_id != cpus.GetCpu( cpus.GetSize() - 1 ).package_id
+    },
+    {
+      "Cross-NUMA-Node",
+      cpus.GetCpu( 0 ).numa_node_id
+        != cpus.GetCpu( cpus.GetSize() - 1 ).numa_node_id
+    }
+  });
+
+}
+
+BENCHMARK_TEMPLATE(PlaceThreadDucts, false)->UseRealTime();
+BENCHMARK_TEMPLATE(PlaceThreadDucts, true)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,67 @@
+#include <atomic>
+#include <stddef.h>
+
+#include <benchmark/benchmark.h>
+
+#include "uitsl/parallel/ThreadIbarrier.hpp"
+#include "uitsl/parallel/ThreadIbarrierFactory.hpp"
+#include "uitsl/parallel/ThreadTeam.hpp"
+#include "uitsl/polyfill/barrier.hpp"
+
+// time for every thread to pass a barrier, with state.range(0) threads
+static void ThreadIbarrier(benchmark::State& state) {
+
+  // set up
+  const size_t num_threads = state.range(0);
+  uitsl::ThreadIbarrierFactory factory{ num_threads };
+  std::atomic<bool> done{};
+
+  uitsl::ThreadTeam team;
+  for (size_t i = 1; i < num_threads; ++i) team.Add( [&factory, &done](){
+    while ( !done.load(std::memory_order_relaxed) ) {
+      const uitsl::ThreadIbarrier barrier{ factory.MakeBarrier() };
+      while (
+        !barrier.IsComplete() && !done.load(std::memory_order_relaxed)
+      );
+    }
+  } );
+
+  // benchmark
+  for (auto _ : state) {
+    const uitsl::ThreadIbarrier barrier{ factory.MakeBarrier() };
+    while ( !barrier.IsComplete() );
+  }
+
+  done = true;
+  team.Join();
+
+}
+
+// blocking std::barrier, for comparison
+static void StdBarrier(benchmark::State& state) {
+
+  // set up
+  const size_t num_threads = state.range(0);
+  std::barrier barrier{ static_cast<std::ptrdiff_t>(num_threads) };
+  std::atomic<bool> done{};
+
+  uitsl::ThreadTeam team;
+  for (size_t i = 1; i < num_threads; ++i) team.Add( [&barrier, &done](){
+    while ( !done.load(std::memory_order_relaxed) ) barrier.arrive_and_wait();
+    barrier.arrive_and_drop();
+  } );
+
+  // benchmark
+  for (auto _ : state) barrier.arrive_and_wait();
+
+  // release helpers waiting on the final round
+  done = true;
+  barrier.arrive_and_drop();
+  team.Join();
+
+}
+
+BENCHMARK(ThreadIbarrier)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+BENCHMARK(StdBarrier)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+
+BENCHMARK_MAIN();
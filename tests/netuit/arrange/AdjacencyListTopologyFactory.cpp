@@ -0,0 +1,28 @@
+#include <sstream>
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "netuit/arrange/AdjacencyListTopologyFactory.hpp"
+
+TEST_CASE("Test AdjacencyListTopologyFactory", "[nproc:1]") {
+
+  REQUIRE( netuit::AdjacencyListTopologyFactory{}({}).GetSize() == 0 );
+
+  const netuit::adjacency_list_t adjacency{ {1, 2}, {2}, {0}, {} };
+
+  const netuit::Topology topology
+    = netuit::AdjacencyListTopologyFactory{}(adjacency);
+  REQUIRE( topology.GetSize() == 4 );
+
+  REQUIRE( topology[0].GetNumOutputs() == 2 );
+  REQUIRE( topology[0].GetNumInputs() == 1 );
+  REQUIRE( topology[2].GetNumInputs() == 2 );
+  REQUIRE( topology[3].GetNumOutputs() == 0 );
+  REQUIRE( topology[3].GetNumInputs() == 0 );
+
+  // matches reading the same adjacency list from a stream
+  std::istringstream ss{ "0 1 2\n1 2\n2 0\n3\n" };
+  std::istream& is{ ss };
+  REQUIRE( netuit::Topology{ is }.ToString() == topology.ToString() );
+
+}
@@ -1,11 +1,68 @@
-#include <fstream>
-
 #include "Catch/single_include/catch2/catch.hpp"
 
 #include "netuit/arrange/NavigableSmallWorldTopologyFactory.hpp"
 
-#include "NetworkXTester.hpp"
-
 TEST_CASE("Test NavigableSmallWorldTopologyFactory", "[nproc:1]") {
-  REQUIRE(test_all_adj(netuit::NavigableSmallWorldTopologyFactory{}));
+
+  for (const size_t n : {1, 2, 3, 10, 15, 27}) {
+    REQUIRE( netuit::NavigableSmallWorldTopologyFactory{}(n).GetSize() == n );
+  }
+
+  REQUIRE( netuit::NavigableSmallWorldTopologyFactory{}(
+    emp::vector<size_t>{4, 4, 4}
+  ).GetSize() == 64 );
+
+  // deterministic
+  REQUIRE(
+    netuit::NavigableSmallWorldTopologyFactory{}(100).ToString()
+    == netuit::NavigableSmallWorldTopologyFactory{}(100).ToString()
+  );
+
+}
+
+TEST_CASE("Test NavigableSmallWorldTopologyFactory edges", "[nproc:1]") {
+
+  // without long-range contacts, each node joins lattice points within p
+  {
+    const auto topology
+      = netuit::make_navigable_small_world_topology(5, 1, 0, 2.0, 2);
+    size_t num_corners{}, num_sides{}, num_interior{};
+    for (const auto& node : topology) {
+      REQUIRE( node.GetNumOutputs() == node.GetNumInputs() );
+      num_corners += node.GetNumOutputs() == 2;
+      num_sides += node.GetNumOutputs() == 3;
+      num_interior += node.GetNumOutputs() == 4;
+    }
+    REQUIRE( num_corners == 4 );
+    REQUIRE( num_sides == 12 );
+    REQUIRE( num_interior == 9 );
+  }
+
+  {
+    const auto topology
+      = netuit::make_navigable_small_world_topology(7, 2, 0, 2.0, 1);
+    for (size_t i = 0; i < topology.GetSize(); ++i) {
+      const size_t expected = std::min(i, size_t{2})
+        + std::min(topology.GetSize() - 1 - i, size_t{2});
+      REQUIRE( topology[i].GetNumOutputs() == expected );
+    }
+  }
+
+  // long-range contacts add at most q out-edges and never self loops
+  for (const size_t dim : {1, 2, 3}) {
+    const auto short_range
+      = netuit::make_navigable_small_world_topology(6, 1, 0, 2.0, dim);
+    const auto with_long_range
+      = netuit::make_navigable_small_world_topology(6, 1, 3, 2.0, dim);
+    const auto [x_adj, adjacency] = with_long_range.AsCSR();
+    for (size_t i = 0; i < short_range.GetSize(); ++i) {
+      const size_t num_extra = with_long_range[i].GetNumOutputs()
+        - short_range[i].GetNumOutputs();
+      REQUIRE( num_extra <= 3 );
+      for (auto j = x_adj[i]; j < x_adj[i + 1]; ++j) {
+        REQUIRE( static_cast<size_t>( adjacency[j] ) != i );
+      }
+    }
+  }
+
 }
@@ -1,11 +1,54 @@
-#include <fstream>
+#include <ratio>
 
 #include "Catch/single_include/catch2/catch.hpp"
 
 #include "netuit/arrange/SmallWorldGridTopologyFactory.hpp"
 
-#include "NetworkXTester.hpp"
-
 TEST_CASE("Test SmallWorldGridTopologyFactory", "[nproc:1]") {
-  REQUIRE(test_all_adj(netuit::SmallWorldGridTopologyFactory{}));
+
+  for (const size_t n : {1, 2, 3, 10, 15, 27}) {
+    REQUIRE( netuit::SmallWorldGridTopologyFactory{}(n).GetSize() == n );
+  }
+
+  REQUIRE(
+    netuit::SmallWorldGridTopologyFactory{}(emp::vector<size_t>{5, 5, 5}).GetSize()
+    == 125
+  );
+
+  // deterministic
+  REQUIRE(
+    netuit::SmallWorldGridTopologyFactory{}(100).ToString()
+    == netuit::SmallWorldGridTopologyFactory{}(100).ToString()
+  );
+
+}
+
+TEST_CASE("Test SmallWorldGridTopologyFactory edges", "[nproc:1]") {
+
+  // without long distance connections, a periodic lattice
+  for (const size_t dim : {1, 2, 3}) {
+    const auto topology = netuit::make_small_world_grid_topology(5, 0.0, dim);
+    for (const auto& node : topology) {
+      REQUIRE( node.GetNumOutputs() == 2 * dim );
+      REQUIRE( node.GetNumInputs() == 2 * dim );
+    }
+  }
+
+  // every node pairs off, except one left over if node count is odd
+  for (const size_t n : {10, 15}) {
+    size_t num_extra{};
+    for (const auto& node : netuit::SmallWorldGridTopologyFactory{}(n)) {
+      REQUIRE( node.GetNumOutputs() == node.GetNumInputs() );
+      REQUIRE( node.GetNumOutputs() >= 2 );
+      REQUIRE( node.GetNumOutputs() <= 3 );
+      num_extra += node.GetNumOutputs() - 2;
+    }
+    REQUIRE( num_extra <= n - n % 2 );
+    REQUIRE( num_extra > 0 );
+  }
+
+  for (const auto& node : netuit::SmallWorldGridTopologyFactory<
+    std::ratio<0>
+  >{}(100)) REQUIRE( node.GetNumOutputs() == 2 );
+
 }
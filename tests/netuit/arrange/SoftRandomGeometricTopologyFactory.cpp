@@ -1,11 +1,65 @@
-#include <fstream>
+#include <algorithm>
 
 #include "Catch/single_include/catch2/catch.hpp"
 
-#include "netuit/arrange/SoftRandomGeometricTopologyFactory.hpp"
+#include "uitsl/debug/safe_compare.hpp"
 
-#include "NetworkXTester.hpp"
+#include "netuit/arrange/SoftRandomGeometricTopologyFactory.hpp"
 
 TEST_CASE("Test SoftRandomGeometricTopologyFactory", "[nproc:1]") {
-  REQUIRE(test_all_adj(netuit::SoftRandomGeometricTopologyFactory{}));
+
+  for (const size_t n : {0, 1, 3, 10, 15, 27, 100}) {
+    REQUIRE( netuit::SoftRandomGeometricTopologyFactory{}(n).GetSize() == n );
+  }
+
+  // deterministic
+  REQUIRE(
+    netuit::SoftRandomGeometricTopologyFactory{}(100).ToString()
+    == netuit::SoftRandomGeometricTopologyFactory{}(100).ToString()
+  );
+
+  // different seeds give different graphs
+  REQUIRE(
+    netuit::make_soft_random_geometric_topology(100, 0.1, 2, 1).ToString()
+    != netuit::make_soft_random_geometric_topology(100, 0.1, 2, 2).ToString()
+  );
+
+}
+
+TEST_CASE("Test SoftRandomGeometricTopologyFactory edges", "[nproc:1]") {
+
+  for (const size_t dim : {1, 2, 3}) {
+    const auto [x_adj, adjacency]
+      = netuit::make_soft_random_geometric_topology(500, 0.1, dim).AsCSR();
+
+    // each undirected edge is listed once, from lower to higher node id
+    for (size_t node = 0; node + 1 < x_adj.size(); ++node) {
+      REQUIRE( std::all_of(
+        std::next( std::begin(adjacency), x_adj[node] ),
+        std::next( std::begin(adjacency), x_adj[node + 1] ),
+        [node](const auto neighbor){ return uitsl::safe_greater(neighbor, node); }
+      ) );
+    }
+  }
+
+  // with radius spanning the unit square, every pair is a candidate and
+  // is joined with probability exp(-distance), about 0.6 on average
+  {
+    const size_t n = 100;
+    const size_t num_edges
+      = netuit::make_soft_random_geometric_topology(n, 2.0).AsCSR().second.size();
+    REQUIRE( num_edges > 0.5 * n * (n - 1) / 2 );
+    REQUIRE( num_edges < 0.7 * n * (n - 1) / 2 );
+  }
+
+  // with radius 0.1, a node away from the boundary has about
+  // pi * 0.01 * n candidates, nearly all of which are joined
+  {
+    const size_t n = 1000;
+    const size_t num_edges
+      = netuit::make_soft_random_geometric_topology(n, 0.1).AsCSR().second.size();
+    REQUIRE( num_edges > 10000 );
+    REQUIRE( num_edges < 16000 );
+  }
+
 }
@@ -0,0 +1,53 @@
+#include <stddef.h>
+#include <unordered_set>
+
+#include <mpi.h>
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uitsl/parallel/CpuTopology.hpp"
+
+#include "netuit/arrange/ToroidalTopologyFactory.hpp"
+#include "netuit/assign/GenerateHierarchicalAssignments.hpp"
+#include "netuit/topology/Topology.hpp"
+
+namespace {
+
+// two packages, two cores each, two hardware threads per core
+const uitsl::CpuTopology cpus{ {
+  {0, 0, 0, 0}, {1, 0, 0, 1}, {2, 1, 1, 0}, {3, 1, 1, 1},
+  {4, 0, 0, 0}, {5, 0, 0, 1}, {6, 1, 1, 0}, {7, 1, 1, 1},
+} };
+
+} // namespace
+
+TEST_CASE("Test GenerateHierarchicalAssignments") {
+
+  netuit::Topology topo = netuit::make_toroidal_topology( {16, 16} );
+
+  const auto [proc_assigner, thread_assigner]
+    = netuit::GenerateHierarchicalAssignments( 2, cpus, topo );
+
+  std::unordered_set<size_t> threads_used;
+  for (size_t node = 0; node < topo.GetSize(); ++node) {
+    REQUIRE( proc_assigner(node) < 2 );
+    REQUIRE( thread_assigner(node) < cpus.GetSize() );
+    threads_used.insert( thread_assigner(node) );
+  }
+  REQUIRE( threads_used.size() == cpus.GetSize() );
+
+}
+
+TEST_CASE("Test GenerateHierarchicalAssignments, fewer nodes than CPUs") {
+
+  netuit::Topology topo = netuit::make_toroidal_topology( {5} );
+
+  const auto [proc_assigner, thread_assigner]
+    = netuit::GenerateHierarchicalAssignments( 1, cpus, topo );
+
+  for (size_t node = 0; node < topo.GetSize(); ++node) {
+    REQUIRE( proc_assigner(node) == 0 );
+    REQUIRE( thread_assigner(node) < cpus.GetSize() );
+  }
+
+}
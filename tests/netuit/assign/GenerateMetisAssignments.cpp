@@ -1,3 +1,5 @@
+#include <unordered_map>
+
 #include <mpi.h>
 
 #include "Catch/single_include/catch2/catch.hpp"
@@ -6,6 +8,7 @@
 #include "netuit/arrange/DyadicTopologyFactory.hpp"
 #include "netuit/arrange/ToroidalTopologyFactory.hpp"
 #include "netuit/assign/GenerateMetisAssignments.hpp"
+#include "netuit/assign/MetisWeights.hpp"
 #include "netuit/topology/Topology.hpp"
 
 TEST_CASE("Test PartitionMetis, complete topology") {
@@ -59,3 +62,50 @@ TEST_CASE("Test GenerateMetisAssignments, toroidal topology") {
   netuit::GenerateMetisAssignments(1, 1, topo17);
   netuit::GenerateMetisAssignments(2, 2, topo17);
 }
+
+TEST_CASE("Test PartitionMetis, weighted") {
+  netuit::Topology topo16 = netuit::make_toroidal_topology( {4, 4} );
+
+  netuit::MetisWeights weights;
+  weights.node_weights.assign( 16, 1 );
+  weights.node_weights[0] = 8;
+  for (const auto& output : topo16[0].GetOutputs()) {
+    weights.edge_weights[ output.GetEdgeID() ] = 100;
+  }
+  weights.part_weights = { 3.0, 1.0 };
+
+  const auto partition = netuit::PartitionMetis(2, topo16, weights);
+  REQUIRE( partition.size() == 16 );
+  for (const auto part : partition) REQUIRE( (part == 0 || part == 1) );
+}
+
+TEST_CASE("Test GenerateMetisAssignments, heterogeneous procs") {
+  netuit::Topology topo16 = netuit::make_toroidal_topology( {16, 16} );
+
+  const emp::vector<size_t> threads_per_proc{ 4, 2, 1 };
+
+  const auto [proc_assigner, thread_assigner] = netuit::GenerateMetisAssignments(
+    threads_per_proc, topo16
+  );
+  for (size_t node = 0; node < topo16.GetSize(); ++node) {
+    REQUIRE( uitsl::safe_less( proc_assigner(node), threads_per_proc.size() ) );
+    REQUIRE( thread_assigner(node) < threads_per_proc[ proc_assigner(node) ] );
+  }
+}
+
+TEST_CASE("Test MakeMetisWeights") {
+  const auto weights = netuit::MakeMetisWeights(
+    std::unordered_map<size_t, double>{ {0, 0.0}, {2, 1.0}, {3, 0.5} },
+    std::unordered_map<size_t, size_t>{ {7, 10}, {8, 20} }
+  );
+
+  REQUIRE( weights.GetNodeWeight(0) == 1 );
+  REQUIRE( weights.GetNodeWeight(1) == 1 );
+  REQUIRE( weights.GetNodeWeight(2) == netuit::MetisWeights::max_weight );
+  REQUIRE( weights.GetNodeWeight(3) == netuit::MetisWeights::max_weight / 2 );
+  REQUIRE( weights.GetNodeWeight(100) == 1 );
+
+  REQUIRE( weights.GetEdgeWeight(7) == netuit::MetisWeights::max_weight / 2 );
+  REQUIRE( weights.GetEdgeWeight(8) == netuit::MetisWeights::max_weight );
+  REQUIRE( weights.GetEdgeWeight(9) == 1 );
+}
@@ -1,6 +1,10 @@
+#include <stddef.h>
+#include <unordered_map>
+
 #include "Catch/single_include/catch2/catch.hpp"
 
 #include "uitsl/mpi/mpi_guard.hpp"
+#include "uitsl/parallel/affinity_utils.hpp"
 
 #include "uit/setup/ImplSpec.hpp"
 
@@ -35,6 +39,51 @@ TEST_CASE("Test with ProConTopologyFactory", "[nproc:1]") {
 
 }
 
+TEST_CASE("Test PlaceThreadDucts", "[nproc:1]") {
+
+  using Spec = uit::ImplSpec<char>;
+
+  // nodes 0-4 on thread 0 and 5-9 on thread 1, so edges 4->5 and 9->0 cross
+  netuit::Mesh<Spec> mesh{
+    netuit::RingTopologyFactory{}(10),
+    [](const size_t node_id){ return node_id / 5; }
+  };
+
+  std::unordered_map<size_t, size_t> uids_before;
+  for (size_t thread = 0; thread < 2; ++thread) {
+    for (const auto& node : mesh.GetSubmesh(thread)) {
+      for (const auto& input : node.GetInputs()) {
+        uids_before[ input.GetEdgeID() ] = input.GetDuctUID();
+      }
+    }
+  }
+
+  mesh.PlaceThreadDucts( uitsl::get_allowed_cpus() );
+
+  size_t num_replaced{};
+  for (size_t thread = 0; thread < 2; ++thread) {
+    for (const auto& node : mesh.GetSubmesh(thread)) {
+      for (const auto& input : node.GetInputs()) {
+        const bool replaced
+          = input.GetDuctUID() != uids_before.at( input.GetEdgeID() );
+        num_replaced += replaced;
+        REQUIRE( replaced == *input.HoldsThreadImpl() );
+        REQUIRE( *input.LookupEdgeID() == input.GetEdgeID() );
+        REQUIRE( *input.LookupOutletThread() == thread );
+      }
+    }
+  }
+  REQUIRE( num_replaced == 2 );
+
+  // both ends of each replaced edge still share a duct
+  auto producer = mesh.GetSubmesh(0);
+  auto consumer = mesh.GetSubmesh(1);
+  producer.back().GetOutput(0).TryPut('a');
+  producer.back().GetOutput(0).TryFlush();
+  REQUIRE( consumer.front().GetInput(0).JumpGet() == 'a' );
+
+}
+
 // TODO add tests with more TopologyFactories
 // TODO add tests with no-connection nodes
 
@@ -6,6 +6,7 @@
 
 #include "netuit/arrange/RingTopologyFactory.hpp"
 #include "netuit/mesh/MeshTopology.hpp"
+#include "netuit/topology/LocalTopology.hpp"
 
 TEST_CASE("Test MeshTopology", "[nproc:1]") {
 
@@ -20,3 +21,48 @@ TEST_CASE("Test MeshTopology", "[nproc:1]") {
   REQUIRE( mesh_topology.GetEdgeCount() == 100 );
 
 }
+
+TEST_CASE("Test MeshTopology from LocalTopology", "[nproc:1]") {
+
+  using Spec = uit::ImplSpec<char>;
+
+  const netuit::Topology ring = netuit::RingTopologyFactory{}(100);
+
+  // share of a ring split in half holds its own nodes,
+  // plus the two nodes it borders on the other half
+  netuit::internal::MeshTopology<Spec> mesh_topology{
+    netuit::make_local_topology(
+      ring, [](const size_t node_id){ return node_id < 50 ? 0 : 1; }, 0
+    )
+  };
+
+  REQUIRE( mesh_topology.GetNodeCount() == 52 );
+  REQUIRE( mesh_topology.GetEdgeCount() == 51 );
+
+  size_t num_inputs{}, num_outputs{};
+  for (const auto& [node_id, node] : mesh_topology) {
+    num_inputs += node.GetNumInputs();
+    num_outputs += node.GetNumOutputs();
+  }
+  REQUIRE( num_inputs == 51 );
+  REQUIRE( num_outputs == 51 );
+
+  // matches building from the global topology
+  const netuit::internal::MeshTopology<Spec> global_mesh_topology{
+    ring, [](const size_t node_id){ return node_id < 50 ? 0 : 1; }
+  };
+  REQUIRE(
+    mesh_topology.GetEdgeRegistry() == global_mesh_topology.GetEdgeRegistry()
+  );
+  for (const auto edge_id : mesh_topology.GetEdgeRegistry()) {
+    REQUIRE(
+      mesh_topology.GetInputRegistry().at(edge_id)
+      == global_mesh_topology.GetInputRegistry().at(edge_id)
+    );
+    REQUIRE(
+      mesh_topology.GetOutputRegistry().at(edge_id)
+      == global_mesh_topology.GetOutputRegistry().at(edge_id)
+    );
+  }
+
+}
@@ -0,0 +1,183 @@
+#include <algorithm>
+#include <numeric>
+#include <stddef.h>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <mpi.h>
+
+#include "Catch/single_include/catch2/catch.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "uitsl/mpi/comm_utils.hpp"
+#include "uitsl/mpi/exchange_utils.hpp"
+#include "uitsl/utility/assign_utils.hpp"
+
+#include "uit/setup/ImplSpec.hpp"
+
+#include "netuit/arrange/RingTopologyFactory.hpp"
+#include "netuit/mesh/Mesh.hpp"
+#include "netuit/rebalance/MeshRebalancer.hpp"
+
+using Spec = uit::ImplSpec<int>;
+
+size_t get_num_nodes() { return 8 * uitsl::comm_size( MPI_COMM_WORLD ); }
+
+uitsl::proc_id_t initial_assignment(const size_t node_id) {
+  return uitsl::AssignContiguously<uitsl::proc_id_t>{
+    uitsl::comm_size( MPI_COMM_WORLD ), get_num_nodes()
+  }( node_id );
+}
+
+// first proc's nodes are three times as expensive
+double calc_cost(const size_t node_id) {
+  return initial_assignment( node_id ) == 0 ? 3.0 : 1.0;
+}
+
+double calc_spread(const netuit::Mesh<Spec>& mesh) {
+  const size_t num_procs = uitsl::comm_size( MPI_COMM_WORLD );
+
+  const auto topology = mesh.GetLocalTopology();
+  double cost{};
+  for (const size_t node_id : topology.GetNodeIDs()) {
+    cost += calc_cost( node_id );
+  }
+  emp::vector<double> costs( num_procs );
+  MPI_Allgather(
+    &cost, 1, MPI_DOUBLE, costs.data(), 1, MPI_DOUBLE, MPI_COMM_WORLD
+  );
+  const auto [min, max] = std::minmax_element(
+    std::begin(costs), std::end(costs)
+  );
+  return *max - *min;
+}
+
+TEST_CASE("MeshRebalancer evens out load") {
+
+  const size_t num_procs = uitsl::comm_size( MPI_COMM_WORLD );
+  const size_t num_nodes = get_num_nodes();
+
+  netuit::Mesh<Spec> mesh{
+    netuit::RingTopologyFactory{}(num_nodes),
+    uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+    initial_assignment
+  };
+  netuit::MeshRebalancer<Spec> rebalancer{ mesh };
+
+  const double spread_before = calc_spread( mesh );
+  const size_t num_moved = rebalancer.Rebalance( calc_cost );
+  const double spread_after = calc_spread( mesh );
+
+  if ( num_procs > 1 ) {
+    REQUIRE( num_moved );
+    REQUIRE( spread_after < spread_before );
+  } else REQUIRE( num_moved == 0 );
+
+  // every node is owned by exactly one proc
+  const auto topology = mesh.GetLocalTopology();
+  std::string owned;
+  for (const size_t node_id : topology.GetNodeIDs()) {
+    uitsl::pack_bytes( owned, node_id );
+  }
+  emp::vector<size_t> all_owned;
+  for (const auto& buffer : uitsl::allgather_bytes( owned )) {
+    std::string_view view{ buffer };
+    while ( view.size() ) {
+      all_owned.push_back( uitsl::unpack_bytes<size_t>(view) );
+    }
+  }
+  std::sort( std::begin(all_owned), std::end(all_owned) );
+  emp::vector<size_t> expected( num_nodes );
+  std::iota( std::begin(expected), std::end(expected), 0 );
+  REQUIRE( all_owned == expected );
+
+  // nothing moves once balanced
+  REQUIRE( rebalancer.Rebalance( calc_cost ) == 0 );
+
+}
+
+TEST_CASE("MeshRebalancer carries node state and messages") {
+
+  const size_t num_nodes = get_num_nodes();
+
+  netuit::Mesh<Spec> mesh{
+    netuit::RingTopologyFactory{}(num_nodes),
+    uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+    initial_assignment
+  };
+
+  std::unordered_map<size_t, int> states;
+  for (auto& node : mesh.GetSubmesh()) {
+    states[ node.GetNodeID() ] = 7 * node.GetNodeID();
+    node.GetOutput(0).Put( node.GetNodeID() + 1 );
+  }
+
+  netuit::MeshRebalancer<Spec> rebalancer{ mesh };
+  rebalancer.SetNodeState(
+    [&states](const size_t node_id){
+      std::string res;
+      uitsl::pack_bytes( res, states.at(node_id) );
+      states.erase( node_id );
+      return res;
+    },
+    [&states](const size_t node_id, const std::string& state){
+      std::string_view view{ state };
+      states[ node_id ] = uitsl::unpack_bytes<int>( view );
+    }
+  );
+  rebalancer.Rebalance( calc_cost );
+  REQUIRE( rebalancer.GetNumDropped() == 0 );
+
+  auto submesh = mesh.GetSubmesh();
+  REQUIRE( states.size() == submesh.size() );
+  for (auto& node : submesh) {
+    const size_t node_id = node.GetNodeID();
+    REQUIRE( states.at(node_id) == static_cast<int>(7 * node_id) );
+
+    // messages sent before migration survive it, even between procs
+    const size_t neighbor = (node_id + num_nodes - 1) % num_nodes;
+    REQUIRE( node.GetInput(0).GetNext() == static_cast<int>(neighbor + 1) );
+  }
+
+  // rebuilt ducts carry new messages
+  for (auto& node : submesh) node.GetOutput(0).Put( -node.GetNodeID() );
+  for (auto& node : submesh) {
+    const size_t neighbor = (node.GetNodeID() + num_nodes - 1) % num_nodes;
+    while ( node.GetInput(0).JumpGet() != -static_cast<int>(neighbor) );
+  }
+
+  MPI_Barrier( MPI_COMM_WORLD );
+
+}
+
+TEST_CASE("Migrate back and forth keeps messages flowing") {
+
+  const size_t num_procs = uitsl::comm_size( MPI_COMM_WORLD );
+  const size_t num_nodes = get_num_nodes();
+
+  netuit::Mesh<Spec> mesh{
+    netuit::RingTopologyFactory{}(num_nodes),
+    uitsl::AssignIntegrated<uitsl::thread_id_t>{},
+    initial_assignment
+  };
+
+  // node 0 visits the last proc and comes home, so its edges are rebuilt
+  // twice and every message put along the way must arrive
+  for (const uitsl::proc_id_t destination : {num_procs - 1, size_t{}}) {
+    for (auto& node : mesh.GetSubmesh()) {
+      node.GetOutput(0).Put( node.GetNodeID() + 1 );
+    }
+    REQUIRE( mesh.Migrate( {{0, destination}} ) == 0 );
+
+    for (auto& node : mesh.GetSubmesh()) {
+      const size_t neighbor = (node.GetNodeID() + num_nodes - 1) % num_nodes;
+      REQUIRE(
+        node.GetInput(0).GetNext() == static_cast<int>(neighbor + 1)
+      );
+    }
+  }
+
+  MPI_Barrier( MPI_COMM_WORLD );
+
+}
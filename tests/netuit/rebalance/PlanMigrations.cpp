@@ -0,0 +1,72 @@
+#include <stddef.h>
+#include <utility>
+
+#include "Catch/single_include/catch2/catch.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "netuit/rebalance/PlanMigrations.hpp"
+
+using moves_t = emp::vector<std::pair<size_t, uitsl::proc_id_t>>;
+
+TEST_CASE("PlanMigrations leaves balanced loads alone") {
+
+  const emp::vector<netuit::NodeLoad> nodes{
+    {0, 0, 1.0}, {1, 0, 1.0}, {2, 1, 1.0}, {3, 1, 1.0}
+  };
+  const emp::vector<netuit::EdgeLoad> edges{ {0, 1, 1.0}, {2, 3, 1.0} };
+
+  REQUIRE( netuit::PlanMigrations( nodes, edges, 2 ).empty() );
+
+}
+
+TEST_CASE("PlanMigrations evens out overloaded proc") {
+
+  // chain 0 -> 1 -> ... -> 7, all on proc 0
+  emp::vector<netuit::NodeLoad> nodes;
+  emp::vector<netuit::EdgeLoad> edges;
+  for (size_t node{}; node < 8; ++node) {
+    nodes.push_back( {node, 0, 1.0} );
+    if ( node ) edges.push_back( {node - 1, node, 1.0} );
+  }
+
+  const auto moves = netuit::PlanMigrations( nodes, edges, 2 );
+  REQUIRE( moves.size() == 4 );
+  for (const auto& [node_id, proc] : moves) REQUIRE( proc == 1 );
+
+  // moved nodes stay contiguous, cutting only one edge
+  for (size_t i{ 1 }; i < moves.size(); ++i) {
+    REQUIRE( moves[i].first == moves[i - 1].first + 1 );
+  }
+
+}
+
+TEST_CASE("PlanMigrations prefers nodes with traffic to destination") {
+
+  // proc 0 holds 0, 1, 2, proc 1 holds 3, only 2 talks to 3
+  const emp::vector<netuit::NodeLoad> nodes{
+    {0, 0, 1.0}, {1, 0, 1.0}, {2, 0, 1.0}, {3, 1, 0.0}
+  };
+  const emp::vector<netuit::EdgeLoad> edges{
+    {0, 1, 1.0}, {2, 3, 5.0}
+  };
+
+  REQUIRE( netuit::PlanMigrations( nodes, edges, 2 ) == moves_t{ {2, 1} } );
+
+}
+
+TEST_CASE("PlanMigrations respects max_moves") {
+
+  emp::vector<netuit::NodeLoad> nodes;
+  for (size_t node{}; node < 8; ++node) nodes.push_back( {node, 0, 1.0} );
+
+  REQUIRE( netuit::PlanMigrations( nodes, {}, 4, 0.1, 2 ).size() == 2 );
+
+}
+
+TEST_CASE("PlanMigrations won't overshoot with expensive node") {
+
+  const emp::vector<netuit::NodeLoad> nodes{ {0, 0, 10.0}, {1, 1, 1.0} };
+
+  REQUIRE( netuit::PlanMigrations( nodes, {}, 2 ).empty() );
+
+}
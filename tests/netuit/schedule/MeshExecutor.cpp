@@ -0,0 +1,69 @@
+#include <chrono>
+#include <stddef.h>
+#include <thread>
+
+#include "Catch/single_include/catch2/catch.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "uit/setup/ImplSpec.hpp"
+
+#include "netuit/arrange/RingTopologyFactory.hpp"
+#include "netuit/mesh/Mesh.hpp"
+#include "netuit/schedule/MeshExecutor.hpp"
+
+using Spec = uit::ImplSpec<int>;
+
+TEST_CASE("MeshExecutor runs every node every round", "[nproc:1]") {
+
+  constexpr size_t num_nodes{ 8 };
+  netuit::Mesh<Spec> mesh{ netuit::RingTopologyFactory{}(num_nodes) };
+
+  emp::vector<size_t> counts( num_nodes );
+  netuit::MeshExecutor<Spec> executor{
+    mesh, 2, [&counts](auto& node){
+      ++counts[ node.GetNodeID() ];
+      node.GetOutput(0).TryPut( node.GetNodeID() );
+      node.GetInput(0).JumpGet();
+    }
+  };
+  REQUIRE( executor.GetNumNodes() == num_nodes );
+
+  executor.Run( 5 );
+  for (const size_t count : counts) REQUIRE( count == 5 );
+
+}
+
+TEST_CASE("MeshExecutor migrates nodes and rewires ducts", "[nproc:1]") {
+
+  constexpr size_t num_nodes{ 8 };
+  netuit::Mesh<Spec> mesh{ netuit::RingTopologyFactory{}(num_nodes) };
+
+  // mesh places every node on thread 0
+  netuit::MeshExecutor<Spec> executor{
+    mesh, 2, [](auto& node){
+      std::this_thread::sleep_for( std::chrono::microseconds{100} );
+      node.GetOutput(0).TryPut( node.GetNodeID() );
+      node.GetInput(0).JumpGet();
+    }
+  };
+
+  executor.Run( 5 );
+  REQUIRE( executor.GetExecutor().GetNumMigrations() );
+
+  size_t num_on_second{};
+  for (size_t node{}; node < executor.GetNumNodes(); ++node) {
+    num_on_second += executor.GetThread( node ) == 1;
+  }
+  REQUIRE( num_on_second );
+  REQUIRE( num_on_second < num_nodes );
+
+  // each input is intra-thread iff its ring neighbor shares its thread
+  for (size_t node{}; node < executor.GetNumNodes(); ++node) {
+    const size_t neighbor = ( node + num_nodes - 1 ) % num_nodes;
+    const auto& input = executor.GetNode( node ).GetInput( 0 );
+    REQUIRE( input.HoldsThreadImpl().value_or(false) == (
+      executor.GetThread( node ) != executor.GetThread( neighbor )
+    ) );
+  }
+
+}
@@ -0,0 +1,163 @@
+#include <functional>
+#include <limits>
+#include <stddef.h>
+#include <type_traits>
+
+#include "Catch/single_include/catch2/catch.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "uit/fixtures/Conduit.hpp"
+#include "uit/setup/ImplSpec.hpp"
+#include "uitsl/parallel/ReadinessWait.hpp"
+
+#include "netuit/arrange/RingTopologyFactory.hpp"
+#include "netuit/mesh/Mesh.hpp"
+#include "netuit/schedule/NodeScheduler.hpp"
+
+using Spec = uit::ImplSpec<int>;
+
+// publishes readiness, so the scheduler parks awaits
+using ReadySpec = uit::ImplSpec<
+  int,
+  uit::ImplSelect<>,
+  uit::DefaultSpoutWrapper,
+  uit::DEFAULT_BUFFER,
+  std::numeric_limits<size_t>::max(),
+  2,
+  uitsl::ReadinessWait<>
+>;
+
+TEST_CASE("NodeScheduler AwaitNext", "[nproc:1]") {
+
+  auto [inlet, outlet] = uit::Conduit<Spec>{};
+  netuit::NodeScheduler scheduler;
+
+  emp::vector<int> received;
+  scheduler.AwaitNext( outlet, [&received](const int val){
+    received.push_back( val );
+  } );
+  REQUIRE( scheduler.GetNumArmed() == 1 );
+
+  REQUIRE( scheduler.RunOnce() == 0 );
+  REQUIRE( scheduler.GetNumArmed() == 1 );
+
+  inlet.Put( 42 );
+  inlet.Put( 43 );
+  REQUIRE( scheduler.RunOnce() == 1 );
+  REQUIRE( scheduler.GetNumArmed() == 0 );
+  REQUIRE( received == emp::vector<int>{ 42 } );
+
+  // continuation only runs once
+  REQUIRE( scheduler.RunOnce() == 0 );
+  REQUIRE( scheduler.GetNumResumed() == 1 );
+
+}
+
+TEST_CASE("NodeScheduler AwaitPut", "[nproc:1]") {
+
+  auto [inlet, outlet] = uit::Conduit<Spec>{};
+  netuit::NodeScheduler scheduler;
+
+  // fill buffer so next put must wait
+  while ( inlet.TryPut( 0 ) );
+
+  bool resumed{ false };
+  scheduler.AwaitPut( inlet, 1, [&resumed](){ resumed = true; } );
+
+  REQUIRE( scheduler.RunOnce() == 0 );
+  REQUIRE( !resumed );
+
+  REQUIRE( outlet.TryStep() );
+  REQUIRE( scheduler.RunOnce() == 1 );
+  REQUIRE( resumed );
+
+}
+
+TEMPLATE_TEST_CASE("NodeScheduler ring relay", "[nproc:1]", Spec, ReadySpec) {
+
+  constexpr int num_nodes{ 10 };
+  constexpr int num_laps{ 5 };
+
+  netuit::Mesh<TestType> mesh{ netuit::RingTopologyFactory{}(num_nodes) };
+  auto submesh = mesh.GetSubmesh();
+
+  netuit::NodeScheduler scheduler;
+
+  // each node relays an incremented token to its neighbor until it has gone
+  // around the ring num_laps times
+  int last_token{};
+  std::function<void(size_t)> relay = [&](const size_t node){
+    scheduler.AwaitAnyInput( submesh[node], [&, node](size_t, const int token){
+      last_token = token;
+      if ( token < num_nodes * num_laps ) scheduler.AwaitPut(
+        submesh[node].GetOutput(0), token + 1, [&, node](){ relay(node); }
+      );
+    } );
+  };
+  for (size_t node = 0; node < submesh.size(); ++node) relay( node );
+
+  submesh[0].GetOutput(0).Put( 1 );
+  while ( last_token < num_nodes * num_laps ) REQUIRE( scheduler.RunOnce() );
+
+  // only nodes waiting on input remain armed
+  REQUIRE( scheduler.GetNumArmed() == num_nodes - 1 );
+  REQUIRE( scheduler.RunOnce() == 0 );
+  REQUIRE( scheduler.GetNumParked() == (
+    std::is_same<TestType, ReadySpec>::value ? num_nodes - 1 : 0
+  ) );
+  REQUIRE( scheduler.GetNumResumed() == 2 * num_nodes * num_laps - 1 );
+
+}
+
+TEST_CASE("NodeScheduler parks awaits until published to", "[nproc:1]") {
+
+  auto [inlet, outlet] = uit::Conduit<ReadySpec>{};
+  netuit::NodeScheduler scheduler;
+
+  emp::vector<int> received;
+  scheduler.AwaitNext( outlet, [&received](const int val){
+    received.push_back( val );
+  } );
+  REQUIRE( scheduler.GetNumParked() == 0 );
+
+  REQUIRE( scheduler.RunOnce() == 0 );
+  REQUIRE( scheduler.GetNumArmed() == 1 );
+  REQUIRE( scheduler.GetNumParked() == 1 );
+
+  // nothing published, so nothing polled
+  REQUIRE( scheduler.RunOnce() == 0 );
+  REQUIRE( scheduler.GetNumParked() == 1 );
+
+  inlet.Put( 42 );
+  REQUIRE( scheduler.RunOnce() == 1 );
+  REQUIRE( scheduler.GetNumArmed() == 0 );
+  REQUIRE( scheduler.GetNumParked() == 0 );
+  REQUIRE( received == emp::vector<int>{ 42 } );
+
+}
+
+TEST_CASE("NodeScheduler AwaitPut counts one blocking put", "[nproc:1]") {
+
+  auto [inlet, outlet] = uit::Conduit<ReadySpec>{};
+  netuit::NodeScheduler scheduler;
+
+  // fill buffer so next put must wait
+  while ( inlet.TryPut( 0 ) );
+  const size_t num_dropped = inlet.GetNumDroppedPuts();
+  const size_t num_blocking = inlet.GetNumBlockingPuts();
+
+  bool resumed{ false };
+  scheduler.AwaitPut( inlet, 1, [&resumed](){ resumed = true; } );
+
+  for (size_t i{}; i < 10; ++i) REQUIRE( scheduler.RunOnce() == 0 );
+  REQUIRE( scheduler.GetNumParked() == 1 );
+
+  REQUIRE( outlet.TryStep() );
+  REQUIRE( scheduler.RunOnce() == 1 );
+  REQUIRE( resumed );
+
+  REQUIRE( inlet.GetNumDroppedPuts() == num_dropped );
+  REQUIRE( inlet.GetNumBlockingPuts() == num_blocking + 1 );
+  REQUIRE( inlet.GetNumPutsThatBlocked() == 1 );
+
+}
@@ -0,0 +1,81 @@
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "netuit/arrange/RingTopologyFactory.hpp"
+#include "netuit/arrange/ToroidalTopologyFactory.hpp"
+#include "netuit/topology/LocalTopology.hpp"
+
+TEST_CASE("Test LocalTopology", "[nproc:1]") {
+
+  netuit::LocalTopology topology;
+  topology.AddNode(3);
+  topology.AddNode(1);
+  topology.AddEdge(7, 1, 3);
+  topology.AddEdge(5, 3, 9);
+  topology.AddEdge(7, 1, 3);
+  topology.Canonicalize();
+
+  REQUIRE( topology.GetNodeIDs() == emp::vector<size_t>{1, 3} );
+  REQUIRE( topology.HasNode(1) );
+  REQUIRE( !topology.HasNode(9) );
+
+  REQUIRE( topology.GetEdges().size() == 2 );
+  REQUIRE( topology.GetEdges()[0].edge_id == 5 );
+  REQUIRE( topology.GetEdges()[0].inlet_node_id == 3 );
+  REQUIRE( topology.GetEdges()[0].outlet_node_id == 9 );
+  REQUIRE( topology.GetEdges()[1].edge_id == 7 );
+
+}
+
+TEST_CASE("Test make_local_topology", "[nproc:1]") {
+
+  const netuit::Topology ring = netuit::RingTopologyFactory{}(10);
+
+  // everything on one proc
+  {
+    const auto local = netuit::make_local_topology(
+      ring, [](size_t){ return 0; }, 0
+    );
+    REQUIRE( local.GetNodeIDs().size() == 10 );
+    REQUIRE( local.GetEdges().size() == 10 );
+  }
+
+  // split in half, each half has its internal edges and two crossing edges
+  for (const int proc : {0, 1}) {
+    const auto local = netuit::make_local_topology(
+      ring, [](const size_t node_id){ return node_id < 5 ? 0 : 1; }, proc
+    );
+    REQUIRE( local.GetNodeIDs().size() == 5 );
+    REQUIRE( local.GetEdges().size() == 6 );
+    for (const auto& edge : local.GetEdges()) {
+      REQUIRE(
+        (local.HasNode(edge.inlet_node_id) || local.HasNode(edge.outlet_node_id))
+      );
+      REQUIRE( ring[edge.inlet_node_id].GetNumOutputs() == 1 );
+      REQUIRE(
+        ring[edge.inlet_node_id].GetOutputs().front().GetEdgeID()
+        == edge.edge_id
+      );
+      REQUIRE(
+        ring[edge.outlet_node_id].GetInputs().front().GetEdgeID()
+        == edge.edge_id
+      );
+    }
+  }
+
+  // shares of every proc cover every edge
+  {
+    const netuit::Topology torus = netuit::ToroidalTopologyFactory{}({4, 5});
+    size_t num_edges{};
+    for (const int proc : {0, 1, 2}) {
+      const auto local = netuit::make_local_topology(
+        torus, [](const size_t node_id){ return node_id % 3; }, proc
+      );
+      for (const auto& edge : local.GetEdges()) {
+        // count each edge once, at its inlet end
+        num_edges += local.HasNode(edge.inlet_node_id);
+      }
+    }
+    REQUIRE( num_edges == 80 );
+  }
+
+}
@@ -1,8 +1,23 @@
 #include "Catch/single_include/catch2/catch.hpp"
 
 #include "uit/ducts/Duct.hpp"
+#include "uit/ducts/mock/NopDuct.hpp"
+#include "uit/ducts/mock/ThrowDuct.hpp"
+#include "uit/setup/ImplSelect.hpp"
 #include "uit/setup/ImplSpec.hpp"
 
+template<typename ImplSpec>
+struct BigNopDuct : public uit::NopDuct<ImplSpec> {
+
+  using InletImpl = BigNopDuct<ImplSpec>;
+  using OutletImpl = BigNopDuct<ImplSpec>;
+
+  char padding[1024]{};
+
+  template <typename... Args>
+  BigNopDuct(Args&&... args) { ; }
+
+};
 
 TEST_CASE("Test Duct") {
 
@@ -10,3 +25,57 @@ TEST_CASE("Test Duct") {
   uit::internal::Duct<uit::ImplSpec<char>>{};
 
 }
+
+TEST_CASE("Test Duct out-of-line implementation") {
+
+  using Spec = uit::ImplSpec<
+    char,
+    uit::ImplSelect<uit::NopDuct, uit::ThrowDuct, BigNopDuct>
+  >;
+  using duct_t = uit::internal::Duct<Spec>;
+
+  // oversized implementation doesn't bloat the duct
+  REQUIRE( sizeof(duct_t) < sizeof(typename Spec::ProcInletDuct) );
+
+  duct_t duct;
+  REQUIRE( duct.WhichImplHeld() == "intra" );
+
+  duct.EmplaceImpl<typename Spec::ProcInletDuct>();
+  REQUIRE( duct.WhichImplHeld() == "proc" );
+  REQUIRE( duct.TryFlush() );
+
+  duct.GetImpl<typename Spec::ProcInletDuct>().padding[42] = 'x';
+  REQUIRE( duct.GetImpl<typename Spec::ProcInletDuct>().padding[42] == 'x' );
+
+  duct_t in_place{ std::in_place_type_t<typename Spec::ProcInletDuct>{} };
+  REQUIRE( in_place.WhichImplHeld() == "proc" );
+
+}
+
+TEST_CASE("Test Duct metadata") {
+
+  uit::internal::Duct<uit::ImplSpec<char>> duct;
+
+  REQUIRE( !duct.LookupEdgeID().has_value() );
+  REQUIRE( !duct.LookupInletProc().has_value() );
+
+  duct.RegisterEdgeID( 42 );
+  duct.RegisterInletProc( 0 );
+  duct.RegisterOutletThread( 3 );
+
+  REQUIRE( duct.LookupEdgeID() == 42 );
+  REQUIRE( duct.LookupInletProc() == 0 );
+  REQUIRE( duct.LookupOutletThread() == 3 );
+  REQUIRE( !duct.LookupOutletProc().has_value() );
+  REQUIRE( !duct.LookupMeshID().has_value() );
+
+  // metadata belongs to the duct, not its address
+  uit::internal::Duct<uit::ImplSpec<char>> other;
+  REQUIRE( !other.LookupEdgeID().has_value() );
+
+  // unregistered ducts pay only for a pointer
+  static_assert(
+    sizeof( uit::internal::DuctMetadataHandle ) <= sizeof( void* )
+  );
+
+}
@@ -1,4 +1,6 @@
+#include <algorithm>
 #include <cassert>
+#include <numeric>
 #include <ratio>
 #include <thread>
 #include <unordered_set>
@@ -7,6 +9,7 @@
 
 #define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
 #include "Catch/single_include/catch2/catch.hpp"
+#include "Empirical/include/emp/polyfill/span.hpp"
 
 #include "uitsl/debug/safe_cast.hpp"
 #include "uitsl/debug/safe_compare.hpp"
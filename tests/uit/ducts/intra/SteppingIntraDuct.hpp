@@ -21,3 +21,36 @@ TEST_CASE("Test Sequential Completeness " IMPL_NAME) {
   }
 
 }
+
+TEST_CASE("Test Batch Sequential Completeness " IMPL_NAME) {
+
+  netuit::Mesh<Spec> mesh{ netuit::RingTopologyFactory{}(num_nodes) };
+
+  emp::vector<MSG_T> batch( std::kilo::num );
+  std::iota( std::begin(batch), std::end(batch), 1 );
+
+  emp::vector<size_t> sizes;
+
+  for (auto & node : mesh.GetSubmesh()) {
+    sizes.push_back( node.GetOutput(0).TryPutMany(
+      std::span<const MSG_T>{ batch.data(), batch.size() }
+    ) );
+  }
+
+  REQUIRE( std::set<size_t>(std::begin(sizes), std::end(sizes)).size() == 1 );
+  REQUIRE( sizes.front() > 0 );
+
+  for (auto & node : mesh.GetSubmesh()) {
+    emp::vector<MSG_T> received( sizes.front() + 1 );
+    REQUIRE( node.GetInput(0).TryGetMany(
+      std::span<MSG_T>{ received.data(), received.size() }
+    ) == sizes.front() );
+    REQUIRE( std::equal(
+      std::begin(batch),
+      std::next( std::begin(batch), sizes.front() ),
+      std::begin(received)
+    ) );
+    REQUIRE( node.GetInput(0).Get() == batch[ sizes.front() - 1 ] );
+  }
+
+}
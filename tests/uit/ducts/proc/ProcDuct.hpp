@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <numeric>
 #include <ratio>
 #include <thread>
 #include <type_traits>
@@ -5,6 +7,7 @@
 #include <mpi.h>
 
 #include "Catch/single_include/catch2/catch.hpp"
+#include "Empirical/include/emp/polyfill/span.hpp"
 
 #include "netuit/assign/AssignAvailableProcs.hpp"
 #include "uitsl/debug/safe_cast.hpp"
@@ -293,3 +296,41 @@ TEST_CASE("Multi-bridge Validity" PD_IMPL_NAME, "[ProcDuct]" TAGS) { REPEAT {
   UITSL_Barrier(MPI_COMM_WORLD); // todo why
 
 } }
+
+TEST_CASE("Batch Validity" PD_IMPL_NAME, "[ProcDuct]" TAGS) { REPEAT {
+
+  auto [input, output] = make_dyadic_pd_bundle<Spec>();
+
+  emp::vector<MSG_T> batch( uit::DEFAULT_BUFFER / 3 );
+  emp::vector<MSG_T> chunk( uit::DEFAULT_BUFFER / 3 );
+  const MSG_T batch_size = uitsl::safe_cast<MSG_T>( batch.size() );
+
+  int last{};
+  for (MSG_T msg = 0; msg < 10 * std::kilo::num; msg += batch_size) {
+
+    std::iota( std::begin(batch), std::end(batch), msg );
+    REQUIRE( output.TryPutMany(
+      std::span<const MSG_T>{ batch.data(), batch.size() }
+    ) <= batch.size() );
+    output.TryFlush();
+
+    const size_t num_got = input.TryGetMany(
+      std::span<MSG_T>{ chunk.data(), chunk.size() }
+    );
+    REQUIRE( num_got <= chunk.size() );
+
+    for (size_t i = 0; i < num_got; ++i) {
+      const MSG_T current = chunk[i];
+      REQUIRE( current >= 0 );
+      REQUIRE( current < 10 * std::kilo::num + batch_size );
+      REQUIRE( last <= current );
+
+      last = current;
+    }
+    if ( num_got ) REQUIRE( input.Get() == last );
+
+  }
+
+  UITSL_Barrier(MPI_COMM_WORLD); // todo why
+
+} }
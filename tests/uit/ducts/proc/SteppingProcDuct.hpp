@@ -129,3 +129,41 @@ TEST_CASE("Dyadic Mesh sequential consistency " IMPL_NAME, TAGS) { {
   UITSL_Barrier(MPI_COMM_WORLD); // todo why
 
 } }
+
+TEST_CASE("Ring Mesh batch sequential consistency " IMPL_NAME, TAGS) { {
+
+  auto [input, output] = make_ring_pd_bundle<Spec>();
+
+  // long enough to check that buffer wraparound works properly
+  emp::vector<MSG_T> batch( 2 * uit::DEFAULT_BUFFER );
+  std::iota( std::begin(batch), std::end(batch), 1 );
+
+  emp::vector<MSG_T> chunk( uit::DEFAULT_BUFFER / 3 );
+  emp::vector<MSG_T> received;
+
+  size_t num_put{};
+  bool flushed{};
+  // keep flushing until downstream has everything, too
+  while (
+    received.size() < batch.size() || num_put < batch.size() || !flushed
+  ) {
+    num_put += output.TryPutMany( std::span<const MSG_T>{
+      batch.data() + num_put, batch.size() - num_put
+    } );
+    flushed = output.TryFlush();
+
+    const size_t num_got = input.TryGetMany(
+      std::span<MSG_T>{ chunk.data(), chunk.size() }
+    );
+    received.insert(
+      std::end(received),
+      std::begin(chunk),
+      std::next( std::begin(chunk), num_got )
+    );
+  }
+
+  REQUIRE( received == batch );
+
+  UITSL_Barrier(MPI_COMM_WORLD); // todo why
+
+} }
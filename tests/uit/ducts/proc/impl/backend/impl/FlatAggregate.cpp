@@ -0,0 +1,101 @@
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+#include "cereal/include/cereal/archives/binary.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "uit/ducts/proc/impl/backend/impl/FlatAggregate.hpp"
+
+template<typename T>
+emp::vector<std::pair<int, T>> unpack(const uit::FlatAggregate<T>& aggregate) {
+  emp::vector<std::pair<int, T>> res;
+  aggregate.ForEach( [&res](const int tag, T&& val){
+    res.emplace_back( tag, std::move(val) );
+  } );
+  return res;
+}
+
+TEST_CASE("Test FlatAggregate trivially copyable") {
+
+  uit::FlatAggregate<double> aggregate;
+  REQUIRE( aggregate.empty() );
+
+  aggregate.Append( 0, 1.5 );
+  aggregate.Append( 0, 2.5 );
+  aggregate.Append( 3, 4.5 );
+  REQUIRE( aggregate.size() == 3 );
+
+  using record_t = std::pair<int, double>;
+  REQUIRE( unpack( aggregate ) == emp::vector<record_t>{
+    {0, 1.5}, {0, 2.5}, {3, 4.5}
+  } );
+
+  // clearing keeps the arena around for reuse
+  const size_t byte_size = aggregate.GetByteSize();
+  aggregate.clear();
+  REQUIRE( aggregate.empty() );
+  REQUIRE( aggregate.GetByteSize() == 0 );
+
+  aggregate.Append( 1, 9.5 );
+  REQUIRE( aggregate.GetByteSize() < byte_size );
+  REQUIRE( unpack( aggregate ) == emp::vector<record_t>{ {1, 9.5} } );
+
+}
+
+TEST_CASE("Test FlatAggregate non-trivially copyable") {
+
+  uit::FlatAggregate<std::string> aggregate;
+
+  aggregate.Append( 2, "" );
+  aggregate.Append( 5, "hello" );
+  aggregate.Append( 5, std::string(1000, 'x') );
+
+  using record_t = std::pair<int, std::string>;
+  REQUIRE( unpack( aggregate ) == emp::vector<record_t>{
+    {2, ""}, {5, "hello"}, {5, std::string(1000, 'x')}
+  } );
+
+}
+
+TEST_CASE("Test FlatAggregate serialization") {
+
+  uit::FlatAggregate<int> source;
+  for (int tag = 0; tag < 10; ++tag) source.Append( tag, tag * tag );
+
+  std::stringstream ss;
+  {
+    cereal::BinaryOutputArchive oarchive( ss );
+    oarchive( source );
+  }
+
+  uit::FlatAggregate<int> dest;
+  dest.Append( 0, 42 );
+  {
+    cereal::BinaryInputArchive iarchive( ss );
+    iarchive( dest );
+  }
+
+  REQUIRE( dest.size() == source.size() );
+  REQUIRE( unpack( dest ) == unpack( source ) );
+
+}
+
+TEST_CASE("Test FlatAggregate record headers") {
+
+  uit::FlatAggregate<int> aggregate;
+  aggregate.Append( -7, 1 );
+  aggregate.Append( 42, 2 );
+
+  // headers are two padding-free words, so no uninitialized bytes ship
+  REQUIRE( aggregate.GetByteSize() == 2 * (
+    sizeof(size_t) + sizeof(std::int64_t) + sizeof(int)
+  ) );
+  REQUIRE( unpack( aggregate ) == emp::vector<std::pair<int, int>>{
+    {-7, 1}, {42, 2}
+  } );
+
+}
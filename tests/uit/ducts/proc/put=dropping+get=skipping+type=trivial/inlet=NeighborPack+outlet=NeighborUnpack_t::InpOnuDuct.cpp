@@ -0,0 +1,35 @@
+#include "uit/ducts/mock/ThrowDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=skipping+type=trivial/inlet=NeighborPack+outlet=NeighborUnpack_t::InpOnuDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+#include "uitsl/mpi/mpi_guard.hpp"
+
+using ImplSel = uit::ImplSelect<
+  uit::a::SerialPendingDuct,
+  uit::ThrowDuct,
+  uit::t::InpOnuDuct
+>;
+
+#define IMPL_NAME "inlet=NeighborPack+outlet=NeighborUnpack_t::InpOnuDuct"
+#define TAGS "[nproc:2][nproc:3][nproc:4]"
+
+#include "../ProcDuct.hpp"
+#include "../SkippingProcDuct.hpp"
+
+TEST_CASE("Bulk-synchronous steps" PD_IMPL_NAME, "[ProcDuct]" TAGS) { REPEAT {
+
+  auto [inputs, outputs] = make_coiled_pd_bundle<Spec>();
+
+  for (MSG_T step = 1; step < std::kilo::num; ++step) {
+
+    for (auto& output : outputs) output.Put( step );
+    for (auto& output : outputs) output.Flush();
+
+    // every edge moves every step, so each step's value arrives in turn
+    for (auto& input : inputs) while ( input.JumpGet() != step ) {
+      REQUIRE( input.Get() == step - 1 );
+    }
+
+  }
+
+} }
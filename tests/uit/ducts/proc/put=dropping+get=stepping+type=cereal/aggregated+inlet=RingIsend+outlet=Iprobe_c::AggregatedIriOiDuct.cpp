@@ -12,3 +12,39 @@ using ImplSel = uit::ImplSelect<
 
 #include "../ProcDuct.hpp"
 #include "../SteppingProcDuct.hpp"
+
+TEST_CASE("Lagging aggregate member " IMPL_NAME, TAGS) { REPEAT {
+
+  // sends on every contribution, without waiting on missing members
+  using BoundedSpec = uit::ImplSpec<
+    MSG_T,
+    ImplSel,
+    uit::DefaultSpoutWrapper,
+    uit::DEFAULT_BUFFER,
+    std::numeric_limits<size_t>::max(),
+    2,
+    uit::DefaultWaitStrategy,
+    uit::DefaultCounterPolicy,
+    uit::BoundedFlush<0>
+  >;
+
+  auto [inputs, outputs] = make_coiled_pd_bundle<BoundedSpec>();
+
+  // only the first output on each proc ever puts,
+  // so one input on each proc is fed and the other is left waiting
+  MSG_T current{};
+  for (MSG_T msg = 1; current == 0; ++msg) {
+
+    outputs[0].TryPut( msg );
+    outputs[0].TryFlush();
+
+    const MSG_T first = inputs[0].JumpGet();
+    const MSG_T second = inputs[1].JumpGet();
+    REQUIRE( std::min( first, second ) == 0 );
+    current = std::max( first, second );
+
+  }
+
+  UITSL_Barrier(MPI_COMM_WORLD); // todo why
+
+} }
@@ -0,0 +1,91 @@
+#include <atomic>
+
+#include "uitsl/mpi/MpiMultithreadGuard.hpp"
+#include "uitsl/parallel/ThreadTeam.hpp"
+
+#include "uit/ducts/mock/ThrowDuct.hpp"
+#include "uit/ducts/proc/put=dropping+get=stepping+type=cereal/rank_aggregated+inlet=RingIsend+outlet=Iprobe_c::RankAggregatedIriOiDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+// threads share aggregators, so MPI calls come from whichever thread ships
+const uitsl::MpiMultithreadGuard guard;
+
+using ImplSel = uit::ImplSelect<
+  uit::a::SerialPendingDuct,
+  uit::ThrowDuct,
+  uit::c::RankAggregatedIriOiDuct
+>;
+
+#define IMPL_NAME "rank_aggregated+inlet=RingIsend+outlet=Iprobe_c::RankAggregatedIriOiDuct"
+
+#include "../ProcDuct.hpp"
+#include "../SteppingProcDuct.hpp"
+
+TEST_CASE("Multithreaded Ring Mesh " IMPL_NAME, TAGS) { REPEAT {
+
+  // ring neighbors only land on different procs with more than one proc
+  if ( uitsl::get_nprocs() == 1 ) return;
+
+  constexpr size_t num_threads{ 4 };
+  const size_t num_nodes{
+    num_threads * uitsl::safe_cast<size_t>( uitsl::get_nprocs() )
+  };
+
+  // every edge into a proc comes from the previous proc, but each lands on
+  // a different thread, so all of a proc's edges share one aggregator
+  netuit::Mesh<Spec> mesh{
+    netuit::RingTopologyFactory{}(num_nodes),
+    uitsl::AssignContiguously<uitsl::thread_id_t>{ num_threads, num_nodes },
+    uitsl::AssignRoundRobin<uitsl::proc_id_t>{
+      uitsl::safe_cast<size_t>( uitsl::get_nprocs() )
+    }
+  };
+
+  emp::vector<netuit::Mesh<Spec>::submesh_t> submeshes;
+  for (uitsl::thread_id_t tid{}; tid < num_threads; ++tid) {
+    submeshes.push_back( mesh.GetSubmesh( tid ) );
+    REQUIRE( submeshes.back().size() == 1 );
+  }
+
+  // Catch assertions aren't thread safe, so threads only count failures
+  std::atomic<size_t> num_failures{};
+
+  uitsl::ThreadTeam team;
+  for (auto& submesh : submeshes) team.Add( [&submesh, &num_failures, num_nodes](){
+
+    auto& node = submesh.front();
+    auto& input = node.GetInput(0);
+    auto& output = node.GetOutput(0);
+
+    // check that everyone's connected properly
+    output.Put( uitsl::safe_cast<MSG_T>( node.GetNodeID() ) );
+    output.Flush();
+    if ( input.GetNext() != uitsl::safe_cast<MSG_T>(
+      uitsl::circular_index( node.GetNodeID(), num_nodes, -1 )
+    ) ) ++num_failures;
+
+    // messages count up from past every node ID
+    const MSG_T first = uitsl::safe_cast<MSG_T>( num_nodes );
+    const MSG_T end = first + std::kilo::num;
+
+    MSG_T last = input.Get();
+    for (MSG_T msg = first; msg < end; ++msg) {
+
+      output.TryPut( msg );
+      output.TryFlush();
+
+      const MSG_T current = input.JumpGet();
+      if ( current < last || current >= end ) ++num_failures;
+      last = current;
+
+    }
+
+  } );
+
+  team.Join();
+
+  REQUIRE( num_failures == 0 );
+
+  UITSL_Barrier(MPI_COMM_WORLD); // todo why
+
+} }
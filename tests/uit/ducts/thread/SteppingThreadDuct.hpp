@@ -52,6 +52,46 @@ TEMPLATE_TEST_CASE("Ring Mesh sequential consistency " STD_IMPL_NAME, "[nproc:1]
 
 } }
 
+TEMPLATE_TEST_CASE("Ring Mesh batch sequential consistency " STD_IMPL_NAME, "[nproc:1]", two_thread, three_thread) { REPEAT {
+
+  netuit::Mesh<Spec> mesh{
+    netuit::RingTopologyFactory{}(TestType::value),
+    uitsl::AssignSegregated<uitsl::thread_id_t>{}
+  };
+
+  THREADED_BEGIN {
+
+    auto input = mesh.GetSubmesh(thread_id)[0].GetInput(0);
+    auto output = mesh.GetSubmesh(thread_id)[0].GetOutput(0);
+
+    // long enough to check that buffer wraparound works properly
+    emp::vector<MSG_T> batch( 2 * uit::DEFAULT_BUFFER );
+    std::iota( std::begin(batch), std::end(batch), 1 );
+
+    emp::vector<MSG_T> chunk( uit::DEFAULT_BUFFER / 3 );
+    emp::vector<MSG_T> received;
+
+    size_t num_put{};
+    while ( received.size() < batch.size() ) {
+      num_put += output.TryPutMany( std::span<const MSG_T>{
+        batch.data() + num_put, batch.size() - num_put
+      } );
+      const size_t num_got = input.TryGetMany(
+        std::span<MSG_T>{ chunk.data(), chunk.size() }
+      );
+      received.insert(
+        std::end(received),
+        std::begin(chunk),
+        std::next( std::begin(chunk), num_got )
+      );
+    }
+
+    REQUIRE( received == batch );
+
+  } THREADED_END
+
+} }
+
 TEMPLATE_TEST_CASE("Producer-Consumer Mesh connectivity " STD_IMPL_NAME, "[nproc:1]", two_thread, three_thread) { REPEAT {
 
   netuit::Mesh<Spec> mesh{
@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <numeric>
 #include <ratio>
 #include <thread>
 #include <type_traits>
@@ -7,6 +9,7 @@
 
 #include "Catch/single_include/catch2/catch.hpp"
 #include "Empirical/include/emp/base/optional.hpp"
+#include "Empirical/include/emp/polyfill/span.hpp"
 
 #include "uitsl/concurrent/Gatherer.hpp"
 #include "uitsl/debug/benchmark_utils.hpp"
@@ -0,0 +1,16 @@
+#include "uit/ducts/mock/ThrowDuct.hpp"
+#include "uit/ducts/thread/put=growing+get=skipping+type=any/a::TripleBufferDuct.hpp"
+#include "uit/setup/ImplSpec.hpp"
+
+using ImplSel = uit::ImplSelect<
+  uit::a::TripleBufferDuct,
+  uit::a::TripleBufferDuct,
+  uit::ThrowDuct
+>;
+
+#define IMPL_NAME "a::TripleBufferDuct"
+
+#include "../ThreadDuct.hpp"
+
+#include "../SkippingThreadDuct.hpp"
+#include "../ValueThreadDuct.hpp"
@@ -3,6 +3,7 @@
 
 #include "uit/fixtures/Conduit.hpp"
 #include "uit/setup/ImplSpec.hpp"
+#include "uitsl/datastructs/SlabAllocator.hpp"
 
 TEST_CASE("Test Conduit") {
 
@@ -14,3 +15,18 @@ TEST_CASE("Test Conduit") {
   [[maybe_unused]] auto& [inlet, outlet] = conduit;
 
 }
+
+TEST_CASE("Test Conduit with allocator") {
+
+  using Spec = uit::ImplSpec<char>;
+
+  uitsl::SlabAllocator<uit::internal::Duct<Spec>> alloc;
+  uit::Conduit<Spec> conduit( std::allocator_arg, alloc );
+  auto& [inlet, outlet] = conduit;
+
+  REQUIRE( alloc.GetSlab()->GetNumChunks() == 1 );
+
+  inlet.Put( 'a' );
+  REQUIRE( outlet.JumpGet() == 'a' );
+
+}
@@ -1,5 +1,15 @@
+#include <limits>
+#include <ratio>
+#include <stddef.h>
+#include <type_traits>
+#include <utility>
+
 #include "Catch/single_include/catch2/catch.hpp"
 
+#include "uitsl/parallel/ParkingWait.hpp"
+#include "uitsl/parallel/ThreadTeam.hpp"
+
+#include "uit/fixtures/Conduit.hpp"
 #include "uit/setup/ImplSpec.hpp"
 
 
@@ -14,3 +24,188 @@ TEST_CASE("Test ImplSpec") {
   uit::ImplSpec<char>{};
 
 }
+
+TEST_CASE("Test ImplSpec WaitStrategy") {
+
+  static_assert( std::is_same<
+    uit::ImplSpec<char>::WaitStrategy,
+    uit::DefaultWaitStrategy
+  >::value );
+
+  using Spec = uit::ImplSpec<
+    int,
+    uit::ImplSelect<>,
+    uit::DefaultSpoutWrapper,
+    4,
+    std::numeric_limits<size_t>::max(),
+    2,
+    uitsl::ParkingWait<>
+  >;
+
+  auto [ping_inlet, ping_outlet] = uit::Conduit<Spec>{
+    std::in_place_type_t<Spec::ThreadDuct>{}
+  };
+  auto [pong_inlet, pong_outlet] = uit::Conduit<Spec>{
+    std::in_place_type_t<Spec::ThreadDuct>{}
+  };
+
+  // each side blocks until the other responds, so waits park and get woken
+  uitsl::ThreadTeam team;
+  team.Add( [&ping_outlet, &pong_inlet](){
+    for (int i = 1; i <= 100; ++i) pong_inlet.Put( ping_outlet.GetNext() );
+  } );
+
+  for (int i = 1; i <= 100; ++i) {
+    ping_inlet.Put( i );
+    REQUIRE( pong_outlet.GetNext() == i );
+  }
+
+  team.Join();
+
+}
+
+template<typename CounterPolicy>
+using CountedSpec = uit::ImplSpec<
+  int,
+  uit::ImplSelect<>,
+  uit::DefaultSpoutWrapper,
+  uit::DEFAULT_BUFFER,
+  std::numeric_limits<size_t>::max(),
+  2,
+  uit::DefaultWaitStrategy,
+  CounterPolicy
+>;
+
+TEST_CASE("Test ImplSpec CounterPolicy") {
+
+  static_assert( std::is_same<
+    uit::ImplSpec<char>::CounterPolicy,
+    uit::DefaultCounterPolicy
+  >::value );
+
+  SECTION("FullCounters") {
+    auto [inlet, outlet] = uit::Conduit<CountedSpec<uit::FullCounters>>{};
+    for (int i = 1; i <= 8; ++i) REQUIRE( inlet.TryPut(i) );
+    for (int i = 1; i <= 8; ++i) REQUIRE( outlet.GetNext() == i );
+    REQUIRE( inlet.GetNumTryPutsAttempted() == 8 );
+    REQUIRE( outlet.GetNumBlockingPulls() == 8 );
+    REQUIRE( outlet.GetNetFluxThroughDuct() == 8 );
+    REQUIRE( outlet.GetNumReadsPerformed() == 8 );
+  }
+
+  SECTION("NoCounters") {
+    auto [inlet, outlet] = uit::Conduit<CountedSpec<uit::NoCounters>>{};
+    for (int i = 1; i <= 8; ++i) REQUIRE( inlet.TryPut(i) );
+    for (int i = 1; i <= 8; ++i) REQUIRE( outlet.GetNext() == i );
+    REQUIRE( inlet.GetNumTryPutsAttempted() == 0 );
+    REQUIRE( outlet.GetNumBlockingPulls() == 0 );
+    REQUIRE( outlet.GetNetFluxThroughDuct() == 0 );
+    REQUIRE( outlet.GetNumReadsPerformed() == 0 );
+  }
+
+  SECTION("SampledCounters") {
+    constexpr size_t K{ 4 };
+
+    // mixes operations so that counters are bumped at different rates
+    const auto exercise = [](auto& inlet, auto& outlet){
+      for (int i = 1; i <= 37; ++i) {
+        if ( i % 3 ) REQUIRE( inlet.TryPut(i) );
+        else inlet.Put( i );
+      }
+      for (int i = 1; i <= 37; ++i) {
+        if ( i % 2 ) REQUIRE( outlet.GetNext() == i );
+        else {
+          REQUIRE( outlet.TryStep() );
+          REQUIRE( outlet.Get() == i );
+        }
+        if ( i % 5 == 0 ) REQUIRE( outlet.Get() == i );
+      }
+      for (size_t i{}; i < 7; ++i) REQUIRE( !outlet.TryStep() );
+    };
+
+    auto [exact_inlet, exact_outlet] = uit::Conduit<
+      CountedSpec<uit::FullCounters>
+    >{};
+    exercise( exact_inlet, exact_outlet );
+
+    auto [sampled_inlet, sampled_outlet] = uit::Conduit<
+      CountedSpec<uit::SampledCounters<K>>
+    >{};
+    exercise( sampled_inlet, sampled_outlet );
+
+    const auto require_within_k = [](const size_t sampled, const size_t exact){
+      REQUIRE( sampled <= exact );
+      REQUIRE( exact - sampled < K );
+    };
+
+    require_within_k(
+      sampled_inlet.GetNumTryPutsAttempted(),
+      exact_inlet.GetNumTryPutsAttempted()
+    );
+    require_within_k(
+      sampled_inlet.GetNumBlockingPuts(), exact_inlet.GetNumBlockingPuts()
+    );
+    require_within_k(
+      sampled_inlet.GetNumDroppedPuts(), exact_inlet.GetNumDroppedPuts()
+    );
+    require_within_k(
+      sampled_outlet.GetNumReadsPerformed(),
+      exact_outlet.GetNumReadsPerformed()
+    );
+    require_within_k(
+      sampled_outlet.GetNumReadsThatWereFresh(),
+      exact_outlet.GetNumReadsThatWereFresh()
+    );
+    require_within_k(
+      sampled_outlet.GetNumRevisionsPulled(),
+      exact_outlet.GetNumRevisionsPulled()
+    );
+    require_within_k(
+      sampled_outlet.GetNetFluxThroughDuct(),
+      exact_outlet.GetNetFluxThroughDuct()
+    );
+    require_within_k(
+      sampled_outlet.GetNumTryPullsAttempted(),
+      exact_outlet.GetNumTryPullsAttempted()
+    );
+    require_within_k(
+      sampled_outlet.GetNumTryPullsThatWereLaden(),
+      exact_outlet.GetNumTryPullsThatWereLaden()
+    );
+    require_within_k(
+      sampled_outlet.GetNumBlockingPulls(),
+      exact_outlet.GetNumBlockingPulls()
+    );
+  }
+
+}
+
+TEST_CASE("Test ImplSpec FlushPolicy") {
+
+  static_assert( std::is_same<
+    uit::ImplSpec<char>::FlushPolicy,
+    uit::DefaultFlushPolicy
+  >::value );
+
+  SECTION("FullFlush") {
+    uit::FullFlush policy;
+    REQUIRE( !policy.ShouldFlush( std::numeric_limits<size_t>::max() ) );
+  }
+
+  SECTION("BoundedFlush") {
+    uit::BoundedFlush<16> policy;
+    REQUIRE( !policy.ShouldFlush( 8 ) );
+    REQUIRE( policy.ShouldFlush( 16 ) );
+    policy.Reset();
+    REQUIRE( !policy.ShouldFlush( 0 ) );
+  }
+
+  SECTION("DeadlineFlush") {
+    uit::DeadlineFlush<0> overdue;
+    REQUIRE( overdue.ShouldFlush( 0 ) );
+
+    uit::DeadlineFlush<3600> patient;
+    REQUIRE( !patient.ShouldFlush( std::kilo::num ) );
+  }
+
+}
@@ -0,0 +1,55 @@
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uit/fixtures/Conduit.hpp"
+#include "uit/setup/ImplSpec.hpp"
+#include "uit/spouts/Inlet.hpp"
+#include "uit/spouts/PinnedInlet.hpp"
+
+TEST_CASE("Test PinnedInlet") {
+
+  using Spec = uit::ImplSpec<char>;
+
+  SECTION("Test Pin") {
+
+    uit::Conduit<Spec> conduit;
+    auto& [inlet, outlet] = conduit;
+
+    inlet.Freeze();
+    REQUIRE( inlet.IsFrozen() );
+    REQUIRE( outlet.IsFrozen() );
+
+    auto pinned = inlet.Pin<Spec::IntraDuct>();
+    REQUIRE( pinned.TryPut('a') );
+    REQUIRE( pinned.TryFlush() );
+
+    REQUIRE( inlet.GetNumTryPutsAttempted() == 1 );
+    REQUIRE( inlet.GetNumTryPutsThatSucceeded() == 1 );
+    REQUIRE( outlet.JumpGet() == 'a' );
+
+  }
+
+  SECTION("Test VisitPinned") {
+
+    uit::Conduit<Spec> conduit;
+    auto& [inlet, outlet] = conduit;
+
+    inlet.EmplaceDuct<Spec::ThreadDuct>();
+    inlet.Freeze();
+
+    const size_t num_put = inlet.VisitPinned(
+      [](auto pinned) -> size_t {
+        size_t res{};
+        for (char c = 'a'; c < 'd'; ++c) res += pinned.TryPut(c);
+        return res;
+      }
+    );
+
+    REQUIRE( num_put == inlet.GetNumTryPutsThatSucceeded() );
+    REQUIRE( inlet.GetNumTryPutsAttempted() == 3 );
+    REQUIRE( inlet.GetNumDroppedPuts() == 3 - num_put );
+    REQUIRE( outlet.JumpGet() == 'a' + static_cast<char>(num_put) - 1 );
+
+  }
+
+}
@@ -0,0 +1,58 @@
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uit/fixtures/Conduit.hpp"
+#include "uit/setup/ImplSpec.hpp"
+#include "uit/spouts/Outlet.hpp"
+#include "uit/spouts/PinnedOutlet.hpp"
+
+TEST_CASE("Test PinnedOutlet") {
+
+  using Spec = uit::ImplSpec<char>;
+
+  SECTION("Test Pin") {
+
+    uit::Conduit<Spec> conduit;
+    auto& [inlet, outlet] = conduit;
+
+    outlet.Freeze();
+    REQUIRE( outlet.IsFrozen() );
+
+    auto pinned = outlet.Pin<Spec::IntraDuct>();
+
+    REQUIRE( pinned.TryStep() == 0 );
+
+    inlet.TryPut('a');
+    inlet.TryPut('b');
+
+    REQUIRE( pinned.TryStep() == 1 );
+    REQUIRE( pinned.Get() == 'a' );
+    REQUIRE( pinned.JumpGet() == 'b' );
+
+    REQUIRE( outlet.GetNumTryPullsAttempted() == 3 );
+    REQUIRE( outlet.GetNumTryPullsThatWereLaden() == 2 );
+    REQUIRE( outlet.GetNumReadsPerformed() == 2 );
+    REQUIRE( outlet.GetNetFluxThroughDuct() == 2 );
+
+  }
+
+  SECTION("Test VisitPinned") {
+
+    uit::Conduit<Spec> conduit;
+    auto& [inlet, outlet] = conduit;
+
+    inlet.EmplaceDuct<Spec::ThreadDuct>();
+    outlet.Freeze();
+
+    inlet.TryPut('a');
+
+    const char res = outlet.VisitPinned(
+      [](auto pinned) -> char { return pinned.JumpGet(); }
+    );
+
+    REQUIRE( res == 'a' );
+    REQUIRE( outlet.GetNumRevisionsPulled() == 2 );
+
+  }
+
+}
@@ -1,6 +1,8 @@
 #define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
 #include "Catch/single_include/catch2/catch.hpp"
 
+#include "uitsl/mpi/mpi_guard.hpp"
+
 #include "uit/ducts/Duct.hpp"
 #include "uit/setup/ImplSelect.hpp"
 #include "uit/setup/ImplSpec.hpp"
@@ -8,6 +10,9 @@
 #include "uit/spouts/wrappers/inlet/InstrumentationAggregatingInletWrapper.hpp"
 #include "uit/spouts/wrappers/InstrumentationAggregatingSpoutWrapper.hpp"
 
+#include "netuit/arrange/RingTopologyFactory.hpp"
+#include "netuit/mesh/Mesh.hpp"
+
 TEST_CASE("Test InstrumentationAggregatingInletWrapper") {
 
   using Spec = uit::ImplSpec<
@@ -20,3 +25,44 @@ TEST_CASE("Test InstrumentationAggregatingInletWrapper") {
   };
 
 }
+
+TEST_CASE("Test InstrumentationAggregatingInletWrapper snapshot", "[nproc:1]") {
+
+  using Spec = uit::ImplSpec<
+    char,
+    uit::ImplSelect<>,
+    uit::InstrumentationAggregatingSpoutWrapper
+  >;
+  using inlet_t = netuit::MeshNode<Spec>::output_t;
+
+  const size_t num_inlets_before = inlet_t::all::GetNumInlets();
+  const size_t num_intra_inlets_before = inlet_t::intra::GetNumInlets();
+  const size_t num_proc_inlets_before = inlet_t::proc::GetNumInlets();
+
+  netuit::Mesh<Spec> mesh{ netuit::RingTopologyFactory{}(10) };
+  // copies of the mesh's inlets, registered alongside the originals
+  auto submesh = mesh.GetSubmesh();
+
+  for (auto& node : submesh) {
+    for (auto& output : node.GetOutputs()) {
+      output.TryPut('a');
+      output.TryPut('b');
+    }
+  }
+
+  const auto snapshot = inlet_t::all::TakeSnapshot();
+  REQUIRE( snapshot.num_inlets == num_inlets_before + 20 );
+  REQUIRE( snapshot.num_try_puts_attempted == 20 );
+  REQUIRE( snapshot.num_puts_attempted == 20 );
+  REQUIRE(
+    snapshot.num_try_puts_that_succeeded + snapshot.num_dropped_puts == 20
+  );
+  REQUIRE( inlet_t::all::GetNumTryPutsAttempted() == 20 );
+  REQUIRE(
+    inlet_t::all::GetFractionTryPutsDropped()
+    == snapshot.GetFractionTryPutsDropped()
+  );
+  REQUIRE( inlet_t::intra::GetNumInlets() == num_intra_inlets_before + 20 );
+  REQUIRE( inlet_t::proc::GetNumInlets() == num_proc_inlets_before );
+
+}
@@ -1,6 +1,8 @@
 #define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
 #include "Catch/single_include/catch2/catch.hpp"
 
+#include "uitsl/mpi/mpi_guard.hpp"
+
 #include "uit/ducts/Duct.hpp"
 #include "uit/setup/ImplSelect.hpp"
 #include "uit/setup/ImplSpec.hpp"
@@ -8,6 +10,9 @@
 #include "uit/spouts/wrappers/InstrumentationAggregatingSpoutWrapper.hpp"
 #include "uit/spouts/wrappers/outlet/InstrumentationAggregatingOutletWrapper.hpp"
 
+#include "netuit/arrange/RingTopologyFactory.hpp"
+#include "netuit/mesh/Mesh.hpp"
+
 TEST_CASE("Test InstrumentationAggregatingOutletWrapper") {
 
   using Spec = uit::ImplSpec<
@@ -20,3 +25,76 @@ TEST_CASE("Test InstrumentationAggregatingOutletWrapper") {
   };
 
 }
+
+TEST_CASE("Test InstrumentationAggregatingOutletWrapper snapshot", "[nproc:1]") {
+
+  using Spec = uit::ImplSpec<
+    char,
+    uit::ImplSelect<>,
+    uit::InstrumentationAggregatingSpoutWrapper
+  >;
+  using outlet_t = netuit::MeshNode<Spec>::input_t;
+
+  const size_t num_outlets_before = outlet_t::all::GetNumOutlets();
+  const size_t num_intra_outlets_before = outlet_t::intra::GetNumOutlets();
+  const size_t num_proc_outlets_before = outlet_t::proc::GetNumOutlets();
+
+  netuit::Mesh<Spec> mesh{ netuit::RingTopologyFactory{}(10) };
+  // copies of the mesh's outlets, registered alongside the originals
+  auto submesh = mesh.GetSubmesh();
+
+  for (auto& node : submesh) {
+    for (auto& output : node.GetOutputs()) output.TryPut('a');
+  }
+  for (auto& node : submesh) {
+    for (auto& input : node.GetInputs()) input.Jump();
+  }
+
+  const auto snapshot = outlet_t::all::TakeSnapshot();
+  REQUIRE( snapshot.num_outlets == num_outlets_before + 20 );
+  REQUIRE( snapshot.num_try_pulls_attempted == 10 );
+  REQUIRE( snapshot.num_try_pulls_that_were_laden == 10 );
+  REQUIRE( snapshot.GetFractionTryPullsThatWereLaden() == 1.0 );
+  REQUIRE( outlet_t::all::GetNumTryPullsAttempted() == 10 );
+  REQUIRE( outlet_t::all::GetFractionTryPullsThatWereLaden() == 1.0 );
+  REQUIRE( outlet_t::intra::GetNumOutlets() == num_intra_outlets_before + 20 );
+  REQUIRE( outlet_t::proc::GetNumOutlets() == num_proc_outlets_before );
+
+}
+
+TEST_CASE("Test InstrumentationAggregatingOutletWrapper by edge and node", "[nproc:1]") {
+
+  using Spec = uit::ImplSpec<
+    char,
+    uit::ImplSelect<>,
+    uit::InstrumentationAggregatingSpoutWrapper
+  >;
+  using outlet_t = netuit::MeshNode<Spec>::input_t;
+
+  netuit::Mesh<Spec> mesh{ netuit::RingTopologyFactory{}(10) };
+  auto submesh = mesh.GetSubmesh();
+
+  for (auto& node : submesh) {
+    for (auto& output : node.GetOutputs()) output.TryPut('a');
+  }
+  for (auto& node : submesh) {
+    for (auto& input : node.GetInputs()) input.JumpGet();
+  }
+
+  const auto flux_by_edge = outlet_t::all::GetNetFluxThroughDuctByEdge();
+  REQUIRE( flux_by_edge.size() == 10 );
+  size_t net_flux{};
+  for (const auto& [edge_id, flux] : flux_by_edge) net_flux += flux;
+  REQUIRE( net_flux == outlet_t::all::GetNetFluxThroughDuct() );
+
+  const auto reads_by_node = outlet_t::all::GetNumReadsPerformedByNode();
+  REQUIRE( reads_by_node.size() == 10 );
+  size_t num_reads{};
+  for (const auto& [node_id, reads] : reads_by_node) {
+    REQUIRE( reads == reads_by_node.begin()->second );
+    num_reads += reads;
+  }
+  REQUIRE( num_reads );
+  REQUIRE( num_reads == outlet_t::all::GetNumReadsPerformed() );
+
+}
@@ -0,0 +1,48 @@
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uitsl/datastructs/OutOfLine.hpp"
+
+// constructible from anything, so would happily swallow an OutOfLine
+struct Greedy {
+  template<typename... Args> explicit Greedy(Args&&...) { ; }
+};
+
+TEST_CASE("OutOfLine constructs in place", "[nproc:1]") {
+
+  uitsl::OutOfLine<std::string> out_of_line{ 3, 'a' };
+  REQUIRE( *out_of_line == "aaa" );
+  REQUIRE( out_of_line->size() == 3 );
+
+  out_of_line.Get() = "howdy";
+  REQUIRE( std::as_const(out_of_line).Get() == "howdy" );
+
+}
+
+TEST_CASE("OutOfLine moves", "[nproc:1]") {
+
+  uitsl::OutOfLine<std::string> source{ "howdy" };
+  uitsl::OutOfLine<std::string> dest{ std::move(source) };
+  REQUIRE( *dest == "howdy" );
+
+  source = uitsl::OutOfLine<std::string>{ "moo" };
+  dest = std::move( source );
+  REQUIRE( *dest == "moo" );
+
+}
+
+TEST_CASE("OutOfLine in-place constructor never copies", "[nproc:1]") {
+
+  using out_of_line_t = uitsl::OutOfLine<Greedy>;
+
+  static_assert( !std::is_constructible<out_of_line_t, out_of_line_t&>() );
+  static_assert(
+    !std::is_constructible<out_of_line_t, const out_of_line_t&>()
+  );
+  static_assert( std::is_move_constructible<out_of_line_t>() );
+  static_assert( std::is_constructible<out_of_line_t, int, int>() );
+
+}
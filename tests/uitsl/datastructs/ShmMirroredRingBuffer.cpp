@@ -0,0 +1,71 @@
+#include <array>
+#include <numeric>
+#include <ratio>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uitsl/datastructs/ShmMirroredRingBuffer.hpp"
+
+TEST_CASE("Test ShmMirroredRingBuffer", "[nproc:1]") {
+
+  // odd item size so items straddle the mirrored boundary
+  using item_t = std::array<char, 7>;
+  constexpr size_t buff_size{ 1000 };
+
+  const std::string name{
+    "/uitsl_test_shm_" + std::to_string( getpid() )
+  };
+
+  uitsl::ShmMirroredRingBuffer<item_t, buff_size> producer;
+  producer.Create( name );
+
+  uitsl::ShmMirroredRingBuffer<item_t, buff_size> consumer;
+  consumer.Attach( name );
+
+  producer.Unlink();
+
+  const auto make_item = [](const size_t i){
+    item_t res{};
+    res.front() = static_cast<char>( i );
+    res.back() = static_cast<char>( i / 7 );
+    return res;
+  };
+
+  size_t pushed{};
+  size_t popped{};
+  for (size_t rep = 0; rep < std::kilo::num; ++rep) {
+
+    REQUIRE( consumer.GetSize() == 0 );
+
+    for (size_t i = 0; i < buff_size; ++i) {
+      REQUIRE( producer.GetSize() == i );
+      REQUIRE( producer.PushHead( make_item(pushed++) ) );
+    }
+    REQUIRE( consumer.GetSize() == buff_size );
+    REQUIRE( !producer.PushHead( item_t{} ) );
+
+    for (size_t i = 0; i < buff_size / 2; ++i) {
+      REQUIRE( consumer.Get(0) == make_item(popped++) );
+      REQUIRE( consumer.PopTail() == 1 );
+    }
+
+    std::vector<item_t> batch( buff_size );
+    consumer.CopyTail( {batch.data(), buff_size - buff_size / 2} );
+    for (size_t i = 0; i < buff_size - buff_size / 2; ++i) {
+      REQUIRE( batch[i] == make_item(popped++) );
+    }
+    REQUIRE( consumer.PopTail(buff_size) == buff_size - buff_size / 2 );
+
+    for (auto& item : batch) item = make_item(pushed++);
+    REQUIRE( producer.PushHeadMany( {batch.data(), batch.size()} ) == buff_size );
+    REQUIRE( consumer.PopTail(buff_size) == buff_size );
+    popped += buff_size;
+
+    REQUIRE( pushed == popped );
+
+  }
+
+}
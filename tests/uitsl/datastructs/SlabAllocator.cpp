@@ -0,0 +1,66 @@
+#include <memory>
+#include <set>
+#include <stddef.h>
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uitsl/datastructs/SlabAllocator.hpp"
+
+TEST_CASE("Slab reuses freed blocks", "[nproc:1]") {
+
+  uitsl::Slab slab;
+
+  void* first = slab.Allocate( 24 );
+  void* second = slab.Allocate( 24 );
+  REQUIRE( first != second );
+  REQUIRE( slab.GetNumChunks() == 1 );
+
+  slab.Deallocate( first, 24 );
+  REQUIRE( slab.Allocate( 24 ) == first );
+
+  slab.Deallocate( first, 24 );
+  slab.Deallocate( second, 24 );
+
+}
+
+TEST_CASE("Slab packs blocks into chunks", "[nproc:1]") {
+
+  uitsl::Slab slab( 4096 );
+
+  std::set<std::byte*> blocks;
+  for (size_t i = 0; i < 64; ++i) {
+    blocks.insert( static_cast<std::byte*>( slab.Allocate(64) ) );
+  }
+  REQUIRE( blocks.size() == 64 );
+  REQUIRE( slab.GetNumChunks() == 1 );
+  REQUIRE( *blocks.rbegin() - *blocks.begin() == 63 * 64 );
+
+  slab.Allocate( 64 );
+  REQUIRE( slab.GetNumChunks() == 2 );
+
+  // oversized requests bypass the slab
+  void* big = slab.Allocate( 4096 );
+  REQUIRE( slab.GetNumChunks() == 2 );
+  slab.Deallocate( big, 4096 );
+
+}
+
+TEST_CASE("SlabAllocator", "[nproc:1]") {
+
+  uitsl::SlabAllocator<int> alloc;
+  REQUIRE( alloc == uitsl::SlabAllocator<double>( alloc ) );
+  REQUIRE( alloc != uitsl::SlabAllocator<int>{} );
+
+  std::weak_ptr<uitsl::Slab> slab = alloc.GetSlab();
+
+  auto shared = std::allocate_shared<int>( alloc, 42 );
+  alloc = uitsl::SlabAllocator<int>{};
+
+  // shared keeps its slab alive
+  REQUIRE( !slab.expired() );
+  REQUIRE( *shared == 42 );
+
+  shared.reset();
+  REQUIRE( slab.expired() );
+
+}
@@ -0,0 +1,40 @@
+#include <string>
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uitsl/datastructs/SortedVectorMap.hpp"
+
+TEST_CASE("SortedVectorMap", "[nproc:1]") {
+
+  uitsl::SortedVectorMap<size_t, std::string> map{ {
+    {4, "cowsay"}, {1, "howdy"}, {10, "apple"}
+  } };
+
+  REQUIRE( map.size() == 3 );
+  REQUIRE( !map.empty() );
+
+  REQUIRE( map.at(1) == "howdy" );
+  REQUIRE( map.at(4) == "cowsay" );
+  REQUIRE( map.at(10) == "apple" );
+
+  REQUIRE( map.count(1) );
+  REQUIRE( !map.count(2) );
+  REQUIRE( !map.contains(0) );
+  REQUIRE( map.contains(10) );
+  REQUIRE( map.find(11) == map.end() );
+
+  map.at(4) = "moo";
+  REQUIRE( map.at(4) == "moo" );
+
+  map.emplace_back(12, "orange");
+  REQUIRE( map.at(12) == "orange" );
+
+  std::string res;
+  for (const auto& [__, val] : map) res.append(val);
+  REQUIRE( res == "howdymooappleorange" );
+
+  map.clear();
+  REQUIRE( map.empty() );
+  REQUIRE( !map.count(1) );
+
+}
@@ -0,0 +1,65 @@
+#include <atomic>
+#include <chrono>
+#include <stddef.h>
+#include <thread>
+
+#include <mpi.h>
+
+#include "Catch/single_include/catch2/catch.hpp"
+#include "Empirical/include/emp/base/optional.hpp"
+
+#include "uitsl/mpi/MpiMultithreadGuard.hpp"
+#include "uitsl/mpi/ProgressEngine.hpp"
+
+const uitsl::MpiMultithreadGuard guard;
+
+TEST_CASE("Test ProgressEngine") {
+
+  std::atomic<size_t> counter{};
+  // report no progress, so sweeps continue under backoff
+  const uitsl::ProgressEngine::task_t task{
+    [&counter](){ ++counter; return false; }
+  };
+
+  emp::optional<uitsl::ProgressEngine::Registration> registration;
+  registration.emplace( task );
+
+  auto& engine = uitsl::ProgressEngine::Get();
+  engine.WaitForSweep();
+  REQUIRE( counter > 0 );
+
+  // deregistration waits out any sweep running the task
+  registration.reset();
+  const size_t count = counter;
+  engine.WaitForSweep();
+  REQUIRE( counter == count );
+
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+TEST_CASE("Test ProgressEngine wakes from park") {
+
+  auto& engine = uitsl::ProgressEngine::Get();
+
+  // with nothing registered, the progress thread parks
+  // (give any sweep begun before the last deregistration time to finish)
+  std::this_thread::sleep_for( std::chrono::milliseconds{ 10 } );
+  const size_t num_sweeps = engine.GetNumSweeps();
+  std::this_thread::sleep_for( std::chrono::milliseconds{ 10 } );
+  REQUIRE( engine.GetNumSweeps() == num_sweeps );
+
+  std::atomic<size_t> counter{};
+  const uitsl::ProgressEngine::task_t task{
+    [&counter](){ ++counter; return true; }
+  };
+
+  {
+    const uitsl::ProgressEngine::Registration registration( task );
+    engine.WaitForSweep();
+    REQUIRE( counter > 0 );
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
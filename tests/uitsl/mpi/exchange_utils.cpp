@@ -0,0 +1,64 @@
+#include <stddef.h>
+#include <string>
+#include <string_view>
+
+#include <mpi.h>
+
+#include "Catch/single_include/catch2/catch.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
+#include "Empirical/include/emp/tools/string_utils.hpp"
+
+#include "uitsl/mpi/comm_utils.hpp"
+#include "uitsl/mpi/exchange_utils.hpp"
+
+TEST_CASE("Test pack_bytes and unpack_bytes") {
+
+  std::string buffer;
+  uitsl::pack_bytes( buffer, 42 );
+  uitsl::pack_bytes( buffer, 3.5 );
+  uitsl::pack_bytes<size_t>( buffer, 7 );
+  REQUIRE( buffer.size() == sizeof(int) + sizeof(double) + sizeof(size_t) );
+
+  std::string_view view{ buffer };
+  REQUIRE( uitsl::unpack_bytes<int>( view ) == 42 );
+  REQUIRE( uitsl::unpack_bytes<double>( view ) == 3.5 );
+  REQUIRE( uitsl::unpack_bytes<size_t>( view ) == 7 );
+  REQUIRE( view.empty() );
+
+}
+
+TEST_CASE("Test exchange_bytes") {
+
+  const size_t num_procs = uitsl::comm_size( MPI_COMM_WORLD );
+  const uitsl::proc_id_t proc = uitsl::get_proc_id();
+
+  // leave out the message to the next proc over
+  emp::vector<std::string> outgoing;
+  for (size_t to{}; to < num_procs; ++to) outgoing.push_back(
+    to == (proc + 1) % num_procs && num_procs > 1
+    ? std::string{}
+    : emp::to_string( proc, "->", to )
+  );
+
+  const auto incoming = uitsl::exchange_bytes( outgoing );
+  REQUIRE( incoming.size() == num_procs );
+  for (size_t from{}; from < num_procs; ++from) REQUIRE( incoming[from] == (
+    proc == (from + 1) % num_procs && num_procs > 1
+    ? std::string{}
+    : emp::to_string( from, "->", proc )
+  ) );
+
+}
+
+TEST_CASE("Test allgather_bytes") {
+
+  const size_t num_procs = uitsl::comm_size( MPI_COMM_WORLD );
+  const uitsl::proc_id_t proc = uitsl::get_proc_id();
+
+  const auto gathered = uitsl::allgather_bytes( std::string(proc, 'x') );
+  REQUIRE( gathered.size() == num_procs );
+  for (size_t from{}; from < num_procs; ++from) {
+    REQUIRE( gathered[from] == std::string(from, 'x') );
+  }
+
+}
@@ -0,0 +1,53 @@
+#include <stddef.h>
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uitsl/nonce/AdaptiveDepth.hpp"
+
+TEST_CASE("AdaptiveDepth grows on saturation up to cap") {
+
+  uitsl::AdaptiveDepth<10, 4> depth;
+  REQUIRE( depth.GetDepth() == 1 );
+
+  REQUIRE( depth.ReportSaturation() );
+  REQUIRE( depth.GetDepth() == 2 );
+  REQUIRE( depth.ReportSaturation() );
+  REQUIRE( depth.ReportSaturation() );
+  REQUIRE( depth.GetDepth() == 8 );
+  REQUIRE( depth.ReportSaturation() );
+  REQUIRE( depth.GetDepth() == 10 );
+  REQUIRE( !depth.ReportSaturation() );
+  REQUIRE( depth.GetDepth() == 10 );
+
+}
+
+TEST_CASE("AdaptiveDepth shrinks when underused") {
+
+  uitsl::AdaptiveDepth<16, 4> depth{ 16 };
+  REQUIRE( depth.GetDepth() == 16 );
+
+  // busy window keeps depth
+  for (size_t i = 0; i < 4; ++i) depth.ReportOccupancy( i == 2 ? 5 : 0 );
+  REQUIRE( depth.GetDepth() == 16 );
+
+  // quiet window halves depth
+  for (size_t i = 0; i < 4; ++i) depth.ReportOccupancy( 4 );
+  REQUIRE( depth.GetDepth() == 8 );
+
+  // partial window has no effect
+  for (size_t i = 0; i < 3; ++i) depth.ReportOccupancy( 0 );
+  REQUIRE( depth.GetDepth() == 8 );
+  depth.ReportOccupancy( 0 );
+  REQUIRE( depth.GetDepth() == 4 );
+
+  // saturation resets the window
+  for (size_t i = 0; i < 3; ++i) depth.ReportOccupancy( 0 );
+  REQUIRE( depth.ReportSaturation() );
+  depth.ReportOccupancy( 0 );
+  REQUIRE( depth.GetDepth() == 8 );
+
+  // never shrinks below one
+  for (size_t i = 0; i < 100; ++i) depth.ReportOccupancy( 0 );
+  REQUIRE( depth.GetDepth() == 1 );
+
+}
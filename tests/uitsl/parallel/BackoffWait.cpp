@@ -0,0 +1,34 @@
+#include <atomic>
+#include <stddef.h>
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uitsl/parallel/BackoffWait.hpp"
+#include "uitsl/parallel/ThreadTeam.hpp"
+
+using wait_t = uitsl::BackoffWait<4, 1000, 100000>;
+
+TEST_CASE("BackoffWait returns once attempt succeeds") {
+
+  size_t num_attempts{};
+  wait_t::Until( [&num_attempts](){ return ++num_attempts == 100; } );
+  REQUIRE( num_attempts == 100 );
+
+}
+
+TEST_CASE("BackoffWait waits on another thread") {
+
+  std::atomic<bool> flag{ false };
+
+  uitsl::ThreadTeam team;
+  team.Add( [&flag](){
+    flag = true;
+    wait_t::Notify();
+  } );
+
+  wait_t::Until( [&flag](){ return flag.load(); } );
+  REQUIRE( flag );
+
+  team.Join();
+
+}
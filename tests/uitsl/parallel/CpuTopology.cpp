@@ -0,0 +1,81 @@
+#include <fstream>
+#include <string>
+
+#include "Catch/single_include/catch2/catch.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "uitsl/fetch/make_temp_dirpath.hpp"
+#include "uitsl/parallel/CpuTopology.hpp"
+#include "uitsl/polyfill/filesystem.hpp"
+
+namespace {
+
+void write_file(const std::filesystem::path& path, const std::string& contents) {
+  std::filesystem::create_directories( path.parent_path() );
+  std::ofstream( path ) << contents << '\n';
+}
+
+} // namespace
+
+TEST_CASE("parse_cpu_list") {
+
+  REQUIRE( uitsl::parse_cpu_list("0").size() == 1 );
+  REQUIRE( uitsl::parse_cpu_list("").empty() );
+  REQUIRE(
+    uitsl::parse_cpu_list("0-3,8,10-11\n")
+    == emp::vector<uitsl::cpu_id_t>{ 0, 1, 2, 3, 8, 10, 11 }
+  );
+
+}
+
+TEST_CASE("CpuTopology orders CPUs hierarchically") {
+
+  // two packages, two cores each, hyperthreads numbered across packages
+  const uitsl::CpuTopology topology{ {
+    {0, 0, 0, 0}, {1, 0, 0, 1}, {2, 1, 1, 0}, {3, 1, 1, 1},
+    {4, 0, 0, 0}, {5, 0, 0, 1}, {6, 1, 1, 0}, {7, 1, 1, 1},
+  } };
+
+  REQUIRE( topology.GetSize() == 8 );
+  REQUIRE(
+    topology.GetCpuIDs()
+    == emp::vector<uitsl::cpu_id_t>{ 0, 4, 1, 5, 2, 6, 3, 7 }
+  );
+
+  REQUIRE( topology.SharesLevel(0, 1, uitsl::CpuTopology::core_level) );
+  REQUIRE( !topology.SharesLevel(0, 1, uitsl::CpuTopology::cpu_level) );
+  REQUIRE( !topology.SharesLevel(1, 2, uitsl::CpuTopology::core_level) );
+  REQUIRE( topology.SharesLevel(1, 2, uitsl::CpuTopology::package_level) );
+  REQUIRE( !topology.SharesLevel(3, 4, uitsl::CpuTopology::package_level) );
+
+}
+
+TEST_CASE("CpuTopology reads sysfs") {
+
+  const auto root = uitsl::make_temp_dirpath();
+  for (size_t cpu = 0; cpu < 4; ++cpu) {
+    const auto path = root / "cpu" / ( "cpu" + std::to_string(cpu) ) / "topology";
+    write_file( path / "physical_package_id", std::to_string(cpu / 2) );
+    write_file( path / "core_id", std::to_string(cpu % 2) );
+  }
+  write_file( root / "node" / "node0" / "cpulist", "0-1" );
+  write_file( root / "node" / "node1" / "cpulist", "2-3" );
+
+  const auto topology = uitsl::CpuTopology::FromSysfs( {3, 1, 2, 0}, root );
+  REQUIRE( topology.GetSize() == 4 );
+  REQUIRE( topology.GetCpuIDs() == emp::vector<uitsl::cpu_id_t>{ 0, 1, 2, 3 } );
+  REQUIRE( topology.GetCpu(3).package_id == 1 );
+  REQUIRE( topology.GetCpu(3).numa_node_id == 1 );
+  REQUIRE( topology.GetCpu(3).core_id == 1 );
+
+  // CPUs missing from sysfs get their own core
+  const auto missing = uitsl::CpuTopology::FromSysfs( {0, 9}, root );
+  REQUIRE( missing.GetCpu(1).cpu_id == 9 );
+  REQUIRE( missing.GetCpu(1).core_id == 9 );
+  REQUIRE( missing.GetCpu(1).package_id == 0 );
+
+  std::filesystem::remove_all( root );
+
+  REQUIRE( uitsl::CpuTopology::FromSysfs().GetSize() );
+
+}
@@ -0,0 +1,68 @@
+#include <atomic>
+#include <chrono>
+#include <stddef.h>
+#include <thread>
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uitsl/parallel/ParkingLot.hpp"
+#include "uitsl/parallel/ThreadTeam.hpp"
+
+TEST_CASE("ParkingLot Wait times out without notification") {
+
+  uitsl::ParkingLot lot;
+
+  const size_t ticket = lot.PrepareWait();
+  REQUIRE( lot.GetNumWaiting() == 1 );
+
+  lot.Wait( ticket, std::chrono::milliseconds{ 1 } );
+  REQUIRE( lot.GetNumWaiting() == 0 );
+
+}
+
+TEST_CASE("ParkingLot notification before Wait is not lost") {
+
+  uitsl::ParkingLot lot;
+
+  const size_t ticket = lot.PrepareWait();
+  lot.NotifyAll();
+
+  const auto start = std::chrono::steady_clock::now();
+  lot.Wait( ticket, std::chrono::hours{ 1 } );
+  REQUIRE( std::chrono::steady_clock::now() - start < std::chrono::hours{1} );
+  REQUIRE( lot.GetNumWaiting() == 0 );
+
+}
+
+TEST_CASE("ParkingLot CancelWait") {
+
+  uitsl::ParkingLot lot;
+
+  lot.PrepareWait();
+  REQUIRE( lot.GetNumWaiting() == 1 );
+  lot.CancelWait();
+  REQUIRE( lot.GetNumWaiting() == 0 );
+
+}
+
+TEST_CASE("ParkingLot NotifyAll wakes parked thread") {
+
+  uitsl::ParkingLot lot;
+  std::atomic<bool> flag{ false };
+
+  uitsl::ThreadTeam team;
+  team.Add( [&lot, &flag](){
+    while ( !flag ) {
+      const size_t ticket = lot.PrepareWait();
+      if ( flag ) { lot.CancelWait(); break; }
+      lot.Wait( ticket, std::chrono::hours{ 1 } );
+    }
+  } );
+
+  flag = true;
+  lot.NotifyAll();
+  team.Join();
+
+  REQUIRE( lot.GetNumWaiting() == 0 );
+
+}
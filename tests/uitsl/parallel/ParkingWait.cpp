@@ -0,0 +1,55 @@
+#include <atomic>
+#include <stddef.h>
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "uitsl/parallel/ParkingWait.hpp"
+#include "uitsl/parallel/ThreadTeam.hpp"
+
+using wait_t = uitsl::ParkingWait<4>;
+
+TEST_CASE("ParkingWait returns once attempt succeeds") {
+
+  size_t num_attempts{};
+  wait_t::Until( [&num_attempts](){ return ++num_attempts == 100; } );
+  REQUIRE( num_attempts == 100 );
+
+}
+
+TEST_CASE("ParkingWait waits on another thread") {
+
+  std::atomic<bool> flag{ false };
+
+  uitsl::ThreadTeam team;
+  team.Add( [&flag](){
+    flag = true;
+    wait_t::Notify();
+  } );
+
+  wait_t::Until( [&flag](){ return flag.load(); } );
+  REQUIRE( flag );
+
+  team.Join();
+
+}
+
+TEST_CASE("ParkingWait waits on a key") {
+
+  std::atomic<bool> flag{ false };
+
+  // waiters on the same key share a lot
+  REQUIRE( &wait_t::GetLot( &flag ) == &wait_t::GetLot( &flag ) );
+  REQUIRE( &wait_t::GetLot( &flag ) != &wait_t::GetLot( nullptr ) );
+
+  uitsl::ThreadTeam team;
+  team.Add( [&flag](){
+    flag = true;
+    wait_t::Notify( &flag );
+  } );
+
+  wait_t::Until( [&flag](){ return flag.load(); }, &flag );
+  REQUIRE( flag );
+
+  team.Join();
+
+}
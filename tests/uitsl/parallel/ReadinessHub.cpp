@@ -0,0 +1,85 @@
+#include <atomic>
+
+#include "Catch/single_include/catch2/catch.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "uitsl/parallel/ReadinessHub.hpp"
+#include "uitsl/parallel/ThreadTeam.hpp"
+
+TEST_CASE("ReadinessHub posts subscribed keys once") {
+
+  int a{}, b{};
+  uitsl::ReadinessHub::Inbox inbox;
+  emp::vector<const void*> keys;
+
+  // nothing subscribed, nothing posted
+  uitsl::ReadinessHub::Publish( &a );
+  inbox.Drain( keys );
+  REQUIRE( keys.empty() );
+
+  uitsl::ReadinessHub::Subscribe( &a, inbox );
+  uitsl::ReadinessHub::Publish( &b );
+  uitsl::ReadinessHub::Publish( &a );
+  uitsl::ReadinessHub::Publish( &a );
+
+  inbox.Drain( keys );
+  REQUIRE( keys == emp::vector<const void*>{ &a } );
+
+  // drained keys are gone
+  keys.clear();
+  inbox.Drain( keys );
+  REQUIRE( keys.empty() );
+
+}
+
+TEST_CASE("ReadinessHub posts to every subscribed inbox") {
+
+  int a{};
+  uitsl::ReadinessHub::Inbox first, second;
+
+  uitsl::ReadinessHub::Subscribe( &a, first );
+  uitsl::ReadinessHub::Subscribe( &a, second );
+  uitsl::ReadinessHub::Publish( &a );
+
+  emp::vector<const void*> keys;
+  first.Drain( keys );
+  second.Drain( keys );
+  REQUIRE( keys == emp::vector<const void*>{ &a, &a } );
+
+}
+
+TEST_CASE("ReadinessHub drops subscriptions of destroyed inboxes") {
+
+  int a{};
+  {
+    uitsl::ReadinessHub::Inbox inbox;
+    uitsl::ReadinessHub::Subscribe( &a, inbox );
+  }
+
+  // must not post to the destroyed inbox
+  uitsl::ReadinessHub::Publish( &a );
+
+}
+
+TEST_CASE("ReadinessHub publish from another thread") {
+
+  std::atomic<bool> flag{ false };
+  uitsl::ReadinessHub::Inbox inbox;
+  emp::vector<const void*> keys;
+
+  // subscribe, then recheck, so the publish can't be missed
+  uitsl::ReadinessHub::Subscribe( &flag, inbox );
+
+  uitsl::ThreadTeam team;
+  team.Add( [&flag](){
+    flag = true;
+    uitsl::ReadinessHub::Publish( &flag );
+  } );
+
+  while ( !flag ) ;
+  team.Join();
+
+  inbox.Drain( keys );
+  REQUIRE( keys == emp::vector<const void*>{ &flag } );
+
+}
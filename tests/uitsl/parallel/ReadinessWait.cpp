@@ -0,0 +1,54 @@
+#include <atomic>
+#include <stddef.h>
+
+#include "Catch/single_include/catch2/catch.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "uitsl/parallel/ParkingWait.hpp"
+#include "uitsl/parallel/ReadinessWait.hpp"
+#include "uitsl/parallel/ThreadTeam.hpp"
+
+using wait_t = uitsl::ReadinessWait<uitsl::ParkingWait<4>>;
+
+TEST_CASE("ReadinessWait returns once attempt succeeds") {
+
+  size_t num_attempts{};
+  wait_t::Until( [&num_attempts](){ return ++num_attempts == 100; } );
+  REQUIRE( num_attempts == 100 );
+
+}
+
+TEST_CASE("ReadinessWait notifies base waiters") {
+
+  std::atomic<bool> flag{ false };
+
+  uitsl::ThreadTeam team;
+  team.Add( [&flag](){
+    flag = true;
+    wait_t::Notify( &flag );
+  } );
+
+  wait_t::Until( [&flag](){ return flag.load(); }, &flag );
+  REQUIRE( flag );
+
+  team.Join();
+
+}
+
+TEST_CASE("ReadinessWait publishes keyed notifications") {
+
+  int key{};
+  uitsl::ReadinessHub::Inbox inbox;
+  uitsl::ReadinessHub::Subscribe( &key, inbox );
+
+  // unkeyed notifications publish nothing
+  wait_t::Notify();
+  emp::vector<const void*> keys;
+  inbox.Drain( keys );
+  REQUIRE( keys.empty() );
+
+  wait_t::Notify( &key );
+  inbox.Drain( keys );
+  REQUIRE( keys == emp::vector<const void*>{ &key } );
+
+}
@@ -0,0 +1,101 @@
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <stddef.h>
+
+#include "Catch/single_include/catch2/catch.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "uitsl/parallel/ShardedRegistry.hpp"
+#include "uitsl/parallel/ThreadTeam.hpp"
+
+using registry_t = uitsl::ShardedRegistry<const size_t*, 4>;
+
+TEST_CASE("ShardedRegistry registration and deregistration") {
+
+  registry_t registry;
+  emp::vector<size_t> items( 10 );
+
+  {
+    emp::vector<std::unique_ptr<registry_t::Registration>> registrations;
+    for (const auto& item : items) registrations.push_back(
+      std::make_unique<registry_t::Registration>( registry, &item )
+    );
+    REQUIRE( registry.GetSize() == items.size() );
+
+    registrations.erase(
+      std::begin( registrations ), std::next( std::begin(registrations), 5 )
+    );
+    REQUIRE( registry.GetSize() == 5 );
+
+    // vacated slots get reused
+    for (size_t i = 0; i < 5; ++i) registrations.push_back(
+      std::make_unique<registry_t::Registration>( registry, &items[i] )
+    );
+    REQUIRE( registry.GetSize() == items.size() );
+
+    emp::vector<const size_t*> visited;
+    registry.Visit( [&visited](const size_t* item){
+      visited.push_back( item );
+    } );
+    std::sort( std::begin(visited), std::end(visited) );
+    for (size_t i = 0; i < items.size(); ++i) {
+      REQUIRE( visited[i] == &items[i] );
+    }
+  }
+
+  REQUIRE( registry.GetSize() == 0 );
+
+}
+
+TEST_CASE("ShardedRegistry iteration") {
+
+  registry_t registry;
+  emp::vector<size_t> items( 10 );
+
+  emp::vector<std::unique_ptr<registry_t::Registration>> registrations;
+  for (const auto& item : items) registrations.push_back(
+    std::make_unique<registry_t::Registration>( registry, &item )
+  );
+  registrations[0].reset();
+  registrations[4].reset();
+  registrations[9].reset();
+
+  const auto lock = registry.MakeSharedLock();
+  emp::vector<const size_t*> iterated(
+    std::begin( registry ), std::end( registry )
+  );
+  REQUIRE( iterated.size() == 7 );
+  for (const size_t i : {0, 4, 9}) REQUIRE( std::count(
+    std::begin( iterated ), std::end( iterated ), &items[i]
+  ) == 0 );
+
+}
+
+TEST_CASE("ShardedRegistry multithreaded") {
+
+  registry_t registry;
+  emp::vector<size_t> items( 400 );
+
+  uitsl::ThreadTeam team;
+  for (size_t thread = 0; thread < 4; ++thread) {
+    team.Add([&registry, &items, thread](){
+      emp::vector<std::unique_ptr<registry_t::Registration>> registrations;
+      for (size_t i = thread; i < items.size(); i += 4) {
+        registrations.push_back(
+          std::make_unique<registry_t::Registration>( registry, &items[i] )
+        );
+        if ( i % 3 == 0 ) registrations.pop_back();
+        registry.GetSize();
+      }
+    });
+  }
+  team.Join();
+
+  REQUIRE( registry.GetSize() == 0 );
+
+  // shards of exited threads get handed off
+  registry_t::Registration registration{ registry, &items.front() };
+  REQUIRE( registry.GetSize() == 1 );
+
+}
@@ -1,4 +1,5 @@
 #include "Catch/single_include/catch2/catch.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
 
 #include "uitsl/parallel/ThreadIbarrierFactory.hpp"
 #include "uitsl/parallel/ThreadIbarrier.hpp"
@@ -46,3 +47,42 @@ TEST_CASE("ThreadIbarrier satisfied parallel") {
     team.Join();
   }
 }
+
+TEST_CASE("ThreadIbarrier run ahead") {
+
+  uitsl::ThreadIbarrierFactory factory{2};
+
+  emp::vector<uitsl::ThreadIbarrier> barriers;
+  for (size_t rep = 0; rep < 5; ++rep) {
+    barriers.push_back( factory.MakeBarrier() );
+  }
+  for (const auto& barrier : barriers) REQUIRE( !barrier.IsComplete() );
+
+  uitsl::ThreadTeam team;
+  team.Add( [&factory](){
+    for (size_t rep = 0; rep < 3; ++rep) factory.MakeBarrier();
+  } );
+  team.Join();
+
+  for (size_t rep = 0; rep < 3; ++rep) REQUIRE( barriers[rep].IsComplete() );
+  for (size_t rep = 3; rep < 5; ++rep) REQUIRE( !barriers[rep].IsComplete() );
+
+}
+
+TEST_CASE("ThreadIbarrier successive teams") {
+
+  // a long-lived factory outlasts the teams using it
+  uitsl::ThreadIbarrierFactory factory{2};
+
+  for (size_t rep = 0; rep < 5; ++rep) {
+    uitsl::ThreadTeam team;
+    for (size_t thread = 0; thread < 2; ++thread) {
+      team.Add([&factory](){
+        uitsl::ThreadIbarrier barrier{ factory.MakeBarrier() };
+        while( !barrier.IsComplete() );
+      });
+    }
+    team.Join();
+  }
+
+}
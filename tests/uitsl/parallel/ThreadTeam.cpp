@@ -0,0 +1,74 @@
+#include <atomic>
+#include <stddef.h>
+
+#include <sched.h>
+
+#include "Catch/single_include/catch2/catch.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "uitsl/parallel/affinity_utils.hpp"
+#include "uitsl/parallel/ThreadTeam.hpp"
+
+TEST_CASE("ThreadTeam runs every worker") {
+
+  std::atomic<size_t> count{};
+
+  uitsl::ThreadTeam team;
+  for (size_t i = 0; i < 4; ++i) team.Add( [&count](){ ++count; } );
+  REQUIRE( team.Size() == 4 );
+  team.Join();
+
+  REQUIRE( count == 4 );
+  REQUIRE( team.Size() == 0 );
+
+}
+
+TEST_CASE("ThreadTeam pins workers") {
+
+  const auto cpus = uitsl::get_allowed_cpus();
+  REQUIRE( cpus.size() );
+
+  emp::vector<int> ran_on( 4, -1 );
+
+  uitsl::ThreadTeam team{ cpus };
+  for (size_t i = 0; i < ran_on.size(); ++i) team.Add(
+    [&ran_on, i](){ ran_on[i] = sched_getcpu(); }
+  );
+  team.Join();
+
+  for (size_t i = 0; i < ran_on.size(); ++i) {
+    REQUIRE( ran_on[i] == static_cast<int>( cpus[i % cpus.size()] ) );
+  }
+
+  int pinned_ran_on{ -1 };
+  team.AddPinned( cpus.back(), [&pinned_ran_on](){
+    pinned_ran_on = sched_getcpu();
+    REQUIRE( uitsl::get_allowed_cpus().size() == 1 );
+  } );
+  team.Join();
+  REQUIRE( pinned_ran_on == static_cast<int>( cpus.back() ) );
+
+}
+
+TEST_CASE("ThreadTeam passes arguments to workers") {
+
+  const auto cpus = uitsl::get_allowed_cpus();
+  REQUIRE( cpus.size() );
+
+  emp::vector<size_t> results( 5 );
+  const auto task = [&results](const size_t i, const size_t val){
+    results[i] = val;
+  };
+
+  uitsl::ThreadTeam unpinned;
+  unpinned.Add( task, 0, 10 );
+  unpinned.Join();
+
+  uitsl::ThreadTeam pinned{ cpus };
+  for (size_t i = 1; i < 4; ++i) pinned.Add( task, i, 10 * i );
+  pinned.AddPinned( cpus.front(), task, 4, size_t{ 42 } );
+  pinned.Join();
+
+  REQUIRE( results == emp::vector<size_t>{ 10, 10, 20, 30, 42 } );
+
+}
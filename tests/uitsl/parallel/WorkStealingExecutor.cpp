@@ -0,0 +1,104 @@
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stddef.h>
+#include <thread>
+#include <unordered_set>
+
+#include "Catch/single_include/catch2/catch.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "uitsl/parallel/WorkStealingExecutor.hpp"
+
+TEST_CASE("WorkStealingExecutor runs every task every round") {
+
+  uitsl::WorkStealingExecutor executor{ 3 };
+
+  emp::vector<std::atomic<size_t>> counts( 10 );
+  for (size_t task = 0; task < counts.size(); ++task) executor.AddTask(
+    [&counts, task](){ ++counts[task]; }, task % 3
+  );
+
+  executor.Run( 5 );
+  for (const auto& count : counts) REQUIRE( count == 5 );
+
+}
+
+TEST_CASE("WorkStealingExecutor rebalances overloaded thread") {
+
+  uitsl::WorkStealingExecutor executor{ 2 };
+  executor.SetStealable( [](size_t){ return false; } );
+
+  size_t num_migrated{};
+  executor.SetOnMigrate( [&num_migrated](
+    size_t, const uitsl::thread_id_t from, const uitsl::thread_id_t to
+  ){
+    REQUIRE( from == 0 );
+    REQUIRE( to == 1 );
+    ++num_migrated;
+  } );
+
+  for (size_t task = 0; task < 8; ++task) executor.AddTask(
+    [](){ std::this_thread::sleep_for( std::chrono::microseconds{100} ); }, 0
+  );
+
+  executor.Run( 2 );
+
+  size_t num_on_second{};
+  for (size_t task = 0; task < executor.GetNumTasks(); ++task) {
+    num_on_second += executor.GetOwner( task ) == 1;
+  }
+  REQUIRE( num_on_second );
+  REQUIRE( num_on_second < executor.GetNumTasks() );
+  REQUIRE( num_migrated == executor.GetNumMigrations() );
+  REQUIRE( executor.GetNumSteals() == 0 );
+
+}
+
+TEST_CASE("WorkStealingExecutor prefers tasks with affinity") {
+
+  uitsl::WorkStealingExecutor executor{ 2 };
+  executor.SetStealable( [](size_t){ return false; } );
+  executor.SetRebalancing( 0.0, 1 );
+  // second half of tasks prefer second thread
+  executor.SetAffinity( [](const size_t task, const uitsl::thread_id_t thread){
+    return thread == 1 && task >= 4;
+  } );
+
+  for (size_t task = 0; task < 8; ++task) executor.AddTask(
+    [](){ std::this_thread::sleep_for( std::chrono::microseconds{100} ); }, 0
+  );
+
+  executor.Run( 1 );
+
+  REQUIRE( executor.GetNumMigrations() == 1 );
+  for (size_t task = 0; task < 4; ++task) {
+    REQUIRE( executor.GetOwner( task ) == 0 );
+  }
+
+}
+
+TEST_CASE("WorkStealingExecutor keeps pinned tasks in place") {
+
+  uitsl::WorkStealingExecutor executor{ 2 };
+
+  std::mutex mutex;
+  std::unordered_set<std::thread::id> pinned_runners;
+  for (size_t task = 0; task < 8; ++task) executor.AddTask(
+    [&mutex, &pinned_runners, task](){
+      std::this_thread::sleep_for( std::chrono::microseconds{100} );
+      if ( task == 0 ) {
+        const std::lock_guard lock{ mutex };
+        pinned_runners.insert( std::this_thread::get_id() );
+      }
+    },
+    0,
+    task == 0
+  );
+
+  executor.Run( 3 );
+
+  REQUIRE( executor.GetOwner( 0 ) == 0 );
+  REQUIRE( pinned_runners.size() == 1 );
+
+}